@@ -90,8 +90,9 @@ namespace CFDP {
     }
 
     // Add the middle words aligned
-    for ( ; index + 4 <= length; index += 4)
-      addWordAligned(&data[index]);
+    const U32 numWords = (length - index) / 4;
+    this->addWordsAligned(&data[index], numWords);
+    index += 4 * numWords;
 
     // Add the last word unaligned if necessary
     if (index < length) {
@@ -106,10 +107,26 @@ namespace CFDP {
   }
 
   void Checksum ::
-    addWordAligned(const U8 *const word)
+    addWordsAligned(
+        const U8 *const words,
+        const U32 numWords
+    )
   {
-    for (U8 i = 0; i < 4; ++i)
-      addByteAtOffset(word[i], i);
+    // Sum each byte position separately. The sums may wrap, since only
+    // their low 32 bits matter once shifted into place. The loop has no
+    // dependence between words, so the compiler can vectorize it.
+    U32 sum0 = 0;
+    U32 sum1 = 0;
+    U32 sum2 = 0;
+    U32 sum3 = 0;
+    for (U32 i = 0; i < numWords; ++i) {
+      const U8 *const word = &words[4 * i];
+      sum0 += word[0];
+      sum1 += word[1];
+      sum2 += word[2];
+      sum3 += word[3];
+    }
+    this->value += (sum0 << 24) + (sum1 << 16) + (sum2 << 8) + sum3;
   }
 
   void Checksum ::
@@ -49,6 +49,51 @@ TEST(Checksum, ThreePackets) {
   ASSERT_EQ(expectedValue, checksum.getValue());
 }
 
+//! Compute the checksum one byte at a time
+static U32 byteChecksum(
+    const U8 *const bytes,
+    const U32 offset,
+    const U32 length
+) {
+  U32 value = 0;
+  for (U32 i = 0; i < length; ++i) {
+    value += static_cast<U32>(bytes[i]) << (8*(3-((offset + i) % 4)));
+  }
+  return value;
+}
+
+TEST(Checksum, MatchesBytewise) {
+  U8 bytes[4096 + 8];
+  for (U32 i = 0; i < sizeof(bytes); ++i) {
+    bytes[i] = static_cast<U8>(0xFF - (i * 7));
+  }
+  // Vary the file offset and the memory alignment of the data
+  for (U32 offset = 0; offset < 8; ++offset) {
+    for (U32 start = 0; start < 8; ++start) {
+      for (U32 length = 0; length + start <= sizeof(bytes); length += 61) {
+        Checksum checksum;
+        checksum.update(&bytes[start], offset, length);
+        ASSERT_EQ(byteChecksum(&bytes[start], offset, length), checksum.getValue());
+      }
+    }
+  }
+}
+
+TEST(Checksum, MatchesBytewiseInPieces) {
+  U8 bytes[4096];
+  for (U32 i = 0; i < sizeof(bytes); ++i) {
+    bytes[i] = static_cast<U8>(0xFF - (i * 13));
+  }
+  // Wrapping sums must give the same value as a single pass
+  Checksum checksum;
+  U32 offset = 0;
+  for (U32 length = 1; offset + length <= sizeof(bytes); ++length) {
+    checksum.update(&bytes[offset], offset, length);
+    offset += length;
+  }
+  ASSERT_EQ(byteChecksum(bytes, 0, offset), checksum.getValue());
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
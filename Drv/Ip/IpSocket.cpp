@@ -169,6 +169,76 @@ SocketIpStatus IpSocket::send(const U8* const data, const U32 size) {
     return SOCK_SUCCESS;
 }
 
+SocketIpStatus IpSocket::sendSegments(const U8* const data[], const U32 sizes[], const U32 count) {
+    FW_ASSERT(count <= SOCKET_SEND_MAX_SEGMENTS, count);
+    const U8* segments[SOCKET_SEND_MAX_SEGMENTS];
+    U32 remaining[SOCKET_SEND_MAX_SEGMENTS];
+    U32 size = 0;
+    U32 total = 0;
+    I32 sent  = 0;
+    for (U32 i = 0; i < count; i++) {
+        segments[i] = data[i];
+        remaining[i] = sizes[i];
+        size += sizes[i];
+    }
+    // Prevent transmission before connection, or after a disconnect
+    if (this->m_fd == -1) {
+        return SOCK_DISCONNECTED;
+    }
+    // Attempt to send out data and retry as necessary, resuming from the first unsent byte
+    U32 first = 0;
+    for (U32 i = 0; (i < SOCKET_MAX_ITERATIONS) && (total < size); i++) {
+        for (; remaining[first] == 0; first++) {}
+        // Send using my specific protocol
+        sent = this->sendSegmentsProtocol(&segments[first], &remaining[first], count - first);
+        // Error is EINTR or timeout just try again
+        if (((sent == -1) && (errno == EINTR)) || (sent == 0)) {
+            continue;
+        }
+        // Error bad file descriptor is a close along with reset
+        else if ((sent == -1) && ((errno == EBADF) || (errno == ECONNRESET))) {
+            this->close();
+            return SOCK_DISCONNECTED;
+        }
+        // Error returned, and it wasn't an interrupt nor a disconnect
+        else if (sent == -1) {
+            return SOCK_SEND_ERROR;
+        }
+        FW_ASSERT(sent > 0, sent);
+        total += sent;
+        // Skip past the data sent, which may end part way through a segment
+        for (U32 unsent = static_cast<U32>(sent); unsent > 0; first++) {
+            const U32 step = (unsent < remaining[first]) ? unsent : remaining[first];
+            segments[first] += step;
+            remaining[first] -= step;
+            unsent -= step;
+            if (remaining[first] > 0) {
+                break;
+            }
+        }
+    }
+    // Failed to retry enough to send all data
+    if (total < size) {
+        return SOCK_INTERRUPTED_TRY_AGAIN;
+    }
+    FW_ASSERT(total == size, total, size); // Ensure we sent everything
+    return SOCK_SUCCESS;
+}
+
+I32 IpSocket::sendSegmentsProtocol(const U8* const data[], const U32 sizes[], const U32 count) {
+    FW_ASSERT(count <= SOCKET_SEND_MAX_SEGMENTS, count);
+    struct iovec vectors[SOCKET_SEND_MAX_SEGMENTS];
+    struct msghdr message;
+    ::memset(&message, 0, sizeof(message));
+    for (U32 i = 0; i < count; i++) {
+        vectors[i].iov_base = const_cast<U8*>(data[i]);
+        vectors[i].iov_len = sizes[i];
+    }
+    message.msg_iov = vectors;
+    message.msg_iovlen = count;
+    return ::sendmsg(this->m_fd, &message, SOCKET_IP_SEND_FLAGS);
+}
+
 SocketIpStatus IpSocket::recv(U8* data, I32& req_read) {
     I32 size = 0;
     // Check for previously disconnected socket
@@ -204,4 +274,68 @@ SocketIpStatus IpSocket::recv(U8* data, I32& req_read) {
     return SOCK_SUCCESS;
 }
 
+SocketIpStatus IpSocket::recvBatch(U8* const data[], I32 sizes[], const U32 count, U32& received) {
+    I32 filled = 0;
+    received = 0;
+    FW_ASSERT(data != nullptr);
+    FW_ASSERT(sizes != nullptr);
+    FW_ASSERT((count > 0) && (count <= this->getRecvBatchSize()), count, this->getRecvBatchSize());
+    // Check for previously disconnected socket
+    if (m_fd == -1) {
+        return SOCK_DISCONNECTED;
+    }
+
+    // Try to read until we fail to receive data
+    for (U32 i = 0; (i < SOCKET_MAX_ITERATIONS) && (filled <= 0); i++) {
+        // Attempt to recv out data
+        filled = this->recvBatchProtocol(data, sizes, count);
+        // Error is EINTR, just try again
+        if (filled == -1 && ((errno == EINTR) || errno == EAGAIN)) {
+            continue;
+        }
+        // Zero messages read reset or bad ef means we've disconnected
+        else if (filled == 0 || ((filled == -1) && ((errno == ECONNRESET) || (errno == EBADF)))) {
+            this->close();
+            return SOCK_DISCONNECTED;
+        }
+        // Error returned, and it wasn't an interrupt, nor a disconnect
+        else if (filled == -1) {
+            return SOCK_READ_ERROR;  // Stop recv task on error
+        }
+    }
+    // Prevent interrupted socket being viewed as success
+    if (filled == -1) {
+        return SOCK_INTERRUPTED_TRY_AGAIN;
+    }
+    FW_ASSERT(static_cast<U32>(filled) <= count, filled, count);
+    received = static_cast<U32>(filled);
+    return SOCK_SUCCESS;
+}
+
+U32 IpSocket::getRecvBatchSize() const {
+    return 1;
+}
+
+NATIVE_INT_TYPE IpSocket::getConnectionFd() {
+    NATIVE_INT_TYPE fd = -1;
+    m_lock.lock();
+    fd = m_fd;
+    m_lock.unLock();
+    return fd;
+}
+
+NATIVE_INT_TYPE IpSocket::getListenFd() {
+    return -1;
+}
+
+I32 IpSocket::recvBatchProtocol(U8* const data[], I32 sizes[], const U32 count) {
+    FW_ASSERT(count > 0);
+    I32 size = this->recvProtocol(data[0], sizes[0]);
+    if (size <= 0) {
+        return size;
+    }
+    sizes[0] = size;
+    return 1;
+}
+
 }  // namespace Drv
@@ -111,6 +111,20 @@ class IpSocket {
      * \return status of the send, SOCK_DISCONNECTED to reopen, SOCK_SUCCESS on success, something else on error
      */
     SocketIpStatus send(const U8* const data, const U32 size);
+    /**
+     * \brief send data held in several buffers out the IP socket as though it were one buffer
+     *
+     * Sends the segments back to back with a single system call where possible, avoiding a copy into one buffer. Udp
+     * sends the segments as a single datagram. Retries, errors and disconnects are handled as in `send`.
+     *
+     * Note: delegates to `sendSegmentsProtocol` to send the data
+     *
+     * \param data: pointer to each segment of data to send
+     * \param sizes: size of each segment. Segments may be empty
+     * \param count: number of segments. Must not exceed SOCKET_SEND_MAX_SEGMENTS
+     * \return status of the send, SOCK_DISCONNECTED to reopen, SOCK_SUCCESS on success, something else on error
+     */
+    SocketIpStatus sendSegments(const U8* const data[], const U32 sizes[], const U32 count);
     /**
      * \brief receive data from the IP socket from the given buffer
      *
@@ -127,6 +141,41 @@ class IpSocket {
      * \return status of the send, SOCK_DISCONNECTED to reopen, SOCK_SUCCESS on success, something else on error
      */
     SocketIpStatus recv(U8* const data, I32& size);
+    /**
+     * \brief receive several messages from the IP socket into the given buffers
+     *
+     * Receives data from the IpSocket into up to count buffers, blocking until at least one is filled and then taking
+     * whatever else is already waiting. Sockets that cannot take more than one message per call fill only the first
+     * buffer. Errors, disconnects and retries are handled as in `recv`.
+     *
+     * Note: delegates to `recvBatchProtocol` to receive the data
+     *
+     * \param data: buffers to fill with received data
+     * \param sizes: maximum size of each buffer. Set to the size received for each filled buffer
+     * \param count: number of buffers. Must not exceed `getRecvBatchSize`
+     * \param received: (output) number of buffers filled. Only non-zero on SOCK_SUCCESS
+     * \return status of the receive, SOCK_DISCONNECTED to reopen, SOCK_SUCCESS on success, something else on error
+     */
+    SocketIpStatus recvBatch(U8* const data[], I32 sizes[], const U32 count, U32& received);
+    /**
+     * \brief maximum number of buffers a single `recvBatch` call can fill
+     * \return batch size, 1 unless the protocol can take several messages per call
+     */
+    virtual U32 getRecvBatchSize() const;
+    /**
+     * \brief file descriptor of the open connection, used to wait for incoming data
+     * \return file descriptor, -1 when the socket is closed
+     */
+    NATIVE_INT_TYPE getConnectionFd();
+    /**
+     * \brief file descriptor that becomes readable once `open` can complete without blocking
+     *
+     * Used by Drv::SocketReactor to accept incoming clients as they arrive. Sockets without such a descriptor are
+     * reopened every SOCKET_RETRY_INTERVAL_MS instead.
+     *
+     * \return file descriptor, -1 when there is none (default)
+     */
+    virtual NATIVE_INT_TYPE getListenFd();
     /**
      * \brief closes the socket
      *
@@ -164,6 +213,17 @@ class IpSocket {
      * \return: size of data sent, or -1 on error.
      */
     virtual I32 sendProtocol(const U8* const data, const U32 size) = 0;
+    /**
+     * \brief Protocol specific implementation of segmented send. Called directly with retry from sendSegments.
+     *
+     * The default implementation sends the segments on the connected socket using sendmsg.
+     *
+     * \param data: pointer to each segment of data to send
+     * \param sizes: size of each segment
+     * \param count: number of segments
+     * \return: size of data sent, or -1 on error.
+     */
+    virtual I32 sendSegmentsProtocol(const U8* const data[], const U32 sizes[], const U32 count);
 
     /**
      * \brief Protocol specific implementation of recv.  Called directly with error handling from recv.
@@ -173,6 +233,18 @@ class IpSocket {
      */
     virtual I32 recvProtocol( U8* const data, const U32 size) = 0;
 
+    /**
+     * \brief Protocol specific implementation of batched recv. Called directly with error handling from recvBatch.
+     *
+     * The default implementation fills the first buffer using `recvProtocol`.
+     *
+     * \param data: data pointers to fill
+     * \param sizes: size of each data buffer, set to the size received for each filled buffer
+     * \param count: number of buffers
+     * \return: number of buffers filled, 0 on an orderly shutdown, or -1 on error.
+     */
+    virtual I32 recvBatchProtocol(U8* const data[], I32 sizes[], const U32 count);
+
     Os::Mutex m_lock;
     NATIVE_INT_TYPE m_fd;
     U32 m_timeoutSeconds;
@@ -0,0 +1,347 @@
+// ======================================================================
+// \title  SocketReactor.cpp
+// \brief  cpp file for SocketReactor implementation class
+//
+// \copyright
+// Copyright 2009-2020, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+#include <Drv/Ip/SocketReactor.hpp>
+#include <Fw/Logger/Logger.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <cerrno>
+
+#if defined TGT_OS_TYPE_LINUX
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <time.h>
+#endif
+
+namespace Drv {
+
+#if defined TGT_OS_TYPE_LINUX
+
+//!< Slot number reported by the wait set for the wake event file descriptor
+static const U32 WAKE_SLOT = SOCKET_REACTOR_MAX_SOCKETS;
+
+//!< Current monotonic time in milliseconds
+static U64 getTimeMs() {
+    struct timespec now;
+    (void)::clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<U64>(now.tv_sec) * 1000 + static_cast<U64>(now.tv_nsec) / 1000000;
+}
+
+SocketReactor::SocketReactor() : m_epollFd(-1), m_wakeFd(-1), m_rebuild(true), m_stop(false) {
+    for (U32 i = 0; i < SOCKET_REACTOR_MAX_SOCKETS; i++) {
+        this->m_sockets[i] = nullptr;
+        this->m_serviced[i] = nullptr;
+        this->m_waitFds[i] = -1;
+        this->m_nextOpen[i] = 0;
+    }
+}
+
+SocketReactor::~SocketReactor() {}
+
+void SocketReactor::start(const Fw::StringBase& name,
+                          const NATIVE_INT_TYPE priority,
+                          const NATIVE_INT_TYPE stack,
+                          const NATIVE_INT_TYPE cpuAffinity) {
+    FW_ASSERT(not this->m_task.isStarted());  // It is a coding error to start this task multiple times
+    FW_ASSERT(not this->m_stop);              // It is a coding error to stop the task before it is started
+    this->m_lock.lock();
+    this->m_wakeFd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    this->m_lock.unLock();
+    FW_ASSERT(this->m_wakeFd != -1, errno);
+    Os::Task::TaskStatus stat = this->m_task.start(name, SocketReactor::reactorTask, this, priority, stack, cpuAffinity);
+    FW_ASSERT(Os::Task::TASK_OK == stat, static_cast<NATIVE_INT_TYPE>(stat));
+}
+
+void SocketReactor::stop() {
+    this->m_lock.lock();
+    this->m_stop = true;
+    this->m_lock.unLock();
+    this->wake();
+}
+
+Os::Task::TaskStatus SocketReactor::join(void** value_ptr) {
+    return this->m_task.join(value_ptr);
+}
+
+void SocketReactor::add(SocketReadTask& socket) {
+    this->m_lock.lock();
+    U32 slot = 0;
+    for (; (slot < SOCKET_REACTOR_MAX_SOCKETS) && (this->m_sockets[slot] != nullptr); slot++) {
+        FW_ASSERT(this->m_sockets[slot] != &socket, slot);  // It is a coding error to add a socket twice
+    }
+    FW_ASSERT(slot < SOCKET_REACTOR_MAX_SOCKETS, slot);
+    // Signaled when the socket is dropped, so joinSocketTask need not poll
+    socket.m_droppedFd = ::eventfd(0, EFD_CLOEXEC);
+    FW_ASSERT(socket.m_droppedFd != -1, errno);
+    this->m_sockets[slot] = &socket;
+    this->m_lock.unLock();
+    this->wake();
+}
+
+bool SocketReactor::isAdded(SocketReadTask& socket) {
+    bool added = false;
+    this->m_lock.lock();
+    for (U32 slot = 0; slot < SOCKET_REACTOR_MAX_SOCKETS; slot++) {
+        added = added || (this->m_sockets[slot] == &socket);
+    }
+    this->m_lock.unLock();
+    return added;
+}
+
+void SocketReactor::waitDropped(SocketReadTask& socket) {
+    // Already joined
+    if (socket.m_droppedFd == -1) {
+        return;
+    }
+    U64 count = 0;
+    ssize_t got = 0;
+    do {
+        got = ::read(socket.m_droppedFd, &count, sizeof(count));
+    } while ((got < 0) && (errno == EINTR));
+    FW_ASSERT(got == sizeof(count), errno);
+    (void)::close(socket.m_droppedFd);
+    socket.m_droppedFd = -1;
+}
+
+void SocketReactor::wake() {
+    const U64 count = 1;
+    this->m_lock.lock();
+    if (this->m_wakeFd != -1) {
+        // Only fails when the count would overflow, in which case the task is already woken
+        ssize_t written = ::write(this->m_wakeFd, &count, sizeof(count));
+        (void)written;
+    }
+    this->m_lock.unLock();
+}
+
+void SocketReactor::reactorTask(void* pointer) {
+    FW_ASSERT(pointer);
+    SocketReactor* self = reinterpret_cast<SocketReactor*>(pointer);
+    struct epoll_event events[SOCKET_REACTOR_MAX_SOCKETS + 1];
+    while (self->update()) {
+        const int ready = ::epoll_wait(self->m_epollFd, events, SOCKET_REACTOR_MAX_SOCKETS + 1, self->getTimeout());
+        // Interrupted waits are simply retried
+        FW_ASSERT((ready >= 0) || (errno == EINTR), errno);
+        for (int i = 0; i < ready; i++) {
+            const U32 slot = events[i].data.u32;
+            if (slot == WAKE_SLOT) {
+                U64 count = 0;
+                ssize_t wakes = ::read(self->m_wakeFd, &count, sizeof(count));
+                (void)wakes;
+            } else {
+                self->service(slot);
+            }
+        }
+        // Reopen closed sockets that have nothing to wait on
+        const U64 now = getTimeMs();
+        for (U32 slot = 0; slot < SOCKET_REACTOR_MAX_SOCKETS; slot++) {
+            SocketReadTask* socket = self->m_serviced[slot];
+            if ((socket != nullptr) and (not socket->m_stop) and (not socket->getSocketHandler().isOpened()) and
+                (socket->getSocketHandler().getListenFd() == -1) and (self->m_nextOpen[slot] <= now)) {
+                self->service(slot);
+            }
+        }
+    }
+    for (U32 slot = 0; slot < SOCKET_REACTOR_MAX_SOCKETS; slot++) {
+        if (self->m_serviced[slot] != nullptr) {
+            self->drop(slot);
+        }
+    }
+    self->m_lock.lock();
+    (void)::close(self->m_wakeFd);
+    self->m_wakeFd = -1;
+    self->m_lock.unLock();
+    (void)::close(self->m_epollFd);
+    self->m_epollFd = -1;
+}
+
+bool SocketReactor::update() {
+    // Drop stopped sockets, as their read task would exit
+    for (U32 slot = 0; slot < SOCKET_REACTOR_MAX_SOCKETS; slot++) {
+        if ((this->m_serviced[slot] != nullptr) and this->m_serviced[slot]->m_stop) {
+            this->drop(slot);
+        }
+    }
+    this->m_lock.lock();
+    const bool stop = this->m_stop;
+    for (U32 slot = 0; slot < SOCKET_REACTOR_MAX_SOCKETS; slot++) {
+        if (this->m_serviced[slot] != this->m_sockets[slot]) {
+            this->m_serviced[slot] = this->m_sockets[slot];
+            this->m_nextOpen[slot] = 0;
+        }
+    }
+    this->m_lock.unLock();
+    if (stop) {
+        return false;
+    }
+
+    // Open sockets wait on their connection, closed ones on their listening socket. A listening socket shared by
+    // several closed sockets is waited on once, for the first of them.
+    NATIVE_INT_TYPE fds[SOCKET_REACTOR_MAX_SOCKETS];
+    for (U32 slot = 0; slot < SOCKET_REACTOR_MAX_SOCKETS; slot++) {
+        SocketReadTask* socket = this->m_serviced[slot];
+        fds[slot] = -1;
+        if ((socket != nullptr) and (not socket->m_stop)) {
+            IpSocket& handler = socket->getSocketHandler();
+            fds[slot] = handler.isOpened() ? handler.getConnectionFd() : handler.getListenFd();
+            for (U32 j = 0; (j < slot) && (fds[slot] != -1); j++) {
+                fds[slot] = (fds[j] == fds[slot]) ? -1 : fds[slot];
+            }
+        }
+        this->m_rebuild = this->m_rebuild || (fds[slot] != this->m_waitFds[slot]);
+    }
+    if (not this->m_rebuild) {
+        return true;
+    }
+
+    // Sockets change rarely, and a fresh wait set avoids tracking descriptors closed and reused by other tasks
+    this->m_rebuild = false;
+    if (this->m_epollFd != -1) {
+        (void)::close(this->m_epollFd);
+    }
+    this->m_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    FW_ASSERT(this->m_epollFd != -1, errno);
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u32 = WAKE_SLOT;
+    NATIVE_INT_TYPE status = ::epoll_ctl(this->m_epollFd, EPOLL_CTL_ADD, this->m_wakeFd, &event);
+    FW_ASSERT(status == 0, errno);
+    for (U32 slot = 0; slot < SOCKET_REACTOR_MAX_SOCKETS; slot++) {
+        this->m_waitFds[slot] = fds[slot];
+        if (fds[slot] == -1) {
+            continue;
+        }
+        // Accepts happen only once a client is waiting, and must not block should another take it first
+        if (not this->m_serviced[slot]->getSocketHandler().isOpened()) {
+            (void)::fcntl(fds[slot], F_SETFL, ::fcntl(fds[slot], F_GETFL) | O_NONBLOCK);
+        }
+        event.events = EPOLLIN;
+        event.data.u32 = slot;
+        // A socket closed by another task since it was checked is picked up on the next update
+        if (::epoll_ctl(this->m_epollFd, EPOLL_CTL_ADD, fds[slot], &event) != 0) {
+            this->m_waitFds[slot] = -1;
+        }
+    }
+    return true;
+}
+
+void SocketReactor::service(const U32 slot) {
+    FW_ASSERT(slot < SOCKET_REACTOR_MAX_SOCKETS, slot);
+    SocketReadTask* socket = this->m_serviced[slot];
+    if ((socket == nullptr) or socket->m_stop) {
+        return;
+    }
+    SocketIpStatus status = SOCK_SUCCESS;
+    if (socket->getSocketHandler().isOpened()) {
+        status = socket->readOnce();
+        // A closed socket waits on its listening socket from now on
+        this->m_rebuild = this->m_rebuild || (status != SOCK_SUCCESS);
+    } else {
+        status = this->open(slot);
+    }
+    // As with the read task, stop reading on errors unless ordered to reconnect
+    if ((status != SOCK_SUCCESS) and (status != SOCK_INTERRUPTED_TRY_AGAIN) and (not socket->m_reconnect)) {
+        this->drop(slot);
+    }
+}
+
+SocketIpStatus SocketReactor::open(const U32 slot) {
+    SocketReadTask* socket = this->m_serviced[slot];
+    SocketIpStatus status = socket->open();
+    if (status == SOCK_SUCCESS) {
+        // The connection may reuse the number of a descriptor already in the wait set
+        this->m_rebuild = true;
+    } else {
+        Fw::Logger::logMsg("[WARNING] Failed to open port with status %d and errno %d\n", status, errno);
+        this->m_nextOpen[slot] = getTimeMs() + SOCKET_RETRY_INTERVAL_MS;
+    }
+    return status;
+}
+
+void SocketReactor::drop(const U32 slot) {
+    SocketReadTask* socket = this->m_serviced[slot];
+    FW_ASSERT(socket != nullptr, slot);
+    socket->getSocketHandler().close();
+    this->m_serviced[slot] = nullptr;
+    this->m_rebuild = true;
+    this->m_lock.lock();
+    this->m_sockets[slot] = nullptr;
+    // Release the joiner
+    const U64 count = 1;
+    ssize_t written = ::write(socket->m_droppedFd, &count, sizeof(count));
+    FW_ASSERT(written == sizeof(count), errno);
+    this->m_lock.unLock();
+}
+
+I32 SocketReactor::getTimeout() {
+    const U64 now = getTimeMs();
+    I32 timeout = -1;
+    for (U32 slot = 0; slot < SOCKET_REACTOR_MAX_SOCKETS; slot++) {
+        SocketReadTask* socket = this->m_serviced[slot];
+        if ((socket != nullptr) and (not socket->m_stop) and (not socket->getSocketHandler().isOpened()) and
+            (socket->getSocketHandler().getListenFd() == -1)) {
+            const I32 wait = (this->m_nextOpen[slot] > now) ? static_cast<I32>(this->m_nextOpen[slot] - now) : 0;
+            timeout = ((timeout == -1) || (wait < timeout)) ? wait : timeout;
+        }
+    }
+    // Descriptors that failed to join the wait set are retried shortly
+    for (U32 slot = 0; slot < SOCKET_REACTOR_MAX_SOCKETS; slot++) {
+        if ((this->m_serviced[slot] != nullptr) and (this->m_waitFds[slot] == -1) and
+            this->m_serviced[slot]->getSocketHandler().isOpened()) {
+            timeout = ((timeout == -1) || (SOCKET_REACTOR_JOIN_INTERVAL_MS < timeout)) ?
+                SOCKET_REACTOR_JOIN_INTERVAL_MS : timeout;
+        }
+    }
+    return timeout;
+}
+
+#else
+
+SocketReactor::SocketReactor() : m_epollFd(-1), m_wakeFd(-1), m_rebuild(true), m_stop(false) {}
+
+SocketReactor::~SocketReactor() {}
+
+void SocketReactor::start(const Fw::StringBase& name,
+                          const NATIVE_INT_TYPE priority,
+                          const NATIVE_INT_TYPE stack,
+                          const NATIVE_INT_TYPE cpuAffinity) {
+    (void)name;
+    (void)priority;
+    (void)stack;
+    (void)cpuAffinity;
+    FW_ASSERT(0);  // Socket reactor requires epoll, use SocketReadTask::startSocketTask instead
+}
+
+void SocketReactor::stop() {}
+
+Os::Task::TaskStatus SocketReactor::join(void** value_ptr) {
+    (void)value_ptr;
+    return Os::Task::TASK_OK;
+}
+
+void SocketReactor::add(SocketReadTask& socket) {
+    (void)socket;
+    FW_ASSERT(0);  // Socket reactor requires epoll, use SocketReadTask::startSocketTask instead
+}
+
+bool SocketReactor::isAdded(SocketReadTask& socket) {
+    (void)socket;
+    return false;
+}
+
+void SocketReactor::waitDropped(SocketReadTask& socket) {
+    (void)socket;
+}
+
+void SocketReactor::wake() {}
+
+#endif
+}  // namespace Drv
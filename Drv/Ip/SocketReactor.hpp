@@ -0,0 +1,150 @@
+// ======================================================================
+// \title  SocketReactor.hpp
+// \brief  hpp file for SocketReactor implementation class
+//
+// \copyright
+// Copyright 2009-2020, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+#ifndef DRV_SOCKETREACTOR_HPP
+#define DRV_SOCKETREACTOR_HPP
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Drv/Ip/SocketReadTask.hpp>
+#include <Os/Mutex.hpp>
+#include <Os/Task.hpp>
+#include <IpCfg.hpp>
+
+namespace Drv {
+/**
+ * \brief reads many sockets from a single task
+ *
+ * Waits on the sockets of several Drv::SocketReadTask inheritors at once using epoll and, on the one task, reads each
+ * socket as data arrives, accepts clients of server sockets as they connect, and reopens closed sockets. Each socket
+ * is serviced exactly as its own read task would, so the inheritor sees the same getBuffer, sendBuffer and connected
+ * calls. Sockets are handed to the reactor with Drv::SocketReadTask::startSocketReactor.
+ *
+ * Sockets whose IpSocket::getListenFd is -1 (tcp clients, udp) are reopened every SOCKET_RETRY_INTERVAL_MS while
+ * closed. These opens run on the reactor task, so a blocking connect holds up the other sockets for its duration.
+ *
+ * Note: available on Linux only.
+ */
+class SocketReactor {
+  public:
+    /**
+     * \brief constructs the socket reactor
+     */
+    SocketReactor();
+
+    /**
+     * \brief destructor of the socket reactor
+     */
+    ~SocketReactor();
+
+    /**
+     * \brief start the reactor task to start reading the added sockets
+     *
+     * \param name: name of the task
+     * \param priority: priority of the started task. See: Os::Task::start. Default: -1, not prioritized
+     * \param stack: stack size provided to the task. See: Os::Task::start. Default: -1, posix threads default
+     * \param cpuAffinity: cpu affinity provided to task. See: Os::Task::start. Default: -1, don't care
+     */
+    void start(const Fw::StringBase& name,
+               const NATIVE_INT_TYPE priority = -1,
+               const NATIVE_INT_TYPE stack = -1,
+               const NATIVE_INT_TYPE cpuAffinity = -1);
+
+    /**
+     * \brief stop the reactor task, closing all sockets it reads
+     */
+    void stop();
+
+    /**
+     * \brief joins to the stopping reactor task to wait for it to close
+     * \param value_ptr: a pointer to fill with data. Passed to the Os::Task::join call. NULL to ignore.
+     * \return: Os::Task::TaskStatus passed back from the Os::Task::join call.
+     */
+    Os::Task::TaskStatus join(void** value_ptr);
+
+    /**
+     * \brief add a socket to be read by this reactor
+     *
+     * Called by Drv::SocketReadTask::startSocketReactor. It is an error to add more than SOCKET_REACTOR_MAX_SOCKETS.
+     * \param socket: socket read task to service
+     */
+    void add(SocketReadTask& socket);
+
+    /**
+     * \brief check if a socket is still read by this reactor
+     * \param socket: socket read task to check
+     * \return true until the reactor has dropped the socket
+     */
+    bool isAdded(SocketReadTask& socket);
+
+    /**
+     * \brief wait until the reactor has dropped a socket
+     *
+     * Called by Drv::SocketReadTask::joinSocketTask. Blocks until the reactor task drops the socket, either because the
+     * socket was stopped or because the reactor was.
+     * \param socket: socket read task to wait on
+     */
+    void waitDropped(SocketReadTask& socket);
+
+    /**
+     * \brief wake the reactor task to pick up added and stopped sockets
+     */
+    void wake();
+
+  PRIVATE:
+    /**
+     * \brief task servicing the sockets
+     * \param pointer: pointer to "this" reactor
+     */
+    static void reactorTask(void* pointer);
+
+    /**
+     * \brief picks up added sockets, drops stopped ones and rebuilds the wait set when the sockets changed
+     * \return false once the reactor has been stopped
+     */
+    bool update();
+
+    /**
+     * \brief reads or opens the socket in a slot once its file descriptor is ready
+     * \param slot: slot of the socket
+     */
+    void service(const U32 slot);
+
+    /**
+     * \brief opens the socket in a slot
+     * \param slot: slot of the socket
+     * \return status of open
+     */
+    SocketIpStatus open(const U32 slot);
+
+    /**
+     * \brief closes the socket in a slot and hands back its buffers
+     * \param slot: slot of the socket
+     */
+    void drop(const U32 slot);
+
+    /**
+     * \brief milliseconds to wait before the next socket needs reopening
+     * \return wait in milliseconds, -1 to wait for file descriptors only
+     */
+    I32 getTimeout();
+
+    Os::Task m_task;
+    Os::Mutex m_lock; //!< Guards m_sockets, m_stop and m_wakeFd
+    SocketReadTask* m_sockets[SOCKET_REACTOR_MAX_SOCKETS]; //!< Sockets added, nullptr for free slots
+    SocketReadTask* m_serviced[SOCKET_REACTOR_MAX_SOCKETS]; //!< Sockets the reactor task is servicing
+    NATIVE_INT_TYPE m_waitFds[SOCKET_REACTOR_MAX_SOCKETS]; //!< File descriptor in the wait set for each slot
+    U64 m_nextOpen[SOCKET_REACTOR_MAX_SOCKETS]; //!< Time in milliseconds to next try opening each closed socket
+    NATIVE_INT_TYPE m_epollFd; //!< Wait set
+    NATIVE_INT_TYPE m_wakeFd; //!< Event file descriptor used to wake the task
+    bool m_rebuild; //!< Rebuild the wait set on the next update
+    bool m_stop; //!< Stops the task when set to true
+};
+}  // namespace Drv
+#endif  // DRV_SOCKETREACTOR_HPP
@@ -11,6 +11,7 @@
 // ======================================================================
 
 #include <Drv/Ip/SocketReadTask.hpp>
+#include <Drv/Ip/SocketReactor.hpp>
 #include <Fw/Logger/Logger.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <cerrno>
@@ -19,7 +20,7 @@
 
 namespace Drv {
 
-SocketReadTask::SocketReadTask() : m_stop(false) {}
+SocketReadTask::SocketReadTask() : m_stop(false), m_reactor(nullptr), m_droppedFd(-1) {}
 
 SocketReadTask::~SocketReadTask() {}
 
@@ -30,12 +31,22 @@ void SocketReadTask::startSocketTask(const Fw::StringBase &name,
                                      const NATIVE_INT_TYPE cpuAffinity) {
     FW_ASSERT(not m_task.isStarted());  // It is a coding error to start this task multiple times
     FW_ASSERT(not this->m_stop);        // It is a coding error to stop the thread before it is started
+    FW_ASSERT(this->m_reactor == nullptr); // It is a coding error to also read this socket with a reactor
     m_reconnect = reconnect;
     // Note: the first step is for the IP socket to open the port
     Os::Task::TaskStatus stat = m_task.start(name, SocketReadTask::readTask, this, priority, stack, cpuAffinity);
     FW_ASSERT(Os::Task::TASK_OK == stat, static_cast<NATIVE_INT_TYPE>(stat));
 }
 
+void SocketReadTask::startSocketReactor(SocketReactor& reactor, const bool reconnect) {
+    FW_ASSERT(not m_task.isStarted());  // It is a coding error to also read this socket with a task
+    FW_ASSERT(this->m_reactor == nullptr); // It is a coding error to register with a reactor multiple times
+    FW_ASSERT(not this->m_stop);        // It is a coding error to stop the thread before it is started
+    m_reconnect = reconnect;
+    m_reactor = &reactor;
+    reactor.add(*this);
+}
+
 SocketIpStatus SocketReadTask::open() {
     SocketIpStatus status = this->getSocketHandler().open();
     // Call connected any time the open is successful
@@ -50,12 +61,19 @@ void SocketReadTask::close() {
 }
 
 Os::Task::TaskStatus SocketReadTask::joinSocketTask(void** value_ptr) {
+    if (this->m_reactor != nullptr) {
+        this->m_reactor->waitDropped(*this);
+        return Os::Task::TASK_OK;
+    }
     return m_task.join(value_ptr);
 }
 
 void SocketReadTask::stopSocketTask() {
     this->m_stop = true;
     this->getSocketHandler().close();  // Break out of any receives
+    if (this->m_reactor != nullptr) {
+        this->m_reactor->wake();
+    }
 }
 
 void SocketReadTask::readTask(void* pointer) {
@@ -72,21 +90,7 @@ void SocketReadTask::readTask(void* pointer) {
 
         // If the network connection is open, read from it
         if (self->getSocketHandler().isOpened() and (not self->m_stop)) {
-            Fw::Buffer buffer = self->getBuffer();
-            U8* data = buffer.getData();
-            FW_ASSERT(data);
-            I32 size = static_cast<I32>(buffer.getSize());
-            size = (size >= 0) ? size : MAXIMUM_SIZE; // Handle max U32 edge case
-            status = self->getSocketHandler().recv(data, size);
-            if ((status != SOCK_SUCCESS) && (status != SOCK_INTERRUPTED_TRY_AGAIN)) {
-                Fw::Logger::logMsg("[WARNING] Failed to recv from port with status %d and errno %d\n", status, errno);
-                self->getSocketHandler().close();
-                buffer.setSize(0);
-            } else {
-                // Send out received data
-                buffer.setSize(size);
-            }
-            self->sendBuffer(buffer, status);
+            status = self->readOnce();
         }
     }
     // As long as not told to stop, and we are successful interrupted or ordered to retry, keep receiving
@@ -94,4 +98,52 @@ void SocketReadTask::readTask(void* pointer) {
            (status == SOCK_SUCCESS || status == SOCK_INTERRUPTED_TRY_AGAIN || self->m_reconnect));
     self->getSocketHandler().close(); // Close the handler again, in case it reconnected
 }
+
+SocketIpStatus SocketReadTask::readOnce() {
+    const U32 count = this->getSocketHandler().getRecvBatchSize();
+    FW_ASSERT((count > 0) && (count <= static_cast<U32>(SOCKET_RECV_BATCH_SIZE)), count);
+    Fw::Buffer buffers[SOCKET_RECV_BATCH_SIZE];
+    U8* data[SOCKET_RECV_BATCH_SIZE];
+    I32 sizes[SOCKET_RECV_BATCH_SIZE];
+    // Read into as many buffers as can be gotten, up to the batch size. The first is required, as for a single read.
+    U32 obtained = 0;
+    for (; obtained < count; obtained++) {
+        buffers[obtained] = this->getBuffer();
+        data[obtained] = buffers[obtained].getData();
+        if (data[obtained] == nullptr) {
+            break;
+        }
+        sizes[obtained] = static_cast<I32>(buffers[obtained].getSize());
+        sizes[obtained] = (sizes[obtained] >= 0) ? sizes[obtained] : MAXIMUM_SIZE; // Handle max U32 edge case
+    }
+    FW_ASSERT(obtained > 0);
+    U32 received = 0;
+    SocketIpStatus status = this->getSocketHandler().recvBatch(data, sizes, obtained, received);
+    if ((status != SOCK_SUCCESS) && (status != SOCK_INTERRUPTED_TRY_AGAIN)) {
+        Fw::Logger::logMsg("[WARNING] Failed to recv from port with status %d and errno %d\n", status, errno);
+        this->getSocketHandler().close();
+    }
+    if (status == SOCK_SUCCESS) {
+        // Send out received data
+        for (U32 i = 0; i < received; i++) {
+            buffers[i].setSize(sizes[i]);
+            this->sendBuffer(buffers[i], status);
+        }
+    } else {
+        // Report the failure with the first buffer, as an unbatched read would
+        received = 1;
+        buffers[0].setSize(0);
+        this->sendBuffer(buffers[0], status);
+    }
+    // Give back the buffers left unfilled rather than holding them until the next read
+    for (U32 i = received; i < obtained; i++) {
+        this->returnBuffer(buffers[i]);
+    }
+    return status;
+}
+
+void SocketReadTask::returnBuffer(Fw::Buffer buffer) {
+    buffer.setSize(0);
+    this->sendBuffer(buffer, SOCK_DISCONNECTED);
+}
 };  // namespace Drv
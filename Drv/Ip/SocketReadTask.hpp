@@ -15,14 +15,24 @@
 #include <Fw/Buffer/Buffer.hpp>
 #include <Drv/Ip/IpSocket.hpp>
 #include <Os/Task.hpp>
+#include <IpCfg.hpp>
 
 namespace Drv {
+class SocketReactor;
+
 /**
  * \brief supports a task to read a given socket adaptation
  *
  * Defines an Os::Task task to read a socket and send out the data. This represents the task itself, which is capable of
  * reading the data from the socket, sending the data out, and reopening the connection should a non-retry error occur.
  *
+ * Sockets that can receive several messages per call (see IpSocket::getRecvBatchSize) are given up to that many buffers
+ * on each read, as many as getBuffer can supply, and every message waiting is sent out on one wakeup. Buffers left
+ * unfilled are given back through returnBuffer as soon as the read completes.
+ *
+ * Instead of running its own task, the read may be driven by a Drv::SocketReactor shared with other sockets. See
+ * startSocketReactor.
+ *
  */
 class SocketReadTask {
   public:
@@ -55,6 +65,18 @@ class SocketReadTask {
                          const NATIVE_INT_TYPE stack = -1,
                          const NATIVE_INT_TYPE cpuAffinity = -1);
 
+    /**
+     * \brief hand the socket to a reactor instead of starting a read task
+     *
+     * Registers this socket with a Drv::SocketReactor that opens, reads and reopens it alongside the other sockets it
+     * serves, on the reactor's task. This is an alternative to startSocketTask and the two must not both be called.
+     * stopSocketTask and joinSocketTask work as they do for the read task.
+     *
+     * \param reactor: reactor to read the socket. Need not be started yet
+     * \param reconnect: automatically reconnect socket when closed. Default: true.
+     */
+    void startSocketReactor(SocketReactor& reactor, const bool reconnect = true);
+
     /**
      * \brief open the socket for communications
      *
@@ -81,19 +103,21 @@ class SocketReadTask {
      * \brief stop the socket read task and close the associated socket.
      *
      * Called to stop the socket read task. It is an error to call this before the thread has been started using the
-     * startSocketTask call. This will stop the read task and close the client socket.
+     * startSocketTask call. This will stop the read task and close the client socket. When read by a reactor, the
+     * reactor drops this socket instead. Virtual such that inheritors reading several sockets may stop them all.
      */
-    void stopSocketTask();
+    virtual void stopSocketTask();
 
     /**
      * \brief joins to the stopping read task to wait for it to close
      *
      * Called to join with the read socket task. This will block and return after the task has been stopped with a call
-     * to the stopSocketTask method.
+     * to the stopSocketTask method. When read by a reactor, this waits until the reactor has dropped this socket, and
+     * must be called to release the resources used for that wait. Virtual as for stopSocketTask.
      * \param value_ptr: a pointer to fill with data. Passed to the Os::Task::join call. NULL to ignore.
      * \return: Os::Task::TaskStatus passed back from the Os::Task::join call.
      */
-    Os::Task::TaskStatus joinSocketTask(void** value_ptr);
+    virtual Os::Task::TaskStatus joinSocketTask(void** value_ptr);
 
 
   PROTECTED:
@@ -133,6 +157,17 @@ class SocketReadTask {
      */
     virtual void sendBuffer(Fw::Buffer buffer, SocketIpStatus status) = 0;
 
+    /**
+     * \brief returns a buffer gotten by getBuffer that was not filled
+     *
+     * Called right after a batched read for each buffer left over when fewer datagrams than buffers were received. By
+     * default the buffer is sent empty with SOCK_DISCONNECTED status through sendBuffer. Inheritors that can hand the
+     * buffer straight back to its pool should override this.
+     *
+     * \param buffer: unfilled buffer
+     */
+    virtual void returnBuffer(Fw::Buffer buffer);
+
     /**
      * \brief called when the IPv4 system has been connected
      */
@@ -145,9 +180,22 @@ class SocketReadTask {
      */
     static void readTask(void* pointer);
 
+    /**
+     * \brief reads the open socket once and sends out the data received
+     *
+     * Gets up to the socket's batch size of buffers, stopping early when getBuffer returns one without data. Closes
+     * the socket on errors other than SOCK_INTERRUPTED_TRY_AGAIN.
+     * \return status of the receive
+     */
+    SocketIpStatus readOnce();
+
     Os::Task m_task;
     bool m_reconnect; //!< Force reconnection
     bool m_stop; //!< Stops the task when set to true
+    SocketReactor* m_reactor; //!< Reactor reading this socket, nullptr when read by m_task
+    NATIVE_INT_TYPE m_droppedFd; //!< Signaled by the reactor once it drops this socket, -1 when not on a reactor
+
+    friend class SocketReactor;
 
 };
 };
@@ -11,6 +11,7 @@
 // ======================================================================
 #include <Drv/Ip/TcpServerSocket.hpp>
 #include <Fw/Logger/Logger.hpp>
+#include <Fw/Types/Assert.hpp>
 #include <Fw/Types/BasicTypes.hpp>
 
 
@@ -38,7 +39,7 @@
 
 namespace Drv {
 
-TcpServerSocket::TcpServerSocket() : IpSocket(), m_base_fd(-1) {}
+TcpServerSocket::TcpServerSocket() : IpSocket(), m_base_fd(-1), m_listener(this), m_sharers(0) {}
 
 SocketIpStatus TcpServerSocket::startup() {
     NATIVE_INT_TYPE serverFd = -1;
@@ -69,9 +70,9 @@ SocketIpStatus TcpServerSocket::startup() {
         return SOCK_FAILED_TO_BIND;
     }
     m_base_fd = serverFd;
-    Fw::Logger::logMsg("Listening for single client at %s:%hu\n", reinterpret_cast<POINTER_CAST>(m_hostname), m_port);
-    // TCP requires listening on a the socket. Second argument prevents queueing of anything more than a single client.
-    if (::listen(serverFd, 0) < 0) {
+    Fw::Logger::logMsg("Listening for %u client(s) at %s:%hu\n", m_sharers + 1, reinterpret_cast<POINTER_CAST>(m_hostname), m_port);
+    // TCP requires listening on a the socket. Second argument prevents queueing of more clients than can be served.
+    if (::listen(serverFd, static_cast<int>(m_sharers)) < 0) {
         ::close(serverFd);
         return SOCK_FAILED_TO_LISTEN; // What we have here is a failure to communicate
     }
@@ -85,10 +86,26 @@ void TcpServerSocket::shutdown() {
     this->close();
 }
 
+void TcpServerSocket::shareListener(TcpServerSocket& listener) {
+    FW_ASSERT(this->m_listener == this);  // It is a coding error to share more than one listener
+    this->m_listener = &listener;
+    if (&listener != this) {
+        listener.m_sharers++;
+        // Grow the queue of a listener that has already started
+        if (listener.m_base_fd != -1) {
+            (void)::listen(listener.m_base_fd, static_cast<int>(listener.m_sharers));
+        }
+    }
+}
+
+NATIVE_INT_TYPE TcpServerSocket::getListenFd() {
+    return this->m_listener->m_base_fd;
+}
+
 SocketIpStatus TcpServerSocket::openProtocol(NATIVE_INT_TYPE& fd) {
     NATIVE_INT_TYPE clientFd = -1;
     // TCP requires accepting on a the socket to get the client socket file descriptor.
-    if ((clientFd = ::accept(m_base_fd, nullptr, nullptr)) < 0) {
+    if ((clientFd = ::accept(this->m_listener->m_base_fd, nullptr, nullptr)) < 0) {
         return SOCK_FAILED_TO_ACCEPT; // What we have here is a failure to communicate
     }
     // Setup client send timeouts
@@ -47,6 +47,23 @@ class TcpServerSocket : public IpSocket {
      */
     void shutdown();
 
+    /**
+     * \brief accept clients on the listening socket of another server
+     *
+     * Lets several server sockets each hold one client connected to the same port. The listener's `startup` and
+     * `shutdown` calls govern the port, and this socket's `open` accepts the next client waiting on it. This socket
+     * must be configured, but `startup` is not called on it. The listen queue is sized to hold a client for each socket
+     * sharing it, also when the listener has already started.
+     * \param listener: server socket that owns the listening socket
+     */
+    void shareListener(TcpServerSocket& listener);
+
+    /**
+     * \brief listening socket file descriptor, readable when a client is waiting to be accepted
+     * \return file descriptor, -1 when the server has not been started up
+     */
+    NATIVE_INT_TYPE getListenFd();
+
   PROTECTED:
     /**
      * \brief Tcp specific implementation for opening a client socket connected to this server.
@@ -68,8 +85,10 @@ class TcpServerSocket : public IpSocket {
      * \return: size of data received, or -1 on error.
      */
     I32 recvProtocol( U8* const data, const U32 size);
-  private:
+  PRIVATE:
     NATIVE_INT_TYPE m_base_fd; //!< File descriptor of the listening socket
+    TcpServerSocket* m_listener; //!< Server socket whose listening socket clients are accepted from
+    U32 m_sharers; //!< Number of other server sockets accepting clients from this one's listening socket
 };
 }  // namespace Drv
 
@@ -159,9 +159,62 @@ I32 UdpSocket::sendProtocol(const U8* const data, const U32 size) {
                     reinterpret_cast<struct sockaddr *>(&this->m_state->m_addr_send), sizeof(this->m_state->m_addr_send));
 }
 
+I32 UdpSocket::sendSegmentsProtocol(const U8* const data[], const U32 sizes[], const U32 count) {
+    FW_ASSERT(this->m_state->m_addr_send.sin_family != 0); // Make sure the address was previously setup
+    FW_ASSERT(count <= SOCKET_SEND_MAX_SEGMENTS, count);
+    struct iovec vectors[SOCKET_SEND_MAX_SEGMENTS];
+    struct msghdr message;
+    ::memset(&message, 0, sizeof(message));
+    for (U32 i = 0; i < count; i++) {
+        vectors[i].iov_base = const_cast<U8*>(data[i]);
+        vectors[i].iov_len = sizes[i];
+    }
+    message.msg_name = &this->m_state->m_addr_send;
+    message.msg_namelen = sizeof(this->m_state->m_addr_send);
+    message.msg_iov = vectors;
+    message.msg_iovlen = count;
+    return ::sendmsg(this->m_fd, &message, SOCKET_IP_SEND_FLAGS);
+}
+
 I32 UdpSocket::recvProtocol(U8* const data, const U32 size) {
     FW_ASSERT(this->m_state->m_addr_recv.sin_family != 0); // Make sure the address was previously setup
     return ::recvfrom(this->m_fd, data, size, SOCKET_IP_RECV_FLAGS, nullptr, nullptr);
 }
 
+U32 UdpSocket::getRecvBatchSize() const {
+#if defined TGT_OS_TYPE_LINUX
+    return SOCKET_RECV_BATCH_SIZE;
+#else
+    return 1;
+#endif
+}
+
+I32 UdpSocket::recvBatchProtocol(U8* const data[], I32 sizes[], const U32 count) {
+#if defined TGT_OS_TYPE_LINUX
+    FW_ASSERT(this->m_state->m_addr_recv.sin_family != 0); // Make sure the address was previously setup
+    FW_ASSERT(count <= SOCKET_RECV_BATCH_SIZE, count);
+    struct mmsghdr messages[SOCKET_RECV_BATCH_SIZE];
+    struct iovec vectors[SOCKET_RECV_BATCH_SIZE];
+    ::memset(messages, 0, sizeof(messages));
+    for (U32 i = 0; i < count; i++) {
+        vectors[i].iov_base = data[i];
+        vectors[i].iov_len = static_cast<size_t>(sizes[i]);
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+    // Block for the first datagram only, then take those already waiting
+    I32 received = ::recvmmsg(this->m_fd, messages, count, SOCKET_IP_RECV_FLAGS | MSG_WAITFORONE, nullptr);
+    // An empty first read marks a shutdown socket, as it does for recvProtocol. Empty datagrams after it are kept.
+    if ((received > 0) && (messages[0].msg_len == 0)) {
+        return 0;
+    }
+    for (I32 i = 0; i < received; i++) {
+        sizes[i] = static_cast<I32>(messages[i].msg_len);
+    }
+    return received;
+#else
+    return IpSocket::recvBatchProtocol(data, sizes, count);
+#endif
+}
+
 }  // namespace Drv
@@ -75,6 +75,16 @@ class UdpSocket : public IpSocket {
      */
     SocketIpStatus configureRecv(const char* hostname, const U16 port);
 
+    /**
+     * \brief maximum number of datagrams a single `recvBatch` call can receive
+     *
+     * Datagrams are received with recvmmsg on Linux, up to SOCKET_RECV_BATCH_SIZE at a time. Other targets receive one
+     * datagram per call.
+     *
+     * \return batch size
+     */
+    U32 getRecvBatchSize() const;
+
   PROTECTED:
 
     /**
@@ -96,6 +106,14 @@ class UdpSocket : public IpSocket {
      * \return: size of data sent, or -1 on error.
      */
     I32 sendProtocol(const U8* const data, const U32 size);
+    /**
+     * \brief Protocol specific implementation of segmented send. Called directly with retry from sendSegments.
+     * \param data: pointer to each segment of data to send, all sent in one datagram
+     * \param sizes: size of each segment
+     * \param count: number of segments
+     * \return: size of data sent, or -1 on error.
+     */
+    I32 sendSegmentsProtocol(const U8* const data[], const U32 sizes[], const U32 count);
     /**
      * \brief Protocol specific implementation of recv.  Called directly with error handling from recv.
      * \param data: data pointer to fill
@@ -103,6 +121,14 @@ class UdpSocket : public IpSocket {
      * \return: size of data received, or -1 on error.
      */
     I32 recvProtocol( U8* const data, const U32 size);
+    /**
+     * \brief Protocol specific implementation of batched recv.  Called directly with error handling from recvBatch.
+     * \param data: data pointers to fill, one datagram each
+     * \param sizes: size of each data buffer, set to the size of each datagram received
+     * \param count: number of buffers
+     * \return: number of datagrams received, or -1 on error.
+     */
+    I32 recvBatchProtocol(U8* const data[], I32 sizes[], const U32 count);
   private:
     SocketState* m_state; //!< State storage
     U16 m_recv_port;  //!< IP address port used
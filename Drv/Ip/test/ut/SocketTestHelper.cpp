@@ -60,6 +60,22 @@ void send_recv(Drv::IpSocket& sender, Drv::IpSocket& receiver) {
     Drv::Test::validate_random_data(buffer_out, buffer_in, MAX_DRV_TEST_MESSAGE_SIZE);
 }
 
+void send_recv_segments(Drv::IpSocket& sender, Drv::IpSocket& receiver) {
+    I32 size = MAX_DRV_TEST_MESSAGE_SIZE;
+    U8 buffer_out[MAX_DRV_TEST_MESSAGE_SIZE] = {0};
+    U8 buffer_in[MAX_DRV_TEST_MESSAGE_SIZE] = {0};
+
+    // Split the message at a random point, leaving the last segment empty
+    Drv::Test::fill_random_data(buffer_out, MAX_DRV_TEST_MESSAGE_SIZE);
+    const U32 split = STest::Pick::lowerUpper(0, MAX_DRV_TEST_MESSAGE_SIZE);
+    const U8* const data[] = {buffer_out, buffer_out + split, buffer_out + MAX_DRV_TEST_MESSAGE_SIZE};
+    const U32 sizes[] = {split, MAX_DRV_TEST_MESSAGE_SIZE - split, 0};
+    EXPECT_EQ(sender.sendSegments(data, sizes, 3), Drv::SOCK_SUCCESS);
+    EXPECT_EQ(receiver.recv(buffer_in, size), Drv::SOCK_SUCCESS);
+    EXPECT_EQ(size, static_cast<I32>(MAX_DRV_TEST_MESSAGE_SIZE));
+    Drv::Test::validate_random_data(buffer_out, buffer_in, MAX_DRV_TEST_MESSAGE_SIZE);
+}
+
 bool wait_on_change(Drv::IpSocket &socket, bool open, U32 iterations) {
     for (U32 i = 0; i < iterations; i++) {
         if (open == socket.isOpened()) {
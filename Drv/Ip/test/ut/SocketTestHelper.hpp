@@ -55,6 +55,13 @@ void fill_random_buffer(Fw::Buffer &buffer);
  */
 void send_recv(Drv::IpSocket& sender, Drv::IpSocket& receiver);
 
+/**
+ * Send/receive pair sending a message split into segments, one of them empty.
+ * @param sender: sender of the pair
+ * @param receiver: receiver of pair
+ */
+void send_recv_segments(Drv::IpSocket& sender, Drv::IpSocket& receiver);
+
 /**
  * Wait on socket change.
  */
@@ -0,0 +1,203 @@
+//
+// Tests reading several sockets from one Drv::SocketReactor
+//
+#include <gtest/gtest.h>
+#include <Drv/Ip/SocketReactor.hpp>
+#include <Drv/Ip/SocketReadTask.hpp>
+#include <Drv/Ip/TcpClientSocket.hpp>
+#include <Drv/Ip/TcpServerSocket.hpp>
+#include <Drv/Ip/UdpSocket.hpp>
+#include <Os/Log.hpp>
+#include <Os/Mutex.hpp>
+#include <Os/Task.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Types/String.hpp>
+#include <Drv/Ip/test/ut/PortSelector.hpp>
+#include <Drv/Ip/test/ut/SocketTestHelper.hpp>
+
+Os::Log logger;
+
+static const U32 READER_BUFFER_COUNT = 64;
+static const U32 READER_BUFFER_SIZE = 256;
+static const U32 WAIT_ITERATIONS = 100;
+static const U32 WAIT_INTERVAL_MS = 10;
+
+/**
+ * Read task recording the data received from a socket
+ */
+class Reader : public Drv::SocketReadTask {
+  public:
+    Reader(Drv::IpSocket& socket) : m_socket(socket), m_next(0), m_bytes(0), m_returned(0), m_connects(0) {}
+
+    U32 getBytes() {
+        this->m_mutex.lock();
+        U32 bytes = this->m_bytes;
+        this->m_mutex.unLock();
+        return bytes;
+    }
+
+    bool waitOnBytes(const U32 bytes) {
+        for (U32 i = 0; (i < WAIT_ITERATIONS) && (this->getBytes() < bytes); i++) {
+            Os::Task::delay(WAIT_INTERVAL_MS);
+        }
+        return this->getBytes() == bytes;
+    }
+
+    Drv::IpSocket& getSocketHandler() {
+        return m_socket;
+    }
+
+    Fw::Buffer getBuffer() {
+        FW_ASSERT(this->m_next < READER_BUFFER_COUNT, this->m_next);
+        Fw::Buffer buffer(m_data[this->m_next], READER_BUFFER_SIZE);
+        this->m_next++;
+        return buffer;
+    }
+
+    void sendBuffer(Fw::Buffer buffer, Drv::SocketIpStatus status) {
+        this->m_mutex.lock();
+        if (status == Drv::SOCK_SUCCESS) {
+            this->m_bytes += buffer.getSize();
+        }
+        // Every buffer handed out comes back on success, error or stop
+        this->m_returned++;
+        this->m_mutex.unLock();
+    }
+
+    void connected() {
+        this->m_connects++;
+    }
+
+    Drv::IpSocket& m_socket;
+    Os::Mutex m_mutex;
+    U8 m_data[READER_BUFFER_COUNT][READER_BUFFER_SIZE];
+    U32 m_next;
+    U32 m_bytes;
+    U32 m_returned;
+    U32 m_connects;
+};
+
+void send_to(Drv::IpSocket& socket, const U32 size) {
+    U8 data[READER_BUFFER_SIZE];
+    Drv::Test::fill_random_data(data, size);
+    EXPECT_EQ(socket.send(data, size), Drv::SOCK_SUCCESS);
+}
+
+void stop_reader(Reader& reader) {
+    reader.stopSocketTask();
+    EXPECT_EQ(reader.joinSocketTask(nullptr), Os::Task::TASK_OK);
+    EXPECT_EQ(reader.m_returned, reader.m_next);
+}
+
+TEST(Reactor, UdpAndTcpClients) {
+    const U16 udp_port = Drv::Test::get_free_port(true);
+    const U16 tcp_port = Drv::Test::get_free_port();
+    ASSERT_NE(0, udp_port);
+    ASSERT_NE(0, tcp_port);
+    Drv::SocketReactor reactor;
+    Fw::String name("ReactorTask");
+
+    Drv::UdpSocket udp_recv;
+    udp_recv.configureRecv("127.0.0.1", udp_port);
+    Reader udp_reader(udp_recv);
+
+    // Three server sockets share one listener, each taking one client
+    Drv::TcpServerSocket servers[3];
+    Reader* server_readers[3];
+    for (U32 i = 0; i < 3; i++) {
+        servers[i].configure("127.0.0.1", tcp_port, 0, 100);
+        servers[i].shareListener(servers[0]);
+    }
+    ASSERT_EQ(servers[0].startup(), Drv::SOCK_SUCCESS);
+
+    udp_reader.startSocketReactor(reactor);
+    for (U32 i = 0; i < 3; i++) {
+        server_readers[i] = new Reader(servers[i]);
+        server_readers[i]->startSocketReactor(reactor);
+    }
+    reactor.start(name);
+
+    Drv::UdpSocket udp_send;
+    udp_send.configureSend("127.0.0.1", udp_port, 0, 100);
+    ASSERT_EQ(udp_send.open(), Drv::SOCK_SUCCESS);
+    Drv::TcpClientSocket clients[3];
+    for (U32 i = 0; i < 3; i++) {
+        clients[i].configure("127.0.0.1", tcp_port, 0, 100);
+        ASSERT_EQ(clients[i].open(), Drv::SOCK_SUCCESS);
+    }
+    for (U32 i = 0; i < 3; i++) {
+        ASSERT_TRUE(Drv::Test::wait_on_change(servers[i], true, WAIT_ITERATIONS));
+    }
+
+    // Each client is served by its own server socket, and the udp socket alongside them
+    for (U32 i = 0; i < 3; i++) {
+        send_to(clients[i], 10 * (i + 1));
+        send_to(udp_send, 100);
+    }
+    U32 tcp_bytes = 0;
+    for (U32 i = 0; i < 3; i++) {
+        ASSERT_TRUE(server_readers[i]->waitOnBytes(10 * (i + 1)));
+        EXPECT_EQ(server_readers[i]->m_connects, 1);
+        tcp_bytes += server_readers[i]->getBytes();
+    }
+    EXPECT_EQ(tcp_bytes, 60);
+    ASSERT_TRUE(udp_reader.waitOnBytes(300));
+
+    // A client reconnecting is accepted again by the server socket it left
+    clients[1].close();
+    ASSERT_TRUE(Drv::Test::wait_on_change(servers[1], false, WAIT_ITERATIONS));
+    ASSERT_EQ(clients[1].open(), Drv::SOCK_SUCCESS);
+    ASSERT_TRUE(Drv::Test::wait_on_change(servers[1], true, WAIT_ITERATIONS));
+    send_to(clients[1], 5);
+    ASSERT_TRUE(server_readers[1]->waitOnBytes(25));
+    EXPECT_EQ(server_readers[1]->m_connects, 2);
+
+    // Stopping one socket leaves the others served
+    stop_reader(*server_readers[0]);
+    send_to(clients[2], 7);
+    ASSERT_TRUE(server_readers[2]->waitOnBytes(37));
+
+    stop_reader(udp_reader);
+    for (U32 i = 1; i < 3; i++) {
+        stop_reader(*server_readers[i]);
+    }
+    reactor.stop();
+    EXPECT_EQ(reactor.join(nullptr), Os::Task::TASK_OK);
+    servers[0].shutdown();
+    for (U32 i = 0; i < 3; i++) {
+        clients[i].close();
+        delete server_readers[i];
+    }
+}
+
+TEST(Reactor, StopReturnsBuffers) {
+    const U16 port = Drv::Test::get_free_port(true);
+    ASSERT_NE(0, port);
+    Drv::SocketReactor reactor;
+    Fw::String name("ReactorTask");
+    Drv::UdpSocket udp_recv;
+    udp_recv.configureRecv("127.0.0.1", port);
+    Reader reader(udp_recv);
+    reader.startSocketReactor(reactor);
+    reactor.start(name);
+    ASSERT_TRUE(Drv::Test::wait_on_change(udp_recv, true, WAIT_ITERATIONS));
+
+    Drv::UdpSocket udp_send;
+    udp_send.configureSend("127.0.0.1", port, 0, 100);
+    ASSERT_EQ(udp_send.open(), Drv::SOCK_SUCCESS);
+    send_to(udp_send, 42);
+    ASSERT_TRUE(reader.waitOnBytes(42));
+
+    // Stopping the reactor closes the socket and hands back the buffers it held
+    reactor.stop();
+    EXPECT_EQ(reactor.join(nullptr), Os::Task::TASK_OK);
+    EXPECT_FALSE(udp_recv.isOpened());
+    EXPECT_FALSE(reactor.isAdded(reader));
+    EXPECT_EQ(reader.m_returned, reader.m_next);
+    udp_send.close();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -43,6 +43,8 @@ void test_with_loop(U32 iterations) {
             Drv::Test::force_recv_timeout(server);
             Drv::Test::send_recv(server, client);
             Drv::Test::send_recv(client, server);
+            Drv::Test::send_recv_segments(server, client);
+            Drv::Test::send_recv_segments(client, server);
         }
         client.close();
         server.close();
@@ -11,6 +11,8 @@
 
 Os::Log logger;
 
+const U32 BATCH_TEST_MESSAGE_SIZE = 256;
+
 void test_with_loop(U32 iterations, bool duplex) {
     Drv::SocketIpStatus status1 = Drv::SOCK_SUCCESS;
     Drv::SocketIpStatus status2 = Drv::SOCK_SUCCESS;
@@ -47,9 +49,11 @@ void test_with_loop(U32 iterations, bool duplex) {
             Drv::Test::force_recv_timeout(udp1);
             Drv::Test::force_recv_timeout(udp2);
             Drv::Test::send_recv(udp1, udp2);
+            Drv::Test::send_recv_segments(udp1, udp2);
             // Allow duplex connections
             if (duplex) {
                 Drv::Test::send_recv(udp2, udp1);
+                Drv::Test::send_recv_segments(udp2, udp1);
             }
         }
         udp1.close();
@@ -57,6 +61,62 @@ void test_with_loop(U32 iterations, bool duplex) {
     }
 }
 
+void test_batch_recv(U32 messages) {
+    U16 port =  Drv::Test::get_free_port();
+    ASSERT_NE(0, port);
+
+    Drv::UdpSocket sender;
+    Drv::UdpSocket receiver;
+    sender.configureSend("127.0.0.1", port, 0, 100);
+    receiver.configureRecv("127.0.0.1", port);
+    ASSERT_EQ(receiver.open(), Drv::SOCK_SUCCESS);
+    ASSERT_EQ(sender.open(), Drv::SOCK_SUCCESS);
+    Drv::Test::force_recv_timeout(receiver);
+
+    const U32 batch = receiver.getRecvBatchSize();
+    ASSERT_GT(batch, 0u);
+    ASSERT_LE(batch, static_cast<U32>(SOCKET_RECV_BATCH_SIZE));
+    U8 buffer_out[SOCKET_RECV_BATCH_SIZE][BATCH_TEST_MESSAGE_SIZE];
+    U8 buffer_in[SOCKET_RECV_BATCH_SIZE][BATCH_TEST_MESSAGE_SIZE];
+    U8* data[SOCKET_RECV_BATCH_SIZE];
+    I32 sizes[SOCKET_RECV_BATCH_SIZE];
+
+    // Queue up several datagrams of differing sizes before receiving any
+    for (U32 i = 0; i < messages; i++) {
+        Drv::Test::fill_random_data(buffer_out[i], BATCH_TEST_MESSAGE_SIZE);
+        EXPECT_EQ(sender.send(buffer_out[i], BATCH_TEST_MESSAGE_SIZE - i), Drv::SOCK_SUCCESS);
+    }
+    // Drain them, taking as many per call as the socket allows
+    U32 total = 0;
+    while (total < messages) {
+        for (U32 i = 0; i < batch; i++) {
+            data[i] = buffer_in[i];
+            sizes[i] = BATCH_TEST_MESSAGE_SIZE;
+        }
+        U32 received = 0;
+        ASSERT_EQ(receiver.recvBatch(data, sizes, batch, received), Drv::SOCK_SUCCESS);
+        ASSERT_GT(received, 0u);
+        ASSERT_LE(received, messages - total);
+        // On Linux every waiting datagram fitting the batch comes back at once
+        EXPECT_EQ(received, ((messages - total) < batch) ? (messages - total) : batch);
+        for (U32 i = 0; i < received; i++) {
+            EXPECT_EQ(sizes[i], static_cast<I32>(BATCH_TEST_MESSAGE_SIZE - (total + i)));
+            Drv::Test::validate_random_data(buffer_out[total + i], buffer_in[i], sizes[i]);
+        }
+        total += received;
+    }
+    sender.close();
+    receiver.close();
+}
+
+TEST(Nominal, TestBatchUdp) {
+    test_batch_recv(3);
+}
+
+TEST(Nominal, TestFullBatchUdp) {
+    test_batch_recv(SOCKET_RECV_BATCH_SIZE);
+}
+
 TEST(Nominal, TestNominalUdp) {
     test_with_loop(1, false);
 }
@@ -132,6 +132,24 @@ class TcpClientComponentImpl : public ByteStreamDriverModelComponentBase, public
      */
     Drv::SendStatus send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer);
 
+    /**
+     * \brief Send data held in three buffers out of the TcpClient as one contiguous stream
+     *
+     * Sends the header, payload and trailer back to back without copying them into one buffer. Statuses are as for
+     * the send port. The header is returned through the deallocate port, while the payload and trailer remain owned
+     * by the caller.
+     *
+     * \param portNum: fprime port number of the incoming port call
+     * \param header: buffer containing the leading data
+     * \param payload: buffer containing the data following the header
+     * \param trailer: buffer containing the data following the payload
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus sendSegments_handler(const NATIVE_INT_TYPE portNum,
+                                         Fw::Buffer& header,
+                                         Fw::Buffer& payload,
+                                         Fw::Buffer& trailer);
+
     /**
      * \brief **not supported**
      *
@@ -22,7 +22,12 @@ namespace Drv {
 
 TcpServerComponentImpl::TcpServerComponentImpl(const char* const compName)
     : ByteStreamDriverModelComponentBase(compName),
-      SocketReadTask() {}
+      SocketReadTask(),
+      m_onReactor(false) {
+    for (U32 i = 0; i < SOCKET_SERVER_REACTOR_CLIENTS; i++) {
+        this->m_clients[i].setup(*this);
+    }
+}
 
 void TcpServerComponentImpl::init(const NATIVE_INT_TYPE instance) {
     ByteStreamDriverModelComponentBase::init(instance);
@@ -32,6 +37,13 @@ SocketIpStatus TcpServerComponentImpl::configure(const char* hostname,
                                                  const U16 port,
                                                  const U32 send_timeout_seconds,
                                                  const U32 send_timeout_microseconds) {
+    for (U32 i = 0; i < SOCKET_SERVER_REACTOR_CLIENTS; i++) {
+        SocketIpStatus status =
+            this->m_clients[i].m_socket.configure(hostname, port, send_timeout_seconds, send_timeout_microseconds);
+        if (status != SOCK_SUCCESS) {
+            return status;
+        }
+    }
     return m_socket.configure(hostname, port, send_timeout_seconds, send_timeout_microseconds);
 }
 
@@ -43,6 +55,39 @@ SocketIpStatus TcpServerComponentImpl::startup() {
 
 void TcpServerComponentImpl::shutdown() {
     this->m_socket.shutdown();
+    for (U32 i = 0; i < SOCKET_SERVER_REACTOR_CLIENTS; i++) {
+        this->m_clients[i].m_socket.close();
+    }
+}
+
+void TcpServerComponentImpl::startSocketReactor(SocketReactor& reactor, const bool reconnect) {
+    FW_ASSERT(not this->m_onReactor);
+    this->m_onReactor = true;
+    // The clients accept on the listening socket, this component's own connection is left unused
+    for (U32 i = 0; i < SOCKET_SERVER_REACTOR_CLIENTS; i++) {
+        this->m_clients[i].m_socket.shareListener(this->m_socket);
+        this->m_clients[i].startSocketReactor(reactor, reconnect);
+    }
+}
+
+void TcpServerComponentImpl::stopSocketTask() {
+    if (not this->m_onReactor) {
+        SocketReadTask::stopSocketTask();
+        return;
+    }
+    for (U32 i = 0; i < SOCKET_SERVER_REACTOR_CLIENTS; i++) {
+        this->m_clients[i].stopSocketTask();
+    }
+}
+
+Os::Task::TaskStatus TcpServerComponentImpl::joinSocketTask(void** value_ptr) {
+    if (not this->m_onReactor) {
+        return SocketReadTask::joinSocketTask(value_ptr);
+    }
+    for (U32 i = 0; i < SOCKET_SERVER_REACTOR_CLIENTS; i++) {
+        (void)this->m_clients[i].joinSocketTask(value_ptr);
+    }
+    return Os::Task::TASK_OK;
 }
 
 // ----------------------------------------------------------------------
@@ -74,7 +119,9 @@ void TcpServerComponentImpl::connected() {
 // ----------------------------------------------------------------------
 
 Drv::SendStatus TcpServerComponentImpl::send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
-    Drv::SocketIpStatus status = m_socket.send(fwBuffer.getData(), fwBuffer.getSize());
+    const U8* const data[] = {fwBuffer.getData()};
+    const U32 sizes[] = {fwBuffer.getSize()};
+    Drv::SocketIpStatus status = this->sendToClients(data, sizes, 1);
     // Always return the buffer
     deallocate_out(0, fwBuffer);
     if ((status == SOCK_DISCONNECTED) || (status == SOCK_INTERRUPTED_TRY_AGAIN)) {
@@ -85,9 +132,73 @@ Drv::SendStatus TcpServerComponentImpl::send_handler(const NATIVE_INT_TYPE portN
     return SendStatus::SEND_OK;
 }
 
+Drv::SendStatus TcpServerComponentImpl::sendSegments_handler(const NATIVE_INT_TYPE portNum,
+                                                             Fw::Buffer& header,
+                                                             Fw::Buffer& payload,
+                                                             Fw::Buffer& trailer) {
+    const U8* const data[] = {header.getData(), payload.getData(), trailer.getData()};
+    const U32 sizes[] = {header.getSize(), payload.getSize(), trailer.getSize()};
+    Drv::SocketIpStatus status = this->sendToClients(data, sizes, 3);
+    // Always return the header, the payload and trailer belong to the caller
+    deallocate_out(0, header);
+    if ((status == SOCK_DISCONNECTED) || (status == SOCK_INTERRUPTED_TRY_AGAIN)) {
+        return SendStatus::SEND_RETRY;
+    } else if (status != SOCK_SUCCESS) {
+        return SendStatus::SEND_ERROR;
+    }
+    return SendStatus::SEND_OK;
+}
+
+Drv::SocketIpStatus TcpServerComponentImpl::sendToClients(const U8* const data[], const U32 sizes[], const U32 count) {
+    if (not this->m_onReactor) {
+        return (count == 1) ? m_socket.send(data[0], sizes[0]) : m_socket.sendSegments(data, sizes, count);
+    }
+    // Send to every connected client, reporting the first failure
+    Drv::SocketIpStatus status = SOCK_DISCONNECTED;
+    bool failed = false;
+    for (U32 i = 0; i < SOCKET_SERVER_REACTOR_CLIENTS; i++) {
+        if (this->m_clients[i].m_socket.isOpened()) {
+            Drv::SocketIpStatus sent = (count == 1) ? this->m_clients[i].m_socket.send(data[0], sizes[0])
+                                                    : this->m_clients[i].m_socket.sendSegments(data, sizes, count);
+            status = failed ? status : sent;
+            failed = failed || (sent != SOCK_SUCCESS);
+        }
+    }
+    return status;
+}
+
 Drv::PollStatus TcpServerComponentImpl::poll_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
     FW_ASSERT(0); // It is an error to call this handler on IP drivers
     return PollStatus::POLL_ERROR;
 }
 
+// ----------------------------------------------------------------------
+// Client connections served on a reactor
+// ----------------------------------------------------------------------
+
+TcpServerComponentImpl::ReactorClient::ReactorClient() : SocketReadTask(), m_server(nullptr) {}
+
+void TcpServerComponentImpl::ReactorClient::setup(TcpServerComponentImpl& server) {
+    this->m_server = &server;
+}
+
+IpSocket& TcpServerComponentImpl::ReactorClient::getSocketHandler() {
+    return this->m_socket;
+}
+
+Fw::Buffer TcpServerComponentImpl::ReactorClient::getBuffer() {
+    FW_ASSERT(this->m_server);
+    return this->m_server->getBuffer();
+}
+
+void TcpServerComponentImpl::ReactorClient::sendBuffer(Fw::Buffer buffer, SocketIpStatus status) {
+    FW_ASSERT(this->m_server);
+    this->m_server->sendBuffer(buffer, status);
+}
+
+void TcpServerComponentImpl::ReactorClient::connected() {
+    FW_ASSERT(this->m_server);
+    this->m_server->connected();
+}
+
 }  // end namespace Drv
@@ -15,6 +15,7 @@
 
 #include <IpCfg.hpp>
 #include <Drv/Ip/IpSocket.hpp>
+#include <Drv/Ip/SocketReactor.hpp>
 #include <Drv/Ip/SocketReadTask.hpp>
 #include <Drv/Ip/TcpServerSocket.hpp>
 #include "Drv/ByteStreamDriverModel/ByteStreamDriverModelComponentAc.hpp"
@@ -88,6 +89,30 @@ class TcpServerComponentImpl : public ByteStreamDriverModelComponentBase, public
      */
     void shutdown();
 
+    /**
+     * \brief serve several clients on a reactor instead of starting a read task
+     *
+     * Registers SOCKET_SERVER_REACTOR_CLIENTS client connections of this server with the reactor, each accepting a
+     * client on the listening port as it connects. Data received from any client is sent out the recv port, and data
+     * passed to the send port is sent to every connected client.
+     *
+     * \param reactor: reactor to read the client connections
+     * \param reconnect: automatically accept a new client when one disconnects. Default: true.
+     */
+    void startSocketReactor(SocketReactor& reactor, const bool reconnect = true);
+
+    /**
+     * \brief stop reading the socket, or every client connection when served on a reactor
+     */
+    void stopSocketTask();
+
+    /**
+     * \brief joins to the stopping read task, or waits on the reactor to drop every client connection
+     * \param value_ptr: a pointer to fill with data. Passed to the Os::Task::join call. NULL to ignore.
+     * \return: Os::Task::TaskStatus passed back from the Os::Task::join call.
+     */
+    Os::Task::TaskStatus joinSocketTask(void** value_ptr);
+
   PROTECTED:
     // ----------------------------------------------------------------------
     // Implementations for socket read task virtual methods
@@ -152,6 +177,24 @@ class TcpServerComponentImpl : public ByteStreamDriverModelComponentBase, public
      */
     Drv::SendStatus send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer);
 
+    /**
+     * \brief Send data held in three buffers out of the TcpServer as one contiguous stream
+     *
+     * Sends the header, payload and trailer back to back without copying them into one buffer. Statuses are as for
+     * the send port. The header is returned through the deallocate port, while the payload and trailer remain owned
+     * by the caller.
+     *
+     * \param portNum: fprime port number of the incoming port call
+     * \param header: buffer containing the leading data
+     * \param payload: buffer containing the data following the header
+     * \param trailer: buffer containing the data following the payload
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus sendSegments_handler(const NATIVE_INT_TYPE portNum,
+                                         Fw::Buffer& header,
+                                         Fw::Buffer& payload,
+                                         Fw::Buffer& trailer);
+
     /**
      * \brief **not supported**
      *
@@ -159,7 +202,43 @@ class TcpServerComponentImpl : public ByteStreamDriverModelComponentBase, public
      */
     Drv::PollStatus poll_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer);
 
+    /**
+     * \brief send data to the client, or to every connected client when served on a reactor
+     * \param data: pointer to each segment of data to send
+     * \param sizes: size of each segment
+     * \param count: number of segments
+     * \return status of the send, that of the first client failing when several are connected
+     */
+    Drv::SocketIpStatus sendToClients(const U8* const data[], const U32 sizes[], const U32 count);
+
+    /**
+     * \brief one client connection of a server served on a reactor
+     *
+     * Accepts on the server's listening port and passes its data and connections through the server component.
+     */
+    class ReactorClient : public SocketReadTask {
+      public:
+        ReactorClient();
+
+        /**
+         * \brief attach this client to its server
+         * \param server: server component owning the listening port
+         */
+        void setup(TcpServerComponentImpl& server);
+
+        Drv::TcpServerSocket m_socket; //!< Client connection sharing the server's listening socket
+      PROTECTED:
+        IpSocket& getSocketHandler();
+        Fw::Buffer getBuffer();
+        void sendBuffer(Fw::Buffer buffer, SocketIpStatus status);
+        void connected();
+      PRIVATE:
+        TcpServerComponentImpl* m_server; //!< Server component receiving the data
+    };
+
     Drv::TcpServerSocket m_socket; //!< Socket implementation
+    ReactorClient m_clients[SOCKET_SERVER_REACTOR_CLIENTS]; //!< Client connections served on a reactor
+    bool m_onReactor; //!< Clients are served on a reactor instead of a read task
 };
 
 }  // end namespace Drv
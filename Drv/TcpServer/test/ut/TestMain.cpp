@@ -24,6 +24,11 @@ TEST(Reconnect, ReceiveThreadReconnect) {
     tester.test_advanced_reconnect();
 }
 
+TEST(Reactor, ReactorClients) {
+    Drv::Tester tester;
+    tester.test_reactor_clients();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
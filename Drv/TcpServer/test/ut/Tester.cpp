@@ -14,6 +14,7 @@
 #include "Os/Log.hpp"
 #include <Drv/Ip/test/ut/PortSelector.hpp>
 #include <Drv/Ip/test/ut/SocketTestHelper.hpp>
+#include <Drv/Ip/SocketReactor.hpp>
 
 Os::Log logger;
 
@@ -39,6 +40,8 @@ void Tester ::test_with_loop(U32 iterations, bool recv_thread) {
     this->component.configure("127.0.0.1", port, 0, 100);
     serverStat = this->component.startup();
     EXPECT_EQ(serverStat, SOCK_SUCCESS);
+    // Without a reactor, no client waits in the listen queue
+    EXPECT_EQ(0, this->component.m_socket.m_sharers);
 
     // Start up a receive thread
     if (recv_thread) {
@@ -101,10 +104,81 @@ void Tester ::test_with_loop(U32 iterations, bool recv_thread) {
     ASSERT_from_ready_SIZE(iterations);
 }
 
+void Tester ::test_reactor_clients() {
+    const U32 CLIENTS = 2;
+    U8 buffer[sizeof(m_data_storage)] = {};
+    U16 port = Drv::Test::get_free_port();
+    ASSERT_NE(0, port);
+    Drv::SocketReactor reactor;
+
+    this->component.configure("127.0.0.1", port, 0, 100);
+    this->component.startSocketReactor(reactor);
+    EXPECT_EQ(static_cast<U32>(SOCKET_SERVER_REACTOR_CLIENTS), this->component.m_socket.m_sharers);
+    ASSERT_EQ(this->component.startup(), SOCK_SUCCESS);
+    Os::TaskString name("reactor");
+    reactor.start(name);
+
+    // Each client is accepted by its own connection of the server
+    Drv::TcpClientSocket clients[CLIENTS];
+    for (U32 i = 0; i < CLIENTS; i++) {
+        clients[i].configure("127.0.0.1", port, 0, 100);
+        ASSERT_EQ(clients[i].open(), Drv::SOCK_SUCCESS);
+        Drv::Test::force_recv_timeout(clients[i]);
+    }
+    for (U32 i = 0; i < CLIENTS; i++) {
+        ASSERT_TRUE(Drv::Test::wait_on_change(this->component.m_clients[i].m_socket, true,
+                                              SOCKET_RETRY_INTERVAL_MS/10 + 1));
+    }
+    ASSERT_from_ready_SIZE(CLIENTS);
+
+    // Sends go to every client
+    m_data_buffer.setSize(sizeof(m_data_storage));
+    Drv::Test::fill_random_buffer(m_data_buffer);
+    const U32 sent = m_data_buffer.getSize();
+    EXPECT_EQ(invoke_to_send(0, m_data_buffer), SendStatus::SEND_OK);
+    for (U32 i = 0; i < CLIENTS; i++) {
+        I32 size = sizeof(m_data_storage);
+        m_data_buffer.setSize(sent); // Validation consumes the expected size
+        EXPECT_EQ(clients[i].recv(buffer, size), Drv::SOCK_SUCCESS);
+        EXPECT_EQ(size, m_data_buffer.getSize());
+        Drv::Test::validate_random_buffer(m_data_buffer, buffer);
+    }
+
+    // Data from any client comes out the recv port, one client at a time as each receipt is validated
+    for (U32 i = 0; i < CLIENTS; i++) {
+        m_lock.lock();
+        m_data_buffer.setSize(sent);
+        m_lock.unLock();
+        EXPECT_EQ(clients[i].send(m_data_buffer.getData(), sent), Drv::SOCK_SUCCESS);
+        U32 received = 0;
+        for (U32 j = 0; (j < 100) && (received <= i); j++) {
+            Os::Task::delay(10);
+            m_lock.lock();
+            received = m_received;
+            m_lock.unLock();
+        }
+        EXPECT_EQ(i + 1, received);
+    }
+
+    // Stopping returns once the reactor has dropped every connection
+    this->component.stopSocketTask();
+    EXPECT_EQ(this->component.joinSocketTask(nullptr), Os::Task::TASK_OK);
+    for (U32 i = 0; i < SOCKET_SERVER_REACTOR_CLIENTS; i++) {
+        EXPECT_FALSE(reactor.isAdded(this->component.m_clients[i]));
+        EXPECT_FALSE(this->component.m_clients[i].m_socket.isOpened());
+    }
+    reactor.stop();
+    EXPECT_EQ(reactor.join(nullptr), Os::Task::TASK_OK);
+    this->component.shutdown();
+    for (U32 i = 0; i < CLIENTS; i++) {
+        clients[i].close();
+    }
+}
+
 Tester ::Tester()
     : ByteStreamDriverModelGTestBase("Tester", MAX_HISTORY_SIZE),
       component("ByteStreamDriverModel"),
-      m_data_buffer(m_data_storage, 0), m_spinner(true) {
+      m_data_buffer(m_data_storage, 0), m_spinner(true), m_received(0) {
     this->initComponents();
     this->connectPorts();
     ::memset(m_data_storage, 0, sizeof(m_data_storage));
@@ -137,11 +211,19 @@ void Tester ::test_advanced_reconnect() {
 // ----------------------------------------------------------------------
 
 void Tester ::from_recv_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& recvBuffer, const RecvStatus& recvStatus) {
+    m_lock.lock();
     this->pushFromPortEntry_recv(recvBuffer, recvStatus);
-    // Make sure we can get to unblocking the spinner
-    EXPECT_EQ(m_data_buffer.getSize(), recvBuffer.getSize()) << "Invalid transmission size";
-    Drv::Test::validate_random_buffer(m_data_buffer, recvBuffer.getData());
+    // Buffers handed back on close carry no data
+    if (recvStatus == RecvStatus::RECV_OK) {
+        // Make sure we can get to unblocking the spinner
+        EXPECT_EQ(m_data_buffer.getSize(), recvBuffer.getSize()) << "Invalid transmission size";
+        Drv::Test::validate_random_buffer(m_data_buffer, recvBuffer.getData());
+        m_received++;
+    } else {
+        EXPECT_EQ(0, recvBuffer.getSize());
+    }
     m_spinner = true;
+    m_lock.unLock();
     delete[] recvBuffer.getData();
 }
 
@@ -155,9 +237,12 @@ Fw::Buffer Tester ::
         U32 size
     )
   {
+    // Called on the read task or reactor
+    m_lock.lock();
     this->pushFromPortEntry_allocate(size);
     Fw::Buffer buffer(new U8[size], size);
     m_data_buffer2 = buffer;
+    m_lock.unLock();
     return buffer;
   }
 
@@ -167,7 +252,9 @@ Fw::Buffer Tester ::
         Fw::Buffer &fwBuffer
     )
   {
+    m_lock.lock();
     this->pushFromPortEntry_deallocate(fwBuffer);
+    m_lock.unLock();
   }
 
 // ----------------------------------------------------------------------
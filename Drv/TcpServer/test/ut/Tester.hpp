@@ -16,6 +16,7 @@
 #include "GTestBase.hpp"
 #include "Drv/TcpServer/TcpServerComponentImpl.hpp"
 #include "Drv/Ip/TcpClientSocket.hpp"
+#include "Os/Mutex.hpp"
 
 #define SEND_DATA_BUFFER_SIZE 1024
 
@@ -62,6 +63,10 @@ namespace Drv {
       //!
       void test_advanced_reconnect();
 
+      //! Test serving several clients on a socket reactor
+      //!
+      void test_reactor_clients();
+
       // Helpers
       void test_with_loop(U32 iterations, bool recv_thread=false);
 
@@ -126,6 +131,8 @@ namespace Drv {
       Fw::Buffer m_data_buffer2;
       U8 m_data_storage[SEND_DATA_BUFFER_SIZE];
       bool m_spinner;
+      Os::Mutex m_lock;
+      U32 m_received;
 
   };
 
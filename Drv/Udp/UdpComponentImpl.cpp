@@ -60,6 +60,10 @@ void UdpComponentImpl::sendBuffer(Fw::Buffer buffer, SocketIpStatus status) {
     this->recv_out(0, buffer, recvStatus);
 }
 
+void UdpComponentImpl::returnBuffer(Fw::Buffer buffer) {
+    this->deallocate_out(0, buffer);
+}
+
 void UdpComponentImpl::connected() {
     if (isConnected_ready_OutputPort(0)) {
         this->ready_out(0);
@@ -82,6 +86,23 @@ Drv::SendStatus UdpComponentImpl::send_handler(const NATIVE_INT_TYPE portNum, Fw
     return SendStatus::SEND_OK;
 }
 
+Drv::SendStatus UdpComponentImpl::sendSegments_handler(const NATIVE_INT_TYPE portNum,
+                                                       Fw::Buffer& header,
+                                                       Fw::Buffer& payload,
+                                                       Fw::Buffer& trailer) {
+    const U8* const data[] = {header.getData(), payload.getData(), trailer.getData()};
+    const U32 sizes[] = {header.getSize(), payload.getSize(), trailer.getSize()};
+    Drv::SocketIpStatus status = m_socket.sendSegments(data, sizes, 3);
+    // Always return the header, the payload and trailer belong to the caller
+    deallocate_out(0, header);
+    if ((status == SOCK_DISCONNECTED) || (status == SOCK_INTERRUPTED_TRY_AGAIN)) {
+        return SendStatus::SEND_RETRY;
+    } else if (status != SOCK_SUCCESS) {
+        return SendStatus::SEND_ERROR;
+    }
+    return SendStatus::SEND_OK;
+}
+
 Drv::PollStatus UdpComponentImpl::poll_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
     FW_ASSERT(0); // It is an error to call this handler on IP drivers
     return PollStatus::POLL_ERROR;
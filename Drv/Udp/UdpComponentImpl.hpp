@@ -123,6 +123,15 @@ class UdpComponentImpl : public ByteStreamDriverModelComponentBase, public Socke
      */
     void sendBuffer(Fw::Buffer buffer, SocketIpStatus status);
 
+    /**
+     * \brief returns a buffer of a batched read that was not filled
+     *
+     * Hands the buffer back through the deallocate port instead of sending it out empty.
+     *
+     * \param buffer: unfilled buffer gotten by getBuffer
+     */
+    void returnBuffer(Fw::Buffer buffer);
+
     /**
      * \brief called when the IPv4 system has been connected
     */
@@ -151,6 +160,24 @@ class UdpComponentImpl : public ByteStreamDriverModelComponentBase, public Socke
      */
     Drv::SendStatus send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer);
 
+    /**
+     * \brief Send data held in three buffers out of the Udp as one contiguous stream
+     *
+     * Sends the header, payload and trailer back to back without copying them into one buffer. Statuses are as for
+     * the send port. The header is returned through the deallocate port, while the payload and trailer remain owned
+     * by the caller.
+     *
+     * \param portNum: fprime port number of the incoming port call
+     * \param header: buffer containing the leading data
+     * \param payload: buffer containing the data following the header
+     * \param trailer: buffer containing the data following the payload
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus sendSegments_handler(const NATIVE_INT_TYPE portNum,
+                                         Fw::Buffer& header,
+                                         Fw::Buffer& payload,
+                                         Fw::Buffer& trailer);
+
     Drv::UdpSocket m_socket; //!< Socket implementation
 };
 
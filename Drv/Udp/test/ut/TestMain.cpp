@@ -24,6 +24,21 @@ TEST(Reconnect, ReceiveThreadReconnect) {
     tester.test_advanced_reconnect();
 }
 
+TEST(Batch, ReceiveSeveral) {
+    Drv::Tester tester;
+    tester.test_batch_receive();
+}
+
+TEST(Batch, ReceiveMoreThanBatch) {
+    Drv::Tester tester;
+    tester.test_batch_receive_full();
+}
+
+TEST(Batch, PoolExhausted) {
+    Drv::Tester tester;
+    tester.test_batch_receive_pool_exhausted();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -15,6 +15,9 @@
 #include <Drv/Ip/test/ut/SocketTestHelper.hpp>
 #include "Os/Log.hpp"
 #include <sys/socket.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <limits>
 
 Os::Log logger;
 
@@ -102,10 +105,65 @@ void Tester::test_with_loop(U32 iterations, bool recv_thread) {
     ASSERT_from_ready_SIZE(iterations);
 }
 
+void Tester::test_batch_read(const U32 datagrams, const U32 alloc_limit) {
+    ASSERT_LE(datagrams, sizeof(m_batch_sizes)/sizeof(m_batch_sizes[0]));
+    const U32 batch = this->component.getSocketHandler().getRecvBatchSize();
+    U8 buffer[sizeof(m_data_storage)];
+
+    U16 port1 =  Drv::Test::get_free_port();
+    ASSERT_NE(0, port1);
+    U16 port2 =  Drv::Test::get_free_port();
+    ASSERT_NE(0, port2);
+
+    this->component.configureSend("127.0.0.1", port1, 0, 100);
+    this->component.configureRecv("127.0.0.1", port2);
+    ASSERT_EQ(this->component.open(), Drv::SOCK_SUCCESS);
+    Drv::Test::force_recv_timeout(this->component.getSocketHandler());
+
+    // Send every datagram before reading so that they are all waiting on the socket
+    NATIVE_INT_TYPE fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_NE(-1, fd);
+    struct sockaddr_in address;
+    ::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port2);
+    ::inet_aton("127.0.0.1", &address.sin_addr);
+    for (U32 i = 0; i < datagrams; i++) {
+        // Each datagram is filled with its index + 1 and the second is left empty
+        m_batch_sizes[i] = (i == 1) ? 0 : STest::Pick::lowerUpper(1, sizeof(buffer));
+        ::memset(buffer, static_cast<U8>(i + 1), m_batch_sizes[i]);
+        ASSERT_EQ(static_cast<ssize_t>(m_batch_sizes[i]),
+                  ::sendto(fd, buffer, m_batch_sizes[i], 0, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)));
+    }
+    ::close(fd);
+
+    // Read until every datagram has come out, checking each read against the buffers it was able to get
+    m_batch = true;
+    U32 received = 0;
+    while (received < datagrams) {
+        const U32 allocations = this->fromPortHistory_allocate->size();
+        const U32 deallocations = this->fromPortHistory_deallocate->size();
+        m_allocs = 0;
+        m_alloc_limit = alloc_limit;
+        ASSERT_EQ(this->component.readOnce(), Drv::SOCK_SUCCESS);
+        const U32 obtained = FW_MIN(batch, alloc_limit);
+        const U32 expected = FW_MIN(obtained, datagrams - received);
+        received += expected;
+        ASSERT_from_recv_SIZE(received);
+        // A refused allocation ends the batch and is not retried
+        ASSERT_from_allocate_SIZE(allocations + ((alloc_limit < batch) ? alloc_limit + 1 : batch));
+        // Buffers that were not filled go straight back
+        ASSERT_from_deallocate_SIZE(deallocations + obtained - expected);
+    }
+    m_batch = false;
+    this->component.close();
+}
+
 Tester ::Tester()
     : ByteStreamDriverModelGTestBase("Tester", MAX_HISTORY_SIZE),
       component("ByteStreamDriverModel"),
-      m_data_buffer(m_data_storage, 0), m_spinner(true) {
+      m_data_buffer(m_data_storage, 0), m_spinner(true), m_batch(false), m_allocs(0),
+      m_alloc_limit(std::numeric_limits<U32>::max()) {
     this->initComponents();
     this->connectPorts();
     ::memset(m_data_storage, 0, sizeof(m_data_storage));
@@ -133,12 +191,35 @@ void Tester ::test_advanced_reconnect() {
     test_with_loop(10, true); // Up to 10 * RECONNECT_MS
 }
 
+void Tester ::test_batch_receive() {
+    test_batch_read(SOCKET_RECV_BATCH_SIZE / 2 + 1, std::numeric_limits<U32>::max());
+}
+
+void Tester ::test_batch_receive_full() {
+    test_batch_read(SOCKET_RECV_BATCH_SIZE * 2 + 1, std::numeric_limits<U32>::max());
+}
+
+void Tester ::test_batch_receive_pool_exhausted() {
+    test_batch_read(SOCKET_RECV_BATCH_SIZE, 3);
+}
+
 // ----------------------------------------------------------------------
 // Handlers for typed from ports
 // ----------------------------------------------------------------------
 
 void Tester ::from_recv_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& recvBuffer, const RecvStatus& recvStatus) {
     this->pushFromPortEntry_recv(recvBuffer, recvStatus);
+    if (m_batch) {
+        // Datagrams must come out in order, each into its own buffer
+        const U32 index = this->fromPortHistory_recv->size() - 1;
+        EXPECT_EQ(RecvStatus::RECV_OK, recvStatus);
+        ASSERT_EQ(m_batch_sizes[index], recvBuffer.getSize()) << "Invalid datagram size";
+        for (U32 i = 0; i < recvBuffer.getSize(); i++) {
+            ASSERT_EQ(static_cast<U8>(index + 1), recvBuffer.getData()[i]) << "Datagram " << index << " mixed at " << i;
+        }
+        delete[] recvBuffer.getData();
+        return;
+    }
     // Make sure we can get to unblocking the spinner
     EXPECT_EQ(m_data_buffer.getSize(), recvBuffer.getSize()) << "Invalid transmission size";
     Drv::Test::validate_random_buffer(m_data_buffer, recvBuffer.getData());
@@ -157,6 +238,11 @@ Fw::Buffer Tester ::
     )
   {
     this->pushFromPortEntry_allocate(size);
+    // Simulate an exhausted pool with an empty buffer
+    if (m_allocs >= m_alloc_limit) {
+        return Fw::Buffer();
+    }
+    m_allocs++;
     Fw::Buffer buffer(new U8[size], size);
     m_data_buffer2 = buffer;
     return buffer;
@@ -169,6 +255,10 @@ Fw::Buffer Tester ::
     )
   {
     this->pushFromPortEntry_deallocate(fwBuffer);
+    // Sent buffers are the tester's own storage, the rest came from from_allocate_handler
+    if (fwBuffer.getData() != m_data_storage) {
+        delete[] fwBuffer.getData();
+    }
   }
 
 // ----------------------------------------------------------------------
@@ -63,8 +63,21 @@ namespace Drv {
       //!
       void test_advanced_reconnect();
 
+      //! Test several datagrams taken by one read
+      //!
+      void test_batch_receive();
+
+      //! Test more datagrams waiting than one read takes
+      //!
+      void test_batch_receive_full();
+
+      //! Test batched reads when the buffer pool runs out
+      //!
+      void test_batch_receive_pool_exhausted();
+
       // Helpers
       void test_with_loop(U32 iterations, bool recv_thread=false);
+      void test_batch_read(const U32 datagrams, const U32 alloc_limit);
 
     private:
 
@@ -127,6 +140,10 @@ namespace Drv {
       Fw::Buffer m_data_buffer2;
       U8 m_data_storage[SEND_DATA_BUFFER_SIZE];
       bool m_spinner;
+      bool m_batch; //!< Check received buffers against m_batch_sizes instead of m_data_buffer
+      U32 m_batch_sizes[SOCKET_RECV_BATCH_SIZE * 2 + 1]; //!< Size of each datagram sent by test_batch_read
+      U32 m_allocs; //!< Buffers allocated since the count was reset
+      U32 m_alloc_limit; //!< Buffers allocated before the pool runs out
   };
 
 } // end namespace Drv
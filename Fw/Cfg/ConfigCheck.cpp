@@ -24,3 +24,11 @@ static_assert(FW_PARAM_STRING_MAX_SIZE <= FW_PARAM_BUFFER_MAX_SIZE, "FW_PARAM_ST
 // value.
 static_assert((FW_ENABLE_TEXT_LOGGING == 0) || ( FW_SERIALIZABLE_TO_STRING == 1), "FW_SERIALIZABLE_TO_STRING must be enabled to enable FW_ENABLE_TEXT_LOGGING");
 
+
+#if FW_QUEUE_INSTRUMENTATION
+// Queue histogram bin limits are powers of two held in a U32
+static_assert((FW_QUEUE_STATS_NUM_BINS >= 2) && (FW_QUEUE_STATS_NUM_BINS <= 33), "FW_QUEUE_STATS_NUM_BINS must be between 2 and 33");
+#endif
+
+// A component queue batch must hold at least the one message being dispatched
+static_assert(FW_COMPONENT_QUEUE_BATCH_SIZE >= 1, "FW_COMPONENT_QUEUE_BATCH_SIZE must be at least 1");
@@ -132,6 +132,8 @@ namespace Fw {
 
     void ActiveComponentBase::loop() {
 
+        // m_queue hands out a batch of received messages before blocking
+        // on the OS queue again, so a burst is drained one doDispatch() at a time
         bool quitLoop = false;
         while (!quitLoop) {
             MsgDispatchStatus loopStatus = this->doDispatch();
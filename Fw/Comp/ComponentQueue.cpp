@@ -0,0 +1,100 @@
+#include <Fw/Comp/ComponentQueue.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <cstring>
+#include <new>
+
+namespace Fw {
+
+    ComponentQueue::ComponentQueue() :
+        m_batch(nullptr),
+        m_msgSize(0),
+        m_batchCount(0),
+        m_batchIndex(0),
+        m_batchLeft(0)
+#if FW_QUEUE_INSTRUMENTATION
+        , m_dispatching(false)
+#endif
+    {
+    }
+
+    ComponentQueue::~ComponentQueue() {
+        delete[] this->m_batch;
+    }
+
+    Os::Queue::QueueStatus ComponentQueue::create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+        delete[] this->m_batch;
+        this->m_batch = nullptr;
+        this->m_msgSize = msgSize;
+        this->m_batchCount = 0;
+        this->m_batchIndex = 0;
+        __atomic_store_n(&this->m_batchLeft, 0, __ATOMIC_RELEASE);
+
+        // With a batch of one, messages are received straight into the caller's buffer
+        if (FW_COMPONENT_QUEUE_BATCH_SIZE > 1) {
+            FW_ASSERT(msgSize > 0, msgSize);
+            this->m_batch = new(std::nothrow) U8[FW_COMPONENT_QUEUE_BATCH_SIZE * msgSize];
+            if (nullptr == this->m_batch) {
+                return QUEUE_UNINITIALIZED;
+            }
+        }
+        return Os::Queue::create(name, depth, msgSize);
+    }
+
+    Os::Queue::QueueStatus ComponentQueue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block) {
+#if FW_QUEUE_INSTRUMENTATION
+        // the previous message has been dispatched by the time the next one is asked for
+        if (this->m_dispatching) {
+            Os::IntervalTimer::RawTime now;
+            Os::IntervalTimer::getRawTime(now);
+            this->m_stats.recordDispatch(Os::IntervalTimer::getDiffUsec(now, this->m_dispatchStart));
+            this->m_dispatching = false;
+        }
+        Os::Queue::QueueStatus status = this->receiveNext(buffer, capacity, actualSize, priority, block);
+        if (QUEUE_OK == status) {
+            Os::IntervalTimer::getRawTime(this->m_dispatchStart);
+            this->m_dispatching = true;
+        }
+        return status;
+#else
+        return this->receiveNext(buffer, capacity, actualSize, priority, block);
+#endif
+    }
+
+    Os::Queue::QueueStatus ComponentQueue::receiveNext(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block) {
+
+        if (nullptr == this->m_batch) {
+            return Os::Queue::receive(buffer, capacity, actualSize, priority, block);
+        }
+
+        // only go back to the OS queue once the batch has been handed out
+        if (this->m_batchIndex == this->m_batchCount) {
+            this->m_batchIndex = 0;
+            this->m_batchCount = 0;
+            Os::Queue::QueueStatus status = Os::Queue::receive(this->m_batch, this->m_msgSize, FW_COMPONENT_QUEUE_BATCH_SIZE,
+                                                                this->m_sizes, this->m_priorities, this->m_batchCount, block);
+            if (QUEUE_OK != status) {
+                return status;
+            }
+            FW_ASSERT((this->m_batchCount > 0) and (this->m_batchCount <= FW_COMPONENT_QUEUE_BATCH_SIZE), this->m_batchCount);
+            __atomic_store_n(&this->m_batchLeft, this->m_batchCount, __ATOMIC_RELEASE);
+        }
+
+        NATIVE_INT_TYPE size = this->m_sizes[this->m_batchIndex];
+        if (capacity < size) {
+            return QUEUE_SIZE_MISMATCH;
+        }
+        (void) memcpy(buffer, &this->m_batch[this->m_batchIndex * this->m_msgSize], static_cast<size_t>(size));
+        actualSize = size;
+        priority = this->m_priorities[this->m_batchIndex];
+        this->m_batchIndex++;
+        __atomic_store_n(&this->m_batchLeft, this->m_batchCount - this->m_batchIndex, __ATOMIC_RELEASE);
+        return QUEUE_OK;
+    }
+
+    NATIVE_INT_TYPE ComponentQueue::getNumMsgs() const {
+        // m_batchCount and m_batchIndex belong to the receiving thread, so only the atomic count is read here
+        return Os::Queue::getNumMsgs() + __atomic_load_n(&this->m_batchLeft, __ATOMIC_ACQUIRE);
+    }
+
+}
@@ -0,0 +1,57 @@
+/*
+ * ComponentQueue.hpp
+ *
+ */
+
+/*
+ * Description:
+ * Message queue of a queued or active component. The autocoded doDispatch() receives one
+ * message per call. This queue takes up to FW_COMPONENT_QUEUE_BATCH_SIZE messages from the
+ * OS queue in one receive and hands them out one per call, so a burst of messages is
+ * dispatched without going back to the OS queue for each one. Messages already taken are
+ * dispatched before any message received after them, regardless of priority, so a high
+ * priority message may wait for up to FW_COMPONENT_QUEUE_BATCH_SIZE - 1 lower priority ones.
+ * The default batch size of 1 receives straight from the OS queue.
+ *
+ * With FW_QUEUE_INSTRUMENTATION set, the time from handing out a message to the next receive
+ * is recorded as the dispatch time of that message.
+ */
+#ifndef FW_COMPONENT_QUEUE_HPP
+#define FW_COMPONENT_QUEUE_HPP
+
+#include <Os/Queue.hpp>
+#include <Os/IntervalTimer.hpp>
+#include <FpConfig.hpp>
+
+namespace Fw {
+    class ComponentQueue : public Os::Queue {
+        public:
+            ComponentQueue(); //!< Constructor
+            virtual ~ComponentQueue(); //!< Destructor
+            QueueStatus create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) override; //!< create the queue and its batch storage
+
+            using Os::Queue::receive; // serialized receives come through the raw receive below
+            QueueStatus receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block) override; //!< receive the next message of the batch
+
+            //! Messages in the queue plus those not yet handed out from the batch. Safe to call from any thread, but
+            //! may briefly miss the messages of a batch while the receiver is taking it from the OS queue.
+            NATIVE_INT_TYPE getNumMsgs() const override;
+
+        PRIVATE:
+            QueueStatus receiveNext(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block); //!< take the next message from the batch or the OS queue
+
+            U8* m_batch; //!< storage for received messages, m_msgSize bytes apart
+            NATIVE_INT_TYPE m_msgSize; //!< size of one message in the batch storage
+            NATIVE_INT_TYPE m_sizes[FW_COMPONENT_QUEUE_BATCH_SIZE]; //!< size of each message in the batch
+            NATIVE_INT_TYPE m_priorities[FW_COMPONENT_QUEUE_BATCH_SIZE]; //!< priority of each message in the batch
+            NATIVE_INT_TYPE m_batchCount; //!< number of messages in the batch
+            NATIVE_INT_TYPE m_batchIndex; //!< next message of the batch to hand out
+            NATIVE_INT_TYPE m_batchLeft; //!< messages of the batch not yet handed out. Atomic, read by getNumMsgs()
+#if FW_QUEUE_INSTRUMENTATION
+            bool m_dispatching; //!< a message has been handed out and not yet followed by another receive
+            Os::IntervalTimer::RawTime m_dispatchStart; //!< time the last message was handed out
+#endif
+    };
+
+}
+#endif
@@ -12,6 +12,7 @@
 #define FW_QUEUED_COMPONENT_BASE_HPP
 
 #include <Fw/Comp/PassiveComponentBase.hpp>
+#include <Fw/Comp/ComponentQueue.hpp>
 #include <Os/Queue.hpp>
 #include <Os/Task.hpp>
 #include <FpConfig.hpp>
@@ -33,7 +34,7 @@ namespace Fw {
             QueuedComponentBase(const char* name); //!< Constructor
             virtual ~QueuedComponentBase(); //!< Destructor
             void init(NATIVE_INT_TYPE instance); //!< initialization function
-            Os::Queue m_queue; //!< queue object for active component
+            ComponentQueue m_queue; //!< queue object for active component
             Os::Queue::QueueStatus createQueue(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize);
             virtual MsgDispatchStatus doDispatch()=0; //!< method to dispatch a single message in the queue.
 #if FW_OBJECT_TO_STRING == 1
@@ -0,0 +1,116 @@
+// ======================================================================
+// \title  ComponentQueueTest.cpp
+// \brief  Batched receives of Fw::ComponentQueue
+//
+// Built with FW_COMPONENT_QUEUE_BATCH_SIZE above 1 against one Os::Queue
+// backend at a time, chosen by the sources the test is built with.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Comp/ComponentQueue.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Types/String.hpp>
+#include <cstdio>
+#include <cstring>
+
+#if FW_COMPONENT_QUEUE_BATCH_SIZE < 2
+#error "ComponentQueueTest must be built with FW_COMPONENT_QUEUE_BATCH_SIZE of at least 2"
+#endif
+
+#define DEPTH (3 * FW_COMPONENT_QUEUE_BATCH_SIZE)
+#define MSG_SIZE 8
+
+// Send count messages numbered from first, with sizes cycling from 1 to MSG_SIZE
+static void sendMessages(Os::Queue& queue, U8 first, NATIVE_INT_TYPE count) {
+  U8 send[MSG_SIZE];
+  for (NATIVE_INT_TYPE ii = 0; ii < count; ++ii) {
+    const U8 number = static_cast<U8>(first + ii);
+    memset(send, number, sizeof(send));
+    Os::Queue::QueueStatus stat = queue.send(send, (number % MSG_SIZE) + 1, 0, Os::Queue::QUEUE_NONBLOCKING);
+    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+  }
+}
+
+// Receive a message and check it is the one numbered number
+static void receiveMessage(Os::Queue& queue, U8 number, Os::Queue::QueueBlocking block) {
+  U8 recv[MSG_SIZE];
+  NATIVE_INT_TYPE size = 0;
+  NATIVE_INT_TYPE priority = -1;
+  Os::Queue::QueueStatus stat = queue.receive(recv, sizeof(recv), size, priority, block);
+  FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+  FW_ASSERT(size == (number % MSG_SIZE) + 1, size, number);
+  FW_ASSERT(priority == 0, priority);
+  for (NATIVE_INT_TYPE ii = 0; ii < size; ++ii) {
+    FW_ASSERT(recv[ii] == number, recv[ii], number);
+  }
+}
+
+int main() {
+  printf("Creating queue.\n");
+  Fw::ComponentQueue queue;
+  // Received through the base class, as the autocoded dispatch does
+  Os::Queue& base = queue;
+  Fw::String name("ComponentQueueTest");
+  Os::Queue::QueueStatus stat = queue.create(name, DEPTH, MSG_SIZE);
+  FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+
+  printf("Test empty queue...\n");
+  U8 recv[MSG_SIZE];
+  NATIVE_INT_TYPE size = 0;
+  NATIVE_INT_TYPE priority = 0;
+  stat = base.receive(recv, sizeof(recv), size, priority, Os::Queue::QUEUE_NONBLOCKING);
+  FW_ASSERT(stat == Os::Queue::QUEUE_NO_MORE_MSGS, stat);
+  FW_ASSERT(base.getNumMsgs() == 0, base.getNumMsgs());
+  printf("Passed.\n");
+
+  printf("Test a full queue is received in order, in batches...\n");
+  sendMessages(base, 0, DEPTH);
+  FW_ASSERT(base.getNumMsgs() == DEPTH, base.getNumMsgs());
+  for (NATIVE_INT_TYPE ii = 0; ii < DEPTH; ++ii) {
+    receiveMessage(base, static_cast<U8>(ii), Os::Queue::QUEUE_BLOCKING);
+    // messages still held in the batch are counted
+    FW_ASSERT(base.getNumMsgs() == DEPTH - ii - 1, base.getNumMsgs(), ii);
+  }
+  stat = base.receive(recv, sizeof(recv), size, priority, Os::Queue::QUEUE_NONBLOCKING);
+  FW_ASSERT(stat == Os::Queue::QUEUE_NO_MORE_MSGS, stat);
+  printf("Passed.\n");
+
+  printf("Test messages sent while a batch is handed out come after it...\n");
+  sendMessages(base, 100, 3);
+  receiveMessage(base, 100, Os::Queue::QUEUE_NONBLOCKING);
+  sendMessages(base, 103, FW_COMPONENT_QUEUE_BATCH_SIZE);
+  FW_ASSERT(base.getNumMsgs() == FW_COMPONENT_QUEUE_BATCH_SIZE + 2, base.getNumMsgs());
+  for (NATIVE_INT_TYPE ii = 1; ii < FW_COMPONENT_QUEUE_BATCH_SIZE + 3; ++ii) {
+    receiveMessage(base, static_cast<U8>(100 + ii), Os::Queue::QUEUE_NONBLOCKING);
+  }
+  FW_ASSERT(base.getNumMsgs() == 0, base.getNumMsgs());
+  printf("Passed.\n");
+
+  printf("Test a batch receive called on the component queue takes from the OS queue...\n");
+  sendMessages(base, 200, 5);
+  U8 batch[DEPTH * MSG_SIZE];
+  NATIVE_INT_TYPE sizes[DEPTH];
+  NATIVE_INT_TYPE priorities[DEPTH];
+  NATIVE_INT_TYPE numMsgs = 0;
+  stat = base.receive(batch, MSG_SIZE, DEPTH, sizes, priorities, numMsgs, Os::Queue::QUEUE_NONBLOCKING);
+  FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+  FW_ASSERT(numMsgs == 5, numMsgs);
+  for (NATIVE_INT_TYPE ii = 0; ii < numMsgs; ++ii) {
+    const U8 number = static_cast<U8>(200 + ii);
+    FW_ASSERT(sizes[ii] == (number % MSG_SIZE) + 1, sizes[ii], ii);
+    FW_ASSERT(priorities[ii] == 0, priorities[ii], ii);
+    FW_ASSERT(batch[ii * MSG_SIZE] == number, batch[ii * MSG_SIZE], ii);
+  }
+  stat = base.receive(batch, MSG_SIZE, DEPTH, sizes, priorities, numMsgs, Os::Queue::QUEUE_NONBLOCKING);
+  FW_ASSERT(stat == Os::Queue::QUEUE_NO_MORE_MSGS, stat);
+  FW_ASSERT(numMsgs == 0, numMsgs);
+  printf("Passed.\n");
+
+  printf("Test completed.\n");
+  return 0;
+}
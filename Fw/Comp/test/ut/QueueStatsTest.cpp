@@ -0,0 +1,104 @@
+// ======================================================================
+// \title  QueueStatsTest.cpp
+// \brief  Queue histograms recorded with FW_QUEUE_INSTRUMENTATION
+//
+// Built with FW_QUEUE_INSTRUMENTATION set against its own pthread queue,
+// so the histograms are tested while the rest of the build leaves them off.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Comp/ComponentQueue.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Types/String.hpp>
+#include <cstdio>
+#include <unistd.h>
+
+#if !FW_QUEUE_INSTRUMENTATION
+#error "QueueStatsTest must be built with FW_QUEUE_INSTRUMENTATION set"
+#endif
+
+#define DEPTH 10
+#define MSG_SIZE 8
+#define DELAY_USEC 20000
+
+// Send count messages
+static void sendMessages(Os::Queue& queue, NATIVE_INT_TYPE count) {
+  U8 send[MSG_SIZE] = {0};
+  for (NATIVE_INT_TYPE ii = 0; ii < count; ++ii) {
+    Os::Queue::QueueStatus stat = queue.send(send, sizeof(send), 0, Os::Queue::QUEUE_NONBLOCKING);
+    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+  }
+}
+
+// Receive one message
+static void receiveMessage(Os::Queue& queue) {
+  U8 recv[MSG_SIZE];
+  NATIVE_INT_TYPE size = 0;
+  NATIVE_INT_TYPE priority = 0;
+  Os::Queue::QueueStatus stat = queue.receive(recv, sizeof(recv), size, priority, Os::Queue::QUEUE_NONBLOCKING);
+  FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+}
+
+int main() {
+  printf("Test histogram bins...\n");
+  FW_ASSERT(Os::QueueStats::getBin(0) == 0);
+  FW_ASSERT(Os::QueueStats::getBin(1) == 1);
+  FW_ASSERT(Os::QueueStats::getBin(2) == 2);
+  FW_ASSERT(Os::QueueStats::getBin(3) == 2);
+  FW_ASSERT(Os::QueueStats::getBin(4) == 3);
+  FW_ASSERT(Os::QueueStats::getBin(0xFFFFFFFF) == Os::QueueStats::NUM_BINS - 1);
+  FW_ASSERT(Os::QueueStats::getBinLimit(0) == 1);
+  FW_ASSERT(Os::QueueStats::getBinLimit(2) == 4);
+  FW_ASSERT(Os::QueueStats::getBinLimit(Os::QueueStats::NUM_BINS - 1) == 0);
+  printf("Passed.\n");
+
+  printf("Creating queue.\n");
+  Fw::ComponentQueue queue;
+  Fw::String name("QueueStatsTest");
+  Os::Queue::QueueStatus stat = queue.create(name, DEPTH, MSG_SIZE);
+  FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+
+  printf("Test depth is recorded on send...\n");
+  sendMessages(queue, 3);
+  const Os::QueueStats::Histogram& depth = queue.getStats().getDepth();
+  FW_ASSERT(depth.count == 3, depth.count);
+  FW_ASSERT(depth.max == 3, depth.max);
+  FW_ASSERT(depth.bins[1] == 1, depth.bins[1]);
+  FW_ASSERT(depth.bins[2] == 2, depth.bins[2]);
+  printf("Passed.\n");
+
+  printf("Test wait time is recorded on receive...\n");
+  usleep(DELAY_USEC);
+  receiveMessage(queue);
+  const Os::QueueStats::Histogram& wait = queue.getStats().getWait();
+  FW_ASSERT(wait.count == 1, wait.count);
+  FW_ASSERT(wait.max >= DELAY_USEC / 2, wait.max);
+  FW_ASSERT(wait.bins[Os::QueueStats::getBin(wait.max)] == 1, wait.max);
+  printf("Passed.\n");
+
+  printf("Test dispatch time is recorded on the next receive...\n");
+  const Os::QueueStats::Histogram& dispatch = queue.getStats().getDispatch();
+  FW_ASSERT(dispatch.count == 0, dispatch.count);
+  usleep(DELAY_USEC);
+  receiveMessage(queue);
+  FW_ASSERT(dispatch.count == 1, dispatch.count);
+  FW_ASSERT(dispatch.max >= DELAY_USEC / 2, dispatch.max);
+  FW_ASSERT(dispatch.bins[Os::QueueStats::getBin(dispatch.max)] == 1, dispatch.max);
+  printf("Passed.\n");
+
+  printf("Test stats reset...\n");
+  queue.resetStats();
+  FW_ASSERT(queue.getStats().getWait().count == 0);
+  FW_ASSERT(queue.getStats().getDispatch().count == 0);
+  FW_ASSERT(queue.getStats().getDepth().count == 0);
+  FW_ASSERT(queue.getStats().getDepth().max == 0);
+  printf("Passed.\n");
+
+  printf("Test completed.\n");
+  return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * LogBatchPacket.cpp
+ *
+ * Multi-event log packets. See LogBatchPacket.hpp.
+ */
+
+#include <Fw/Log/LogBatchPacket.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Fw {
+
+    LogBatchPacket::LogBatchPacket() : m_numEntries(0) {
+    }
+
+    LogBatchPacket::~LogBatchPacket() {
+    }
+
+    SerializeStatus LogBatchPacket::resetPktSer() {
+        this->m_pktBuffer.resetSer();
+        this->m_numEntries = 0;
+        return this->m_pktBuffer.serialize(static_cast<FwPacketDescriptorType>(ComPacket::FW_PACKET_LOG_BATCH));
+    }
+
+    SerializeStatus LogBatchPacket::addEvent(FwEventIdType id, const Time& timeTag, const LogBuffer& buffer) {
+        // check for room for the whole entry so a partial entry is never written
+        const NATIVE_UINT_TYPE entrySize = sizeof(FwEventIdType) + Time::SERIALIZED_SIZE + buffer.getBuffLength();
+        if (this->m_pktBuffer.getBuffLength() + entrySize > this->m_pktBuffer.getBuffCapacity()) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+
+        SerializeStatus stat = this->m_pktBuffer.serialize(id);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+
+        stat = this->m_pktBuffer.serialize(timeTag);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+
+        stat = this->m_pktBuffer.serialize(buffer.getBuffAddr(),buffer.getBuffLength(),true);
+        if (stat == FW_SERIALIZE_OK) {
+            this->m_numEntries++;
+        }
+        return stat;
+    }
+
+    NATIVE_UINT_TYPE LogBatchPacket::getNumEntries() const {
+        return this->m_numEntries;
+    }
+
+    ComBuffer& LogBatchPacket::getBuffer() {
+        return this->m_pktBuffer;
+    }
+
+    SerializeStatus LogBatchPacket::setBuffer(ComBuffer& buffer) {
+        this->m_pktBuffer = buffer;
+        return this->resetPktDeser();
+    }
+
+    SerializeStatus LogBatchPacket::resetPktDeser() {
+        this->m_pktBuffer.resetDeser();
+        FwPacketDescriptorType descriptor;
+        SerializeStatus stat = this->m_pktBuffer.deserialize(descriptor);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        if (descriptor != static_cast<FwPacketDescriptorType>(ComPacket::FW_PACKET_LOG_BATCH)) {
+            return FW_DESERIALIZE_TYPE_MISMATCH;
+        }
+        return FW_SERIALIZE_OK;
+    }
+
+    SerializeStatus LogBatchPacket::extractEvent(FwEventIdType& id, Time& timeTag, LogBuffer& buffer, NATIVE_UINT_TYPE bufferSize) {
+        SerializeStatus stat = this->m_pktBuffer.deserialize(id);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+
+        stat = this->m_pktBuffer.deserialize(timeTag);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+
+        if (bufferSize > buffer.getBuffCapacity()) {
+            return FW_DESERIALIZE_SIZE_MISMATCH;
+        }
+        stat = this->m_pktBuffer.deserialize(buffer.getBuffAddr(),bufferSize,true);
+        if (stat == FW_SERIALIZE_OK) {
+            // Shouldn't fail
+            stat = buffer.setBuffLen(bufferSize);
+            FW_ASSERT(stat == FW_SERIALIZE_OK,static_cast<NATIVE_INT_TYPE>(stat));
+        }
+        return stat;
+    }
+
+} /* namespace Fw */
@@ -0,0 +1,43 @@
+/*
+ * LogBatchPacket.hpp
+ *
+ * Multi-event log packets, kept apart from LogPacket so that single
+ * event packets do not carry a ComBuffer for them.
+ */
+
+#ifndef LOGBATCHPACKET_HPP_
+#define LOGBATCHPACKET_HPP_
+
+#include <Fw/Com/ComPacket.hpp>
+#include <Fw/Com/ComBuffer.hpp>
+#include <Fw/Log/LogBuffer.hpp>
+#include <Fw/Time/Time.hpp>
+
+namespace Fw {
+
+    // The id/time/arguments layout of a single event packet is repeated
+    // for each event added: |FW_PACKET_LOG_BATCH|id|time|args|id|time|args|...
+    // The descriptor keeps them apart from single event packets. Argument sizes are not stored,
+    // so a decoder needs the event arguments to walk the entries.
+    class LogBatchPacket {
+        public:
+
+            LogBatchPacket();
+            virtual ~LogBatchPacket();
+
+            SerializeStatus resetPktSer(); //!< start accumulating a new set of events
+            SerializeStatus addEvent(FwEventIdType id, const Time& timeTag, const LogBuffer& buffer); //!< add an event; FW_SERIALIZE_NO_ROOM_LEFT if it doesn't fit
+            NATIVE_UINT_TYPE getNumEntries() const; //!< number of events added since resetPktSer()
+            ComBuffer& getBuffer(); //!< multi-event packet to send
+            SerializeStatus setBuffer(ComBuffer& buffer); //!< set the multi-event packet to extract events from
+            SerializeStatus resetPktDeser(); //!< rewind to the first event in the multi-event packet
+            SerializeStatus extractEvent(FwEventIdType& id, Time& timeTag, LogBuffer& buffer, NATIVE_UINT_TYPE bufferSize); //!< extract next event with bufferSize bytes of arguments
+
+        protected:
+            ComBuffer m_pktBuffer; // !< multi-event packet
+            NATIVE_UINT_TYPE m_numEntries; // !< number of events in multi-event packet
+    };
+
+} /* namespace Fw */
+
+#endif /* LOGBATCHPACKET_HPP_ */
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <Fw/Log/LogPacket.hpp>
+#include <Fw/Log/LogBatchPacket.hpp>
 #include <Fw/Com/ComBuffer.hpp>
 #include <Fw/Log/LogString.hpp>
 
@@ -44,6 +45,57 @@ TEST(FwLogTest,LogPacketSerialize) {
     ASSERT_EQ(str1,str2);
 }
 
+TEST(FwLogTest,LogBatchPacketMultiEvent) {
+
+    // Add events until the packet is full
+    Fw::LogBatchPacket pktIn;
+    Fw::Time timeIn(TB_WORKSTATION_TIME,10,11);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,pktIn.resetPktSer());
+
+    NATIVE_UINT_TYPE numEvents = 0;
+    Fw::SerializeStatus stat = Fw::FW_SERIALIZE_OK;
+    while (Fw::FW_SERIALIZE_OK == stat) {
+        Fw::LogBuffer buffIn;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buffIn.serialize(static_cast<U32>(numEvents*2)));
+        stat = pktIn.addEvent(100 + numEvents,timeIn,buffIn);
+        if (Fw::FW_SERIALIZE_OK == stat) {
+            numEvents++;
+        }
+    }
+    ASSERT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT,stat);
+    ASSERT_GT(numEvents,1u);
+    ASSERT_EQ(pktIn.getNumEntries(),numEvents);
+
+    // The packet is marked as holding several events
+    Fw::ComBuffer& comBuff = pktIn.getBuffer();
+    FwPacketDescriptorType desc;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.deserialize(desc));
+    ASSERT_EQ(desc,static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_LOG_BATCH));
+
+    // Extract the events
+    Fw::LogBatchPacket pktOut;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,pktOut.setBuffer(pktIn.getBuffer()));
+    for (NATIVE_UINT_TYPE event = 0; event < numEvents; event++) {
+        FwEventIdType id = 0;
+        Fw::Time timeOut;
+        Fw::LogBuffer buffOut;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,pktOut.extractEvent(id,timeOut,buffOut,sizeof(U32)));
+        ASSERT_EQ(id,100 + event);
+        ASSERT_EQ(timeOut,timeIn);
+        U32 valOut = 0;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buffOut.deserialize(valOut));
+        ASSERT_EQ(valOut,event*2);
+    }
+    ASSERT_EQ(pktOut.getBuffer().getBuffLeft(),0u);
+
+    // A single event packet is not taken as a multi-event packet
+    Fw::LogPacket single;
+    Fw::ComBuffer singleBuff;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,singleBuff.serialize(single));
+    ASSERT_EQ(Fw::FW_DESERIALIZE_TYPE_MISMATCH,pktOut.setBuffer(singleBuff));
+
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
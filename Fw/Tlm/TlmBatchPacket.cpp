@@ -0,0 +1,104 @@
+/*
+ * TlmBatchPacket.cpp
+ *
+ * Multi-channel telemetry packets. See TlmBatchPacket.hpp.
+ */
+
+#include <Fw/Tlm/TlmBatchPacket.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Fw {
+
+    TlmBatchPacket::TlmBatchPacket() : m_numEntries(0) {
+    }
+
+    TlmBatchPacket::~TlmBatchPacket() {
+    }
+
+    SerializeStatus TlmBatchPacket::resetPktSer() {
+        this->m_pktBuffer.resetSer();
+        this->m_numEntries = 0;
+        return this->m_pktBuffer.serialize(static_cast<FwPacketDescriptorType>(ComPacket::FW_PACKET_TELEM_BATCH));
+    }
+
+    SerializeStatus TlmBatchPacket::addValue(FwChanIdType id, Time& timeTag, TlmBuffer& buffer) {
+        // check for room for the whole entry so a partial entry is never written
+        NATIVE_UINT_TYPE entrySize = sizeof(FwChanIdType) + buffer.getBuffLength();
+#if !FW_AMPCS_COMPATIBLE
+        entrySize += Time::SERIALIZED_SIZE;
+#endif
+        if (this->m_pktBuffer.getBuffLength() + entrySize > this->m_pktBuffer.getBuffCapacity()) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+
+        SerializeStatus stat = this->m_pktBuffer.serialize(id);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+
+#if !FW_AMPCS_COMPATIBLE
+        stat = this->m_pktBuffer.serialize(timeTag);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+#endif
+
+        stat = this->m_pktBuffer.serialize(buffer.getBuffAddr(),buffer.getBuffLength(),true);
+        if (stat == FW_SERIALIZE_OK) {
+            this->m_numEntries++;
+        }
+        return stat;
+    }
+
+    NATIVE_UINT_TYPE TlmBatchPacket::getNumEntries() const {
+        return this->m_numEntries;
+    }
+
+    ComBuffer& TlmBatchPacket::getBuffer() {
+        return this->m_pktBuffer;
+    }
+
+    SerializeStatus TlmBatchPacket::setBuffer(ComBuffer& buffer) {
+        this->m_pktBuffer = buffer;
+        return this->resetPktDeser();
+    }
+
+    SerializeStatus TlmBatchPacket::resetPktDeser() {
+        this->m_pktBuffer.resetDeser();
+        FwPacketDescriptorType descriptor;
+        SerializeStatus stat = this->m_pktBuffer.deserialize(descriptor);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        if (descriptor != static_cast<FwPacketDescriptorType>(ComPacket::FW_PACKET_TELEM_BATCH)) {
+            return FW_DESERIALIZE_TYPE_MISMATCH;
+        }
+        return FW_SERIALIZE_OK;
+    }
+
+    SerializeStatus TlmBatchPacket::extractValue(FwChanIdType& id, Time& timeTag, TlmBuffer& buffer, NATIVE_UINT_TYPE bufferSize) {
+        SerializeStatus stat = this->m_pktBuffer.deserialize(id);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+
+#if !FW_AMPCS_COMPATIBLE
+        stat = this->m_pktBuffer.deserialize(timeTag);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+#endif
+
+        if (bufferSize > buffer.getBuffCapacity()) {
+            return FW_DESERIALIZE_SIZE_MISMATCH;
+        }
+        stat = this->m_pktBuffer.deserialize(buffer.getBuffAddr(),bufferSize,true);
+        if (stat == FW_SERIALIZE_OK) {
+            // Shouldn't fail
+            stat = buffer.setBuffLen(bufferSize);
+            FW_ASSERT(stat == FW_SERIALIZE_OK,static_cast<NATIVE_INT_TYPE>(stat));
+        }
+        return stat;
+    }
+
+} /* namespace Fw */
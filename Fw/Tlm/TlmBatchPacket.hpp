@@ -0,0 +1,42 @@
+/*
+ * TlmBatchPacket.hpp
+ *
+ * Multi-channel telemetry packets, kept apart from TlmPacket so that single
+ * channel packets do not carry a ComBuffer for them.
+ */
+
+#ifndef TLMBATCHPACKET_HPP_
+#define TLMBATCHPACKET_HPP_
+
+#include <Fw/Com/ComPacket.hpp>
+#include <Fw/Com/ComBuffer.hpp>
+#include <Fw/Tlm/TlmBuffer.hpp>
+#include <Fw/Time/Time.hpp>
+
+namespace Fw {
+
+    // The id/time/value layout of a single channel packet is repeated
+    // for each value added: |FW_PACKET_TELEM_BATCH|id|time|value|id|time|value|...
+    // Value sizes are not stored, so a decoder needs the channel types to walk the entries.
+    class TlmBatchPacket {
+        public:
+
+            TlmBatchPacket();
+            virtual ~TlmBatchPacket();
+
+            SerializeStatus resetPktSer(); //!< start accumulating a new set of values
+            SerializeStatus addValue(FwChanIdType id, Time& timeTag, TlmBuffer& buffer); //!< add a value; FW_SERIALIZE_NO_ROOM_LEFT if it doesn't fit
+            NATIVE_UINT_TYPE getNumEntries() const; //!< number of values added since resetPktSer()
+            ComBuffer& getBuffer(); //!< multi-channel packet to send
+            SerializeStatus setBuffer(ComBuffer& buffer); //!< set the multi-channel packet to extract values from
+            SerializeStatus resetPktDeser(); //!< rewind to the first value in the multi-channel packet
+            SerializeStatus extractValue(FwChanIdType& id, Time& timeTag, TlmBuffer& buffer, NATIVE_UINT_TYPE bufferSize); //!< extract next value of bufferSize bytes
+
+        PROTECTED:
+            ComBuffer m_pktBuffer; // !< multi-channel packet
+            NATIVE_UINT_TYPE m_numEntries; // !< number of values in multi-channel packet
+    };
+
+} /* namespace Fw */
+
+#endif /* TLMBATCHPACKET_HPP_ */
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <Fw/Tlm/TlmPacket.hpp>
+#include <Fw/Tlm/TlmBatchPacket.hpp>
 #include <Fw/Com/ComBuffer.hpp>
 
 TEST(FwTlmTest,TlmPacketSerialize) {
@@ -34,6 +35,64 @@ TEST(FwTlmTest,TlmPacketSerialize) {
 
 }
 
+TEST(FwTlmTest,TlmBatchPacketMultiValue) {
+
+    // Add values until the packet is full
+    Fw::TlmBatchPacket pktIn;
+    Fw::Time timeIn(TB_WORKSTATION_TIME,10,11);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,pktIn.resetPktSer());
+
+    NATIVE_UINT_TYPE numValues = 0;
+    Fw::SerializeStatus stat = Fw::FW_SERIALIZE_OK;
+    while (Fw::FW_SERIALIZE_OK == stat) {
+        Fw::TlmBuffer buffIn;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buffIn.serialize(static_cast<U32>(numValues*2)));
+        stat = pktIn.addValue(100 + numValues,timeIn,buffIn);
+        if (Fw::FW_SERIALIZE_OK == stat) {
+            numValues++;
+        }
+    }
+    ASSERT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT,stat);
+    ASSERT_GT(numValues,1u);
+    ASSERT_EQ(pktIn.getNumEntries(),numValues);
+
+    // The packet is marked as holding several values
+    Fw::ComBuffer& comBuff = pktIn.getBuffer();
+    FwPacketDescriptorType desc;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.deserialize(desc));
+    ASSERT_EQ(desc,static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_TELEM_BATCH));
+
+    // Extract the values
+    Fw::TlmBatchPacket pktOut;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,pktOut.setBuffer(pktIn.getBuffer()));
+    for (NATIVE_UINT_TYPE value = 0; value < numValues; value++) {
+        FwChanIdType id = 0;
+        Fw::Time timeOut;
+        Fw::TlmBuffer buffOut;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,pktOut.extractValue(id,timeOut,buffOut,sizeof(U32)));
+        ASSERT_EQ(id,100 + value);
+        ASSERT_EQ(timeOut,timeIn);
+        U32 valOut = 0;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buffOut.deserialize(valOut));
+        ASSERT_EQ(valOut,value*2);
+    }
+    ASSERT_EQ(pktOut.getBuffer().getBuffLeft(),0u);
+
+    // A buffer holding another packet type is rejected
+    Fw::ComBuffer other;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,other.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_LOG)));
+    ASSERT_EQ(Fw::FW_DESERIALIZE_TYPE_MISMATCH,pktOut.setBuffer(other));
+
+#if !FW_AMPCS_COMPATIBLE
+    // A single channel packet is not taken as a multi-channel packet
+    Fw::TlmPacket single;
+    Fw::ComBuffer singleBuff;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,singleBuff.serialize(single));
+    ASSERT_EQ(Fw::FW_DESERIALIZE_TYPE_MISMATCH,pktOut.setBuffer(singleBuff));
+#endif
+
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
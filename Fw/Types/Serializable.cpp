@@ -11,6 +11,62 @@
 
 // Some macros/functions to optimize for architectures
 
+namespace {
+
+    // Converts a value between host byte order and the MSB first order of serialized data. The conversion is its own
+    // inverse. Big-endian hosts need no conversion, GCC compatible compilers on little-endian hosts use the byte swap
+    // builtins, and any other host falls back to placing each byte with shifts.
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    template <typename T>
+    inline T toSerialOrder(T val) {
+        return val;
+    }
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) && defined(__GNUC__)
+    inline U8 toSerialOrder(U8 val) {
+        return val;
+    }
+#if FW_HAS_16_BIT==1
+    inline U16 toSerialOrder(U16 val) {
+        return __builtin_bswap16(val);
+    }
+#endif
+#if FW_HAS_32_BIT==1
+    inline U32 toSerialOrder(U32 val) {
+        return __builtin_bswap32(val);
+    }
+#endif
+#if FW_HAS_64_BIT==1
+    inline U64 toSerialOrder(U64 val) {
+        return __builtin_bswap64(val);
+    }
+#endif
+#else
+    template <typename T>
+    inline T toSerialOrder(T val) {
+        U8 bytes[sizeof(T)];
+        for (NATIVE_UINT_TYPE byte = 0; byte < sizeof(T); byte++) {
+            bytes[byte] = static_cast<U8>(val >> (8 * (sizeof(T) - 1 - byte)));
+        }
+        (void) memcpy(&val, bytes, sizeof(T));
+        return val;
+    }
+#endif
+
+    // Copies count values the width of T from src to dest converting each between host and serialized byte order
+    template <typename T>
+    void copySerialOrder(void* dest, const void* src, NATIVE_UINT_TYPE count) {
+        U8* destBytes = static_cast<U8*>(dest);
+        const U8* srcBytes = static_cast<const U8*>(src);
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            T val;
+            (void) memcpy(&val, srcBytes + index * sizeof(T), sizeof(T));
+            val = toSerialOrder(val);
+            (void) memcpy(destBytes + index * sizeof(T), &val, sizeof(T));
+        }
+    }
+
+}
+
 namespace Fw {
 
     Serializable::Serializable() {
@@ -257,6 +313,82 @@ namespace Fw {
         return FW_SERIALIZE_OK;
     }
 
+    template <typename T>
+    SerializeStatus SerializeBufferBase::serializeArrayOf(const void* vals, NATIVE_UINT_TYPE count) {
+        // check for room, dividing rather than multiplying so large counts cannot overflow
+        if ((this->getBuffCapacity() - this->m_serLoc) / static_cast<NATIVE_UINT_TYPE>(sizeof(T)) < count) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        FW_ASSERT(this->getBuffAddr());
+        FW_ASSERT(vals != nullptr or count == 0);
+        copySerialOrder<T>(&this->getBuffAddr()[this->m_serLoc], vals, count);
+        this->m_serLoc += count * static_cast<NATIVE_UINT_TYPE>(sizeof(T));
+        this->m_deserLoc = 0;
+        return FW_SERIALIZE_OK;
+    }
+
+    SerializeStatus SerializeBufferBase::serializeArray(const U8* vals, NATIVE_UINT_TYPE count) {
+        return this->serializeArrayOf<U8>(vals, count);
+    }
+
+    SerializeStatus SerializeBufferBase::serializeArray(const I8* vals, NATIVE_UINT_TYPE count) {
+        return this->serializeArrayOf<U8>(vals, count);
+    }
+
+#if FW_HAS_16_BIT==1
+    SerializeStatus SerializeBufferBase::serializeArray(const U16* vals, NATIVE_UINT_TYPE count) {
+        return this->serializeArrayOf<U16>(vals, count);
+    }
+
+    SerializeStatus SerializeBufferBase::serializeArray(const I16* vals, NATIVE_UINT_TYPE count) {
+        return this->serializeArrayOf<U16>(vals, count);
+    }
+#endif
+#if FW_HAS_32_BIT==1
+    SerializeStatus SerializeBufferBase::serializeArray(const U32* vals, NATIVE_UINT_TYPE count) {
+        return this->serializeArrayOf<U32>(vals, count);
+    }
+
+    SerializeStatus SerializeBufferBase::serializeArray(const I32* vals, NATIVE_UINT_TYPE count) {
+        return this->serializeArrayOf<U32>(vals, count);
+    }
+#endif
+#if FW_HAS_64_BIT==1
+    SerializeStatus SerializeBufferBase::serializeArray(const U64* vals, NATIVE_UINT_TYPE count) {
+        return this->serializeArrayOf<U64>(vals, count);
+    }
+
+    SerializeStatus SerializeBufferBase::serializeArray(const I64* vals, NATIVE_UINT_TYPE count) {
+        return this->serializeArrayOf<U64>(vals, count);
+    }
+#endif
+
+    SerializeStatus SerializeBufferBase::serializeArray(const F32* vals, NATIVE_UINT_TYPE count) {
+        // floating point values are byte-swapped as integers of the same width
+        return this->serializeArrayOf<U32>(vals, count);
+    }
+
+#if FW_HAS_F64
+    SerializeStatus SerializeBufferBase::serializeArray(const F64* vals, NATIVE_UINT_TYPE count) {
+        return this->serializeArrayOf<U64>(vals, count);
+    }
+#endif
+
+    SerializeStatus SerializeBufferBase::serializeArray(const bool* vals, NATIVE_UINT_TYPE count) {
+        if (this->getBuffCapacity() - this->m_serLoc < count) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        FW_ASSERT(this->getBuffAddr());
+        FW_ASSERT(vals != nullptr or count == 0);
+        U8* dest = &this->getBuffAddr()[this->m_serLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            dest[index] = vals[index] ? FW_SERIALIZE_TRUE_VALUE : FW_SERIALIZE_FALSE_VALUE;
+        }
+        this->m_serLoc += count;
+        this->m_deserLoc = 0;
+        return FW_SERIALIZE_OK;
+    }
+
     SerializeStatus SerializeBufferBase::serialize(const Serializable &val) {
         return val.serialize(*this);
     }
@@ -528,6 +660,94 @@ namespace Fw {
         return FW_SERIALIZE_OK;
     }
 
+    template <typename T>
+    SerializeStatus SerializeBufferBase::deserializeArrayOf(void* vals, NATIVE_UINT_TYPE count) {
+        // check for room, dividing rather than multiplying so large counts cannot overflow
+        if (count == 0) {
+            return FW_SERIALIZE_OK;
+        } else if (this->getBuffLength() == this->m_deserLoc) {
+            return FW_DESERIALIZE_BUFFER_EMPTY;
+        } else if ((this->getBuffLength() - this->m_deserLoc) / static_cast<NATIVE_UINT_TYPE>(sizeof(T)) < count) {
+            return FW_DESERIALIZE_SIZE_MISMATCH;
+        }
+        FW_ASSERT(this->getBuffAddr());
+        FW_ASSERT(vals != nullptr);
+        copySerialOrder<T>(vals, &this->getBuffAddr()[this->m_deserLoc], count);
+        this->m_deserLoc += count * static_cast<NATIVE_UINT_TYPE>(sizeof(T));
+        return FW_SERIALIZE_OK;
+    }
+
+    SerializeStatus SerializeBufferBase::deserializeArray(U8* vals, NATIVE_UINT_TYPE count) {
+        return this->deserializeArrayOf<U8>(vals, count);
+    }
+
+    SerializeStatus SerializeBufferBase::deserializeArray(I8* vals, NATIVE_UINT_TYPE count) {
+        return this->deserializeArrayOf<U8>(vals, count);
+    }
+
+#if FW_HAS_16_BIT==1
+    SerializeStatus SerializeBufferBase::deserializeArray(U16* vals, NATIVE_UINT_TYPE count) {
+        return this->deserializeArrayOf<U16>(vals, count);
+    }
+
+    SerializeStatus SerializeBufferBase::deserializeArray(I16* vals, NATIVE_UINT_TYPE count) {
+        return this->deserializeArrayOf<U16>(vals, count);
+    }
+#endif
+#if FW_HAS_32_BIT==1
+    SerializeStatus SerializeBufferBase::deserializeArray(U32* vals, NATIVE_UINT_TYPE count) {
+        return this->deserializeArrayOf<U32>(vals, count);
+    }
+
+    SerializeStatus SerializeBufferBase::deserializeArray(I32* vals, NATIVE_UINT_TYPE count) {
+        return this->deserializeArrayOf<U32>(vals, count);
+    }
+#endif
+#if FW_HAS_64_BIT==1
+    SerializeStatus SerializeBufferBase::deserializeArray(U64* vals, NATIVE_UINT_TYPE count) {
+        return this->deserializeArrayOf<U64>(vals, count);
+    }
+
+    SerializeStatus SerializeBufferBase::deserializeArray(I64* vals, NATIVE_UINT_TYPE count) {
+        return this->deserializeArrayOf<U64>(vals, count);
+    }
+#endif
+
+    SerializeStatus SerializeBufferBase::deserializeArray(F32* vals, NATIVE_UINT_TYPE count) {
+        // floating point values are byte-swapped as integers of the same width
+        return this->deserializeArrayOf<U32>(vals, count);
+    }
+
+#if FW_HAS_F64
+    SerializeStatus SerializeBufferBase::deserializeArray(F64* vals, NATIVE_UINT_TYPE count) {
+        return this->deserializeArrayOf<U64>(vals, count);
+    }
+#endif
+
+    SerializeStatus SerializeBufferBase::deserializeArray(bool* vals, NATIVE_UINT_TYPE count) {
+        if (count == 0) {
+            return FW_SERIALIZE_OK;
+        } else if (this->getBuffLength() == this->m_deserLoc) {
+            return FW_DESERIALIZE_BUFFER_EMPTY;
+        } else if (this->getBuffLength() - this->m_deserLoc < count) {
+            return FW_DESERIALIZE_SIZE_MISMATCH;
+        }
+        FW_ASSERT(this->getBuffAddr());
+        FW_ASSERT(vals != nullptr);
+        // validate every value before writing any, so a format error leaves the array untouched
+        const U8* src = &this->getBuffAddr()[this->m_deserLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            if ((src[index] != FW_SERIALIZE_TRUE_VALUE) and (src[index] != FW_SERIALIZE_FALSE_VALUE)) {
+                return FW_DESERIALIZE_FORMAT_ERROR;
+            }
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            vals[index] = (src[index] == FW_SERIALIZE_TRUE_VALUE);
+        }
+        this->m_deserLoc += count;
+        return FW_SERIALIZE_OK;
+    }
+
     SerializeStatus SerializeBufferBase::deserialize(Serializable &val) {
         return val.deserialize(*this);
     }
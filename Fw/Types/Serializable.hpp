@@ -76,6 +76,29 @@ namespace Fw {
 
             SerializeStatus serialize(const SerializeBufferBase& val); //!< serialize a serialized buffer
 
+            // Bulk serialization for arrays of built-in types. The result is identical to serializing each element in
+            // turn, but with one bounds check for the whole array. Nothing is serialized if the array does not fit.
+
+            SerializeStatus serializeArray(const U8* vals, NATIVE_UINT_TYPE count); //!< serialize array of 8-bit unsigned ints
+            SerializeStatus serializeArray(const I8* vals, NATIVE_UINT_TYPE count); //!< serialize array of 8-bit signed ints
+#if FW_HAS_16_BIT==1
+            SerializeStatus serializeArray(const U16* vals, NATIVE_UINT_TYPE count); //!< serialize array of 16-bit unsigned ints
+            SerializeStatus serializeArray(const I16* vals, NATIVE_UINT_TYPE count); //!< serialize array of 16-bit signed ints
+#endif
+#if FW_HAS_32_BIT==1
+            SerializeStatus serializeArray(const U32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit unsigned ints
+            SerializeStatus serializeArray(const I32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit signed ints
+#endif
+#if FW_HAS_64_BIT==1
+            SerializeStatus serializeArray(const U64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit unsigned ints
+            SerializeStatus serializeArray(const I64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit signed ints
+#endif
+            SerializeStatus serializeArray(const F32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit floating point
+#if FW_HAS_F64
+            SerializeStatus serializeArray(const F64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit floating point
+#endif
+            SerializeStatus serializeArray(const bool* vals, NATIVE_UINT_TYPE count); //!< serialize array of booleans
+
             SerializeStatus serialize(const Serializable &val); //!< serialize an object derived from serializable base class
 
             // Deserialization for built-in types
@@ -114,6 +137,29 @@ namespace Fw {
 
             SerializeStatus deserialize(SerializeBufferBase& val);  //!< serialize a serialized buffer
 
+            // Bulk deserialization for arrays of built-in types, the counterpart of serializeArray. Nothing is
+            // deserialized if the buffer holds less than the whole array.
+
+            SerializeStatus deserializeArray(U8* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 8-bit unsigned ints
+            SerializeStatus deserializeArray(I8* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 8-bit signed ints
+#if FW_HAS_16_BIT==1
+            SerializeStatus deserializeArray(U16* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 16-bit unsigned ints
+            SerializeStatus deserializeArray(I16* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 16-bit signed ints
+#endif
+#if FW_HAS_32_BIT==1
+            SerializeStatus deserializeArray(U32* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 32-bit unsigned ints
+            SerializeStatus deserializeArray(I32* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 32-bit signed ints
+#endif
+#if FW_HAS_64_BIT==1
+            SerializeStatus deserializeArray(U64* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 64-bit unsigned ints
+            SerializeStatus deserializeArray(I64* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 64-bit signed ints
+#endif
+            SerializeStatus deserializeArray(F32* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 32-bit floating point
+#if FW_HAS_F64
+            SerializeStatus deserializeArray(F64* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 64-bit floating point
+#endif
+            SerializeStatus deserializeArray(bool* vals, NATIVE_UINT_TYPE count); //!< deserialize array of booleans
+
             void resetSer(); //!< reset to beginning of buffer to reuse for serialization
             void resetDeser(); //!< reset deserialization to beginning
 
@@ -147,6 +193,10 @@ namespace Fw {
             SerializeBufferBase(const SerializeBufferBase &src); //!< constructor with buffer as source
 
             void copyFrom(const SerializeBufferBase& src); //!< copy data from source buffer
+            template <typename T>
+            SerializeStatus serializeArrayOf(const void* vals, NATIVE_UINT_TYPE count); //!< bulk serialize count values the width of unsigned T
+            template <typename T>
+            SerializeStatus deserializeArrayOf(void* vals, NATIVE_UINT_TYPE count); //!< bulk deserialize count values the width of unsigned T
             NATIVE_UINT_TYPE m_serLoc; //!< current offset in buffer of serialized data
             NATIVE_UINT_TYPE m_deserLoc; //!< current offset for deserialization
     };
@@ -0,0 +1,398 @@
+// ======================================================================
+// \title  SerializationBenchmark.cpp
+// \brief  Benchmarks serialization of the framework's core types
+//
+// Measures serialize and deserialize time of Fw::SerializeBufferBase and of
+// the Fw::Time, Fw::TlmPacket, Fw::CmdPacket, Fw::LogPacket and
+// Fw::FilePacket types built on it. Each benchmark runs in doubling batches
+// until a batch takes at least the minimum time, then reports nanoseconds
+// per operation and bytes per second of serialized data.
+//
+// Usage: Fw_Types_Serialization_perf [--min-time-ms N] [--filter TEXT] [--json FILE]
+//
+//   --min-time-ms N  minimum time of the measured batch, default 20
+//   --filter TEXT    run only benchmarks whose name contains TEXT
+//   --json FILE      also write results to FILE in the Google Benchmark JSON format
+//
+// \copyright
+// Copyright 2009-2021, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Fw/Types/Serializable.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Buffer/Buffer.hpp>
+#include <Fw/Com/ComBuffer.hpp>
+#include <Fw/Com/ComPacket.hpp>
+#include <Fw/Time/Time.hpp>
+#include <Fw/Tlm/TlmPacket.hpp>
+#include <Fw/Tlm/TlmBatchPacket.hpp>
+#include <Fw/Cmd/CmdPacket.hpp>
+#include <Fw/Log/LogPacket.hpp>
+#include <Fw/FilePacket/FilePacket.hpp>
+#include <Os/IntervalTimer.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+    const NATIVE_UINT_TYPE MAX_RESULTS = 64;
+    const NATIVE_UINT_TYPE ARRAY_ELEMENTS = 64;
+    const NATIVE_UINT_TYPE RAW_BYTES = 1024;
+    const NATIVE_UINT_TYPE FILE_DATA_BYTES = 512;
+    const U64 MAX_ITERATIONS = 1ULL << 32;
+
+    class BenchmarkBuffer : public Fw::SerializeBufferBase {
+        public:
+            NATIVE_UINT_TYPE getBuffCapacity() const {
+                return sizeof(m_data);
+            }
+
+            U8* getBuffAddr() {
+                return m_data;
+            }
+
+            const U8* getBuffAddr() const {
+                return m_data;
+            }
+
+        private:
+            U8 m_data[4096];
+    };
+
+    struct Result {
+        const char* name;
+        U64 iterations;
+        U32 bytes; //!< serialized bytes handled per operation
+        F64 nsPerOp;
+        F64 bytesPerSec;
+    };
+
+    NATIVE_UINT_TYPE g_minTimeMs = 20;
+    const char* g_filter = nullptr;
+    Result g_results[MAX_RESULTS];
+    NATIVE_UINT_TYPE g_resultCount = 0;
+    U64 g_failures = 0; //!< operations not returning FW_SERIALIZE_OK, also keeps the operations from being optimized away
+
+    //! Times op over doubling batches until a batch lasts g_minTimeMs and records the result
+    template <typename Op>
+    void measure(const char* name, const U32 bytes, Op op) {
+        if ((g_filter != nullptr) and (strstr(name, g_filter) == nullptr)) {
+            return;
+        }
+        FW_ASSERT(g_resultCount < MAX_RESULTS, g_resultCount);
+        Os::IntervalTimer timer;
+        U64 iterations = 1;
+        U32 usec = 0;
+        while (true) {
+            timer.start();
+            for (U64 iteration = 0; iteration < iterations; iteration++) {
+                g_failures += (op() != Fw::FW_SERIALIZE_OK) ? 1 : 0;
+            }
+            timer.stop();
+            usec = timer.getDiffUsec();
+            if ((usec >= (g_minTimeMs * 1000)) or (iterations >= MAX_ITERATIONS)) {
+                break;
+            }
+            iterations *= 2;
+        }
+        Result& result = g_results[g_resultCount++];
+        result.name = name;
+        result.iterations = iterations;
+        result.bytes = bytes;
+        result.nsPerOp = (static_cast<F64>(usec) * 1000.0) / static_cast<F64>(iterations);
+        result.bytesPerSec = (usec == 0) ? 0.0 :
+            (static_cast<F64>(bytes) * static_cast<F64>(iterations) * 1.0e6) / static_cast<F64>(usec);
+        (void) printf("%-40s %12llu %12.2f ns/op %12.2f MB/s\n", name,
+                      static_cast<unsigned long long>(iterations), result.nsPerOp, result.bytesPerSec / 1.0e6);
+    }
+
+    void benchmarkSerializeBuffer() {
+        BenchmarkBuffer buffer;
+        U32 u32 = 0x12345678;
+        U64 u64 = 0x123456789ABCDEF0ULL;
+        F64 f64 = 3.14159265358979;
+        F32 f32s[ARRAY_ELEMENTS];
+        U8 raw[RAW_BYTES];
+        for (NATIVE_UINT_TYPE i = 0; i < ARRAY_ELEMENTS; i++) {
+            f32s[i] = static_cast<F32>(i) * 1.5f;
+        }
+        for (NATIVE_UINT_TYPE i = 0; i < RAW_BYTES; i++) {
+            raw[i] = static_cast<U8>(i);
+        }
+
+        measure("SerializeBuffer/serialize U32", sizeof(U32), [&]() {
+            buffer.resetSer();
+            return buffer.serialize(u32);
+        });
+        measure("SerializeBuffer/deserialize U32", sizeof(U32), [&]() {
+            buffer.resetDeser();
+            return buffer.deserialize(u32);
+        });
+        measure("SerializeBuffer/serialize U64", sizeof(U64), [&]() {
+            buffer.resetSer();
+            return buffer.serialize(u64);
+        });
+        measure("SerializeBuffer/deserialize U64", sizeof(U64), [&]() {
+            buffer.resetDeser();
+            return buffer.deserialize(u64);
+        });
+        measure("SerializeBuffer/serialize F64", sizeof(F64), [&]() {
+            buffer.resetSer();
+            return buffer.serialize(f64);
+        });
+        measure("SerializeBuffer/deserialize F64", sizeof(F64), [&]() {
+            buffer.resetDeser();
+            return buffer.deserialize(f64);
+        });
+        measure("SerializeBuffer/serialize F32x64 each", sizeof(f32s), [&]() {
+            buffer.resetSer();
+            Fw::SerializeStatus status = Fw::FW_SERIALIZE_OK;
+            for (NATIVE_UINT_TYPE i = 0; (i < ARRAY_ELEMENTS) and (status == Fw::FW_SERIALIZE_OK); i++) {
+                status = buffer.serialize(f32s[i]);
+            }
+            return status;
+        });
+        measure("SerializeBuffer/deserialize F32x64 each", sizeof(f32s), [&]() {
+            buffer.resetDeser();
+            Fw::SerializeStatus status = Fw::FW_SERIALIZE_OK;
+            for (NATIVE_UINT_TYPE i = 0; (i < ARRAY_ELEMENTS) and (status == Fw::FW_SERIALIZE_OK); i++) {
+                status = buffer.deserialize(f32s[i]);
+            }
+            return status;
+        });
+        measure("SerializeBuffer/serializeArray F32x64", sizeof(f32s), [&]() {
+            buffer.resetSer();
+            return buffer.serializeArray(f32s, ARRAY_ELEMENTS);
+        });
+        measure("SerializeBuffer/deserializeArray F32x64", sizeof(f32s), [&]() {
+            buffer.resetDeser();
+            return buffer.deserializeArray(f32s, ARRAY_ELEMENTS);
+        });
+        measure("SerializeBuffer/serialize raw 1024", RAW_BYTES, [&]() {
+            buffer.resetSer();
+            return buffer.serialize(raw, RAW_BYTES);
+        });
+        measure("SerializeBuffer/deserialize raw 1024", RAW_BYTES, [&]() {
+            buffer.resetDeser();
+            NATIVE_UINT_TYPE length = RAW_BYTES;
+            return buffer.deserialize(raw, length);
+        });
+    }
+
+    void benchmarkTime() {
+        BenchmarkBuffer buffer;
+        Fw::Time time(TB_WORKSTATION_TIME, 0, 1234567, 890123);
+        measure("Time/serialize", Fw::Time::SERIALIZED_SIZE, [&]() {
+            buffer.resetSer();
+            return buffer.serialize(time);
+        });
+        measure("Time/deserialize", Fw::Time::SERIALIZED_SIZE, [&]() {
+            buffer.resetDeser();
+            return buffer.deserialize(time);
+        });
+    }
+
+    void benchmarkTlmPacket() {
+        Fw::SerializeStatus status;
+        Fw::ComBuffer com;
+        Fw::TlmPacket packet;
+        Fw::Time time(TB_WORKSTATION_TIME, 0, 1234567, 890123);
+        Fw::TlmBuffer value;
+        U64 data = 0x123456789ABCDEF0ULL;
+        status = value.serialize(data);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        packet.setId(100);
+        packet.setTimeTag(time);
+        packet.setTlmBuffer(value);
+        status = com.serialize(packet);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        const U32 bytes = com.getBuffLength();
+
+        measure("TlmPacket/serialize", bytes, [&]() {
+            com.resetSer();
+            return com.serialize(packet);
+        });
+        measure("TlmPacket/deserialize", bytes, [&]() {
+            com.resetDeser();
+            return com.deserialize(packet);
+        });
+
+        // Multi-channel packets carry as many values as fit in one com buffer
+        Fw::TlmBatchPacket multi;
+        FwChanIdType id = 0;
+        U32 values = 0;
+        status = multi.resetPktSer();
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        while (multi.addValue(id, time, value) == Fw::FW_SERIALIZE_OK) {
+            values++;
+        }
+        const U32 multiBytes = multi.getBuffer().getBuffLength();
+        measure("TlmPacket/addValue multi-channel", multiBytes, [&]() {
+            Fw::SerializeStatus status = multi.resetPktSer();
+            for (U32 i = 0; (i < values) and (status == Fw::FW_SERIALIZE_OK); i++) {
+                status = multi.addValue(id, time, value);
+            }
+            return status;
+        });
+        measure("TlmPacket/extractValue multi-channel", multiBytes, [&]() {
+            Fw::SerializeStatus status = multi.resetPktDeser();
+            for (U32 i = 0; (i < values) and (status == Fw::FW_SERIALIZE_OK); i++) {
+                status = multi.extractValue(id, time, value, sizeof(data));
+            }
+            return status;
+        });
+    }
+
+    void benchmarkCmdPacket() {
+        Fw::SerializeStatus status;
+        // Commands are only ever deserialized on board, so CmdPacket::serialize is not supported
+        Fw::ComBuffer com;
+        Fw::CmdPacket packet;
+        const U32 args[4] = {1, 2, 3, 4};
+        status = com.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_COMMAND));
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        status = com.serialize(static_cast<FwOpcodeType>(0x100));
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        status = com.serializeArray(args, 4);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        const U32 bytes = com.getBuffLength();
+
+        measure("CmdPacket/deserialize", bytes, [&]() {
+            com.resetDeser();
+            packet.getArgBuffer().resetSer();
+            return com.deserialize(packet);
+        });
+    }
+
+    void benchmarkLogPacket() {
+        Fw::SerializeStatus status;
+        Fw::ComBuffer com;
+        Fw::LogPacket packet;
+        Fw::Time time(TB_WORKSTATION_TIME, 0, 1234567, 890123);
+        Fw::LogBuffer args;
+        const U32 values[4] = {1, 2, 3, 4};
+        status = args.serializeArray(values, 4);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        packet.setId(200);
+        packet.setTimeTag(time);
+        packet.setLogBuffer(args);
+        status = com.serialize(packet);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        const U32 bytes = com.getBuffLength();
+
+        measure("LogPacket/serialize", bytes, [&]() {
+            com.resetSer();
+            return com.serialize(packet);
+        });
+        measure("LogPacket/deserialize", bytes, [&]() {
+            com.resetDeser();
+            return com.deserialize(packet);
+        });
+    }
+
+    void benchmarkFilePacket() {
+        Fw::SerializeStatus status;
+        U8 data[FILE_DATA_BYTES];
+        U8 storage[FILE_DATA_BYTES + 64];
+        for (NATIVE_UINT_TYPE i = 0; i < FILE_DATA_BYTES; i++) {
+            data[i] = static_cast<U8>(i);
+        }
+        Fw::FilePacket::DataPacket dataPacket;
+        dataPacket.initialize(1, 0, FILE_DATA_BYTES, data);
+        Fw::FilePacket packet;
+        packet.fromDataPacket(dataPacket);
+        const U32 bytes = packet.bufferSize();
+        FW_ASSERT(bytes <= sizeof(storage), bytes);
+        Fw::Buffer buffer(storage, bytes);
+        status = packet.toBuffer(buffer);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+
+        measure("FilePacket/toBuffer data 512", bytes, [&]() {
+            return packet.toBuffer(buffer);
+        });
+        measure("FilePacket/fromBuffer data 512", bytes, [&]() {
+            return packet.fromBuffer(buffer);
+        });
+
+        Fw::FilePacket::StartPacket startPacket;
+        startPacket.initialize(1024 * 1024, "/path/to/source/file.bin", "/path/to/destination/file.bin");
+        Fw::FilePacket start;
+        start.fromStartPacket(startPacket);
+        const U32 startBytes = start.bufferSize();
+        FW_ASSERT(startBytes <= sizeof(storage), startBytes);
+        Fw::Buffer startBuffer(storage, startBytes);
+        status = start.toBuffer(startBuffer);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+
+        measure("FilePacket/toBuffer start", startBytes, [&]() {
+            return start.toBuffer(startBuffer);
+        });
+        measure("FilePacket/fromBuffer start", startBytes, [&]() {
+            return start.fromBuffer(startBuffer);
+        });
+    }
+
+    //! Writes results in the Google Benchmark JSON format so existing tooling can track them
+    bool writeJson(const char* path) {
+        FILE* file = fopen(path, "w");
+        if (file == nullptr) {
+            return false;
+        }
+        (void) fprintf(file, "{\n  \"context\": {\n    \"executable\": \"Fw_Types_Serialization_perf\",\n");
+        (void) fprintf(file, "    \"min_time_ms\": %u\n  },\n  \"benchmarks\": [\n", g_minTimeMs);
+        for (NATIVE_UINT_TYPE i = 0; i < g_resultCount; i++) {
+            const Result& result = g_results[i];
+            (void) fprintf(file, "    {\n      \"name\": \"%s\",\n      \"run_type\": \"iteration\",\n", result.name);
+            (void) fprintf(file, "      \"iterations\": %llu,\n", static_cast<unsigned long long>(result.iterations));
+            (void) fprintf(file, "      \"real_time\": %.3f,\n      \"cpu_time\": %.3f,\n", result.nsPerOp, result.nsPerOp);
+            (void) fprintf(file, "      \"time_unit\": \"ns\",\n      \"bytes\": %u,\n", result.bytes);
+            (void) fprintf(file, "      \"bytes_per_second\": %.1f\n    }%s\n", result.bytesPerSec,
+                           (i + 1 < g_resultCount) ? "," : "");
+        }
+        (void) fprintf(file, "  ]\n}\n");
+        return fclose(file) == 0;
+    }
+
+    void usage(const char* program) {
+        (void) fprintf(stderr, "Usage: %s [--min-time-ms N] [--filter TEXT] [--json FILE]\n", program);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const char* jsonPath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "--min-time-ms") == 0) and (i + 1 < argc)) {
+            g_minTimeMs = static_cast<NATIVE_UINT_TYPE>(strtoul(argv[++i], nullptr, 10));
+        } else if ((strcmp(argv[i], "--filter") == 0) and (i + 1 < argc)) {
+            g_filter = argv[++i];
+        } else if ((strcmp(argv[i], "--json") == 0) and (i + 1 < argc)) {
+            jsonPath = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    benchmarkSerializeBuffer();
+    benchmarkTime();
+    benchmarkTlmPacket();
+    benchmarkCmdPacket();
+    benchmarkLogPacket();
+    benchmarkFilePacket();
+
+    if ((jsonPath != nullptr) and not writeJson(jsonPath)) {
+        (void) fprintf(stderr, "Failed to write %s\n", jsonPath);
+        return 1;
+    }
+    if (g_failures != 0) {
+        (void) fprintf(stderr, "%llu operations failed\n", static_cast<unsigned long long>(g_failures));
+        return 1;
+    }
+    return 0;
+}
@@ -580,6 +580,73 @@ struct TestStruct {
         U8 m_buff[25];
 };
 
+template <typename T>
+void checkArraySerialization(const T (&vals)[5]) {
+    SerializeTestBuffer bulk;
+    SerializeTestBuffer single;
+    T out[5] = {};
+
+    // Bulk serialization produces the same bytes as serializing each element
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, bulk.serializeArray(vals, 5));
+    for (NATIVE_UINT_TYPE i = 0; i < 5; i++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, single.serialize(vals[i]));
+    }
+    ASSERT_EQ(single.getBuffLength(), bulk.getBuffLength());
+    ASSERT_EQ(0, memcmp(single.getBuffAddr(), bulk.getBuffAddr(), bulk.getBuffLength()));
+
+    // Bulk deserialization reads back what either produced
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, single.deserializeArray(out, 5));
+    ASSERT_EQ(0, memcmp(vals, out, sizeof(out)));
+    ASSERT_EQ(Fw::FW_DESERIALIZE_BUFFER_EMPTY, single.deserializeArray(out, 1));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, single.deserializeArray(out, 0));
+
+    // Too few bytes left deserializes nothing
+    bulk.resetDeser();
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, bulk.deserializeArray(out, 2));
+    ASSERT_EQ(Fw::FW_DESERIALIZE_SIZE_MISMATCH, bulk.deserializeArray(out, 4));
+    ASSERT_EQ(3 * sizeof(T), bulk.getBuffLeft());
+
+    // Too little room serializes nothing
+    bulk.resetSer();
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, bulk.serializeArray(vals, 1));
+    ASSERT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT, bulk.serializeArray(vals, bulk.getBuffCapacity() / sizeof(T)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT, bulk.serializeArray(vals, 0xFFFFFFFF));
+    ASSERT_EQ(sizeof(T), bulk.getBuffLength());
+}
+
+TEST(SerializationTest, ArraySerialization) {
+    const U8 u8s[5] = {0, 1, 0x7F, 0x80, 0xFF};
+    const I8 i8s[5] = {0, 1, -1, 127, -128};
+    const U16 u16s[5] = {0, 1, 0x1234, 0x8000, 0xFFFF};
+    const I16 i16s[5] = {0, -1, 0x1234, -32768, 32767};
+    const U32 u32s[5] = {0, 1, 0x12345678, 0x80000000, 0xFFFFFFFF};
+    const I32 i32s[5] = {0, -1, 0x12345678, -2147483647 - 1, 2147483647};
+    const U64 u64s[5] = {0, 1, 0x123456789ABCDEF0, 0x8000000000000000, 0xFFFFFFFFFFFFFFFF};
+    const I64 i64s[5] = {0, -1, 0x123456789ABCDEF0, -9223372036854775807 - 1, 9223372036854775807};
+    const F32 f32s[5] = {0.0f, -1.5f, 3.14159f, 1.0e30f, -2.0e-30f};
+    const F64 f64s[5] = {0.0, -1.5, 3.14159265358979, 1.0e300, -2.0e-300};
+    const bool bools[5] = {true, false, false, true, true};
+    checkArraySerialization(u8s);
+    checkArraySerialization(i8s);
+    checkArraySerialization(u16s);
+    checkArraySerialization(i16s);
+    checkArraySerialization(u32s);
+    checkArraySerialization(i32s);
+    checkArraySerialization(u64s);
+    checkArraySerialization(i64s);
+    checkArraySerialization(f32s);
+    checkArraySerialization(f64s);
+    checkArraySerialization(bools);
+
+    // A bad boolean fails the whole array and leaves it unchanged
+    SerializeTestBuffer buff;
+    bool out[3] = {false, false, false};
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.serializeArray(bools, 3));
+    buff.getBuffAddr()[2] = 0x42;
+    ASSERT_EQ(Fw::FW_DESERIALIZE_FORMAT_ERROR, buff.deserializeArray(out, 3));
+    ASSERT_FALSE(out[0]);
+}
+
 class MySerializable: public Fw::Serializable {
     public:
         Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const {
@@ -9,9 +9,13 @@
 #include <Os/Pthreads/BufferQueue.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Os/Queue.hpp>
+#if FW_QUEUE_INSTRUMENTATION
+#include <Os/IntervalTimer.hpp>
+#endif
 
 #include <new>
 #include <cstdio>
+#include <cstring>
 
 namespace Os {
 /**
@@ -20,6 +24,59 @@ namespace Os {
 */
 class BareQueueHandle {
     public:
+#if FW_QUEUE_INSTRUMENTATION
+        BareQueueHandle() : m_scratch(nullptr), m_stats(nullptr), m_init(false) {}
+        ~BareQueueHandle() {
+            delete[] m_scratch;
+        }
+        /**
+         * Create a new queue for use in the system. Each message is stored behind the time it was sent, as in
+         * Os/Pthreads/Queue.cpp, so that the receiver can record how long it waited.
+         * WARNING: this **must** be called during initialization.
+         */
+        bool create(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+            delete[] m_scratch;
+            m_scratch = new(std::nothrow) U8[msgSize + STAMP_SIZE];
+            bool ret = (nullptr != m_scratch) && m_queue.create(depth, msgSize + STAMP_SIZE);
+            m_init = ret;
+            return ret;
+        }
+        bool push(const U8* buffer, NATIVE_UINT_TYPE size, NATIVE_INT_TYPE priority) {
+            IntervalTimer::RawTime now;
+            IntervalTimer::getRawTime(now);
+            (void) memcpy(m_scratch, &now, STAMP_SIZE);
+            (void) memcpy(&m_scratch[STAMP_SIZE], buffer, size);
+            if (!m_queue.push(m_scratch, size + STAMP_SIZE, priority)) {
+                return false;
+            }
+            FW_ASSERT(m_stats != nullptr);
+            m_stats->recordDepth(m_queue.getCount());
+            return true;
+        }
+        bool pop(U8* buffer, NATIVE_UINT_TYPE& size, NATIVE_INT_TYPE& priority) {
+            NATIVE_UINT_TYPE stampedSize = size + STAMP_SIZE;
+            if (!m_queue.pop(m_scratch, stampedSize, priority)) {
+                // size is 0 when empty, otherwise the size of the message that did not fit
+                size = (stampedSize > STAMP_SIZE) ? stampedSize - STAMP_SIZE : 0;
+                return false;
+            }
+            IntervalTimer::RawTime sent;
+            IntervalTimer::RawTime now;
+            (void) memcpy(&sent, m_scratch, STAMP_SIZE);
+            size = stampedSize - STAMP_SIZE;
+            (void) memcpy(buffer, &m_scratch[STAMP_SIZE], size);
+            IntervalTimer::getRawTime(now);
+            FW_ASSERT(m_stats != nullptr);
+            m_stats->recordWait(IntervalTimer::getDiffUsec(now, sent));
+            return true;
+        }
+        NATIVE_UINT_TYPE getMsgSize() {
+            return m_queue.getMsgSize() - STAMP_SIZE;
+        }
+        static const NATIVE_UINT_TYPE STAMP_SIZE = sizeof(IntervalTimer::RawTime);
+        U8* m_scratch; //!< Stamped message, being assembled or taken apart
+        QueueStats* m_stats; //!< Histograms of the owning queue
+#else
         BareQueueHandle() : m_init(false) {}
         /**
          * Create a new queue for use in the system.
@@ -30,6 +87,16 @@ class BareQueueHandle {
             m_init = ret;
             return ret;
         }
+        bool push(const U8* buffer, NATIVE_UINT_TYPE size, NATIVE_INT_TYPE priority) {
+            return m_queue.push(buffer, size, priority);
+        }
+        bool pop(U8* buffer, NATIVE_UINT_TYPE& size, NATIVE_INT_TYPE& priority) {
+            return m_queue.pop(buffer, size, priority);
+        }
+        NATIVE_UINT_TYPE getMsgSize() {
+            return m_queue.getMsgSize();
+        }
+#endif
         bool m_init;
         //!< Actual queue used to store
         BufferQueue m_queue;
@@ -48,7 +115,14 @@ Queue::QueueStatus Queue::createInternal(const Fw::StringBase &name, NATIVE_INT_
     }
     //New queue handle, check for success or return error
     handle = new(std::nothrow) BareQueueHandle;
-    if (nullptr == handle || !handle->create(depth, msgSize)) {
+    if (nullptr == handle) {
+        return QUEUE_UNINITIALIZED;
+    }
+#if FW_QUEUE_INSTRUMENTATION
+    handle->m_stats = &this->m_stats;
+#endif
+    if (!handle->create(depth, msgSize)) {
+        delete handle;
         return QUEUE_UNINITIALIZED;
     }
     //Set handle member variable
@@ -63,6 +137,11 @@ Queue::QueueStatus Queue::createInternal(const Fw::StringBase &name, NATIVE_INT_
 }
 
 Queue::~Queue() {
+    #if FW_QUEUE_REGISTRATION
+    if (this->s_queueRegistry) {
+        this->s_queueRegistry->unregQueue(this);
+    }
+    #endif
     // Clean up the queue handle:
     BareQueueHandle* handle = reinterpret_cast<BareQueueHandle*>(this->m_handle);
     if (nullptr != handle) {
@@ -73,10 +152,9 @@ Queue::~Queue() {
 
 Queue::QueueStatus bareSendNonBlock(BareQueueHandle& handle, const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority) {
     FW_ASSERT(handle.m_init);
-    BufferQueue& queue = handle.m_queue;
     Queue::QueueStatus status = Queue::QUEUE_OK;
     // Push item onto queue:
-    bool success = queue.push(buffer, size, priority);
+    bool success = handle.push(buffer, size, priority);
     if(!success) {
         status = Queue::QUEUE_FULL;
     }
@@ -92,7 +170,7 @@ Queue::QueueStatus bareSendBlock(BareQueueHandle& handle, const U8* buffer, NATI
         FW_ASSERT(false);
     }
     // Push item onto queue:
-    bool success = queue.push(buffer, size, priority);
+    bool success = handle.push(buffer, size, priority);
     // The only reason push would not succeed is if the queue
     // was full. Since we waited for the queue to NOT be full
     // before sending on the queue, the push must have succeeded
@@ -108,13 +186,12 @@ Queue::QueueStatus Queue::send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_IN
         return QUEUE_UNINITIALIZED;
     }
     BareQueueHandle& handle = *reinterpret_cast<BareQueueHandle*>(this->m_handle);
-    BufferQueue& queue = handle.m_queue;
     //Check that the buffer is non-null
     if (nullptr == buffer) {
         return QUEUE_EMPTY_BUFFER;
     }
     //Fail if there is a size miss-match
-    if (size < 0 || static_cast<NATIVE_UINT_TYPE>(size) > queue.getMsgSize()) {
+    if (size < 0 || static_cast<NATIVE_UINT_TYPE>(size) > handle.getMsgSize()) {
         return QUEUE_SIZE_MISMATCH;
     }
     //Send to the queue
@@ -127,12 +204,11 @@ Queue::QueueStatus Queue::send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_IN
 
 Queue::QueueStatus bareReceiveNonBlock(BareQueueHandle& handle, U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority) {
     FW_ASSERT(handle.m_init);
-    BufferQueue& queue = handle.m_queue;
     NATIVE_UINT_TYPE size = static_cast<NATIVE_UINT_TYPE>(capacity);
     NATIVE_INT_TYPE pri = 0;
     Queue::QueueStatus status = Queue::QUEUE_OK;
     // Get an item off of the queue:
-    bool success = queue.pop(buffer, size, pri);
+    bool success = handle.pop(buffer, size, pri);
     if(success) {
         // Pop worked - set the return size and priority:
         actualSize = static_cast<NATIVE_INT_TYPE>(size);
@@ -168,7 +244,7 @@ Queue::QueueStatus bareReceiveBlock(BareQueueHandle& handle, U8* buffer, NATIVE_
         FW_ASSERT(false);
     }
     // Get an item off of the queue:
-    bool success = queue.pop(buffer, size, pri);
+    bool success = handle.pop(buffer, size, pri);
     if(success) {
         // Pop worked - set the return size and priority:
         actualSize = static_cast<NATIVE_INT_TYPE>(size);
@@ -176,7 +252,7 @@ Queue::QueueStatus bareReceiveBlock(BareQueueHandle& handle, U8* buffer, NATIVE_
     }
     else {
         actualSize = 0;
-        if( size > (static_cast<NATIVE_UINT_TYPE>(capacity) ) {
+        if( size > static_cast<NATIVE_UINT_TYPE>(capacity) ) {
             // The buffer capacity was too small!
             status = Queue::QUEUE_SIZE_MISMATCH;
         }
@@ -208,6 +284,24 @@ Queue::QueueStatus Queue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_I
     return bareReceiveBlock(handle, buffer, capacity, actualSize, priority);
 }
 
+Queue::QueueStatus Queue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE maxMsgs, NATIVE_INT_TYPE* actualSizes, NATIVE_INT_TYPE* priorities, NATIVE_INT_TYPE &numMsgs, QueueBlocking block) {
+    numMsgs = 0;
+    FW_ASSERT(maxMsgs > 0, maxMsgs);
+    FW_ASSERT(actualSizes != nullptr);
+    FW_ASSERT(priorities != nullptr);
+    //Only the first receive may block, the rest take what is already queued. The receives are called
+    //on this class so that a derived queue (e.g. Fw::ComponentQueue) does not take them from its batch.
+    QueueStatus status = Queue::receive(buffer, capacity, actualSizes[0], priorities[0], block);
+    while (QUEUE_OK == status) {
+        ++numMsgs;
+        if (numMsgs == maxMsgs) {
+            break;
+        }
+        status = Queue::receive(&buffer[numMsgs * capacity], capacity, actualSizes[numMsgs], priorities[numMsgs], QUEUE_NONBLOCKING);
+    }
+    return (numMsgs > 0) ? QUEUE_OK : status;
+}
+
 NATIVE_INT_TYPE Queue::getNumMsgs() const {
     //Check if the handle is null or check the underlying queue is null
     if ((nullptr == reinterpret_cast<BareQueueHandle*>(this->m_handle)) ||
@@ -248,7 +342,6 @@ NATIVE_INT_TYPE Queue::getMsgSize() const {
         return 0;
     }
     BareQueueHandle& handle = *reinterpret_cast<BareQueueHandle*>(this->m_handle);
-    BufferQueue& queue = handle.m_queue;
-    return queue.getMsgSize();
+    return handle.getMsgSize();
 }
 }//Namespace Os
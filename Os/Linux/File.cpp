@@ -427,7 +427,7 @@ namespace Os {
             return NOT_OPENED;
         }
 
-        const U32 maxChunkSize = 32;
+        const U32 maxChunkSize = FW_FILE_CRC_CHUNK_SIZE;
         const U32 initialSeed = 0xFFFFFFFF;
 
         // Seek to beginning of file
@@ -459,12 +459,7 @@ namespace Os {
                     continue;
                 }
 
-                int chunkIdx = 0;
-
-                while (chunkIdx < chunkSize) {
-                  seed = update_crc_32(seed, file_buffer[chunkIdx]);
-                  chunkIdx++;
-                }
+                seed = static_cast<U32>(update_crc_32_block(seed, file_buffer, static_cast<unsigned long>(chunkSize)));
 
             } else {
                 crc = 0;
@@ -0,0 +1,185 @@
+// ======================================================================
+// \title  Queue.cpp
+// \brief  Queue implementation using the lock-free ring queue. This is
+//         NOT an IPC queue. It is meant to be used between threads
+//         within the same address space.
+//
+//         Messages are delivered in FIFO order; priority is ignored and
+//         received as 0, as in FIFOBufferQueue.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Os/Linux/RingQueue.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Os/Queue.hpp>
+
+#include <new>
+
+namespace Os {
+
+  Queue::Queue() :
+    m_handle(reinterpret_cast<POINTER_CAST>(nullptr)) {
+  }
+
+  Queue::QueueStatus Queue::createInternal(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+    RingQueue* queueHandle = reinterpret_cast<RingQueue*>(this->m_handle);
+
+    // Queue has already been created... remove it and try again:
+    if (nullptr != queueHandle) {
+        delete queueHandle;
+        queueHandle = nullptr;
+        this->m_handle = reinterpret_cast<POINTER_CAST>(nullptr);
+    }
+
+    if ((depth <= 0) or (msgSize < 0)) {
+      return QUEUE_UNINITIALIZED;
+    }
+
+    // Create queue handle:
+    queueHandle = new(std::nothrow) RingQueue;
+    if (nullptr == queueHandle) {
+      return QUEUE_UNINITIALIZED;
+    }
+#if FW_QUEUE_INSTRUMENTATION
+    queueHandle->setStats(&this->m_stats);
+#endif
+    if( !queueHandle->create(depth, msgSize) ) {
+      delete queueHandle;
+      return QUEUE_UNINITIALIZED;
+    }
+    this->m_handle = reinterpret_cast<POINTER_CAST>(queueHandle);
+
+#if FW_QUEUE_REGISTRATION
+    if (this->s_queueRegistry) {
+        this->s_queueRegistry->regQueue(this);
+    }
+#endif
+
+    return QUEUE_OK;
+  }
+
+  Queue::~Queue() {
+#if FW_QUEUE_REGISTRATION
+    if (this->s_queueRegistry) {
+        this->s_queueRegistry->unregQueue(this);
+    }
+#endif
+    // Clean up the queue handle:
+    RingQueue* queueHandle = reinterpret_cast<RingQueue*>(this->m_handle);
+    if (nullptr != queueHandle) {
+      delete queueHandle;
+    }
+    this->m_handle = reinterpret_cast<POINTER_CAST>(nullptr);
+  }
+
+  Queue::QueueStatus Queue::send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority, QueueBlocking block) {
+    (void) priority; // Messages are delivered in FIFO order
+    RingQueue* queueHandle = reinterpret_cast<RingQueue*>(this->m_handle);
+
+    if (nullptr == queueHandle) {
+        return QUEUE_UNINITIALIZED;
+    }
+
+    if (nullptr == buffer) {
+        return QUEUE_EMPTY_BUFFER;
+    }
+
+    if (size < 0 || size > queueHandle->getMsgSize()) {
+        return QUEUE_SIZE_MISMATCH;
+    }
+
+    return queueHandle->send(buffer, size, block);
+  }
+
+  Queue::QueueStatus Queue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block) {
+
+      RingQueue* queueHandle = reinterpret_cast<RingQueue*>(this->m_handle);
+
+      if (nullptr == queueHandle) {
+        return QUEUE_UNINITIALIZED;
+      }
+
+      // Do not need to check the upper bound of capacity, We don't care
+      // how big the user's buffer is.. as long as it's big enough.
+      if (capacity < 0) {
+          return QUEUE_SIZE_MISMATCH;
+      }
+
+      QueueStatus status = queueHandle->receive(buffer, capacity, actualSize, block);
+      if (QUEUE_OK == status) {
+          priority = 0;
+      }
+      return status;
+  }
+
+  Queue::QueueStatus Queue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE maxMsgs, NATIVE_INT_TYPE* actualSizes, NATIVE_INT_TYPE* priorities, NATIVE_INT_TYPE &numMsgs, QueueBlocking block) {
+
+      numMsgs = 0;
+
+      RingQueue* queueHandle = reinterpret_cast<RingQueue*>(this->m_handle);
+
+      if (nullptr == queueHandle) {
+        return QUEUE_UNINITIALIZED;
+      }
+
+      if (capacity < 0) {
+          return QUEUE_SIZE_MISMATCH;
+      }
+
+      FW_ASSERT(maxMsgs > 0, maxMsgs);
+      FW_ASSERT(actualSizes != nullptr);
+      FW_ASSERT(priorities != nullptr);
+
+      // The first message may need to wait; the rest are only taken if already queued
+      QueueStatus status = queueHandle->receive(buffer, capacity, actualSizes[0], block);
+      if (QUEUE_OK != status) {
+        return status;
+      }
+      priorities[0] = 0;
+      for (numMsgs = 1; numMsgs < maxMsgs; numMsgs++) {
+        if (QUEUE_OK != queueHandle->receive(&buffer[numMsgs * capacity], capacity, actualSizes[numMsgs], QUEUE_NONBLOCKING)) {
+          break;
+        }
+        priorities[numMsgs] = 0;
+      }
+      return QUEUE_OK;
+  }
+
+  NATIVE_INT_TYPE Queue::getNumMsgs() const {
+      RingQueue* queueHandle = reinterpret_cast<RingQueue*>(this->m_handle);
+      if (nullptr == queueHandle) {
+          return 0;
+      }
+      return queueHandle->getCount();
+  }
+
+  NATIVE_INT_TYPE Queue::getMaxMsgs() const {
+      RingQueue* queueHandle = reinterpret_cast<RingQueue*>(this->m_handle);
+      if (nullptr == queueHandle) {
+          return 0;
+      }
+      return queueHandle->getMaxCount();
+  }
+
+  NATIVE_INT_TYPE Queue::getQueueSize() const {
+      RingQueue* queueHandle = reinterpret_cast<RingQueue*>(this->m_handle);
+      if (nullptr == queueHandle) {
+          return 0;
+      }
+      return queueHandle->getDepth();
+  }
+
+  NATIVE_INT_TYPE Queue::getMsgSize() const {
+      RingQueue* queueHandle = reinterpret_cast<RingQueue*>(this->m_handle);
+      if (nullptr == queueHandle) {
+          return 0;
+      }
+      return queueHandle->getMsgSize();
+  }
+
+}
@@ -0,0 +1,263 @@
+// ======================================================================
+// \title  RingQueue.cpp
+// \brief  Bounded lock-free ring of fixed message slots. See
+//         RingQueue.hpp.
+//
+//         Messages are copied into fixed slots. Each slot carries a
+//         sequence number that tells senders when the slot is free and
+//         the receiver when it holds a message, so neither side takes a
+//         lock. Slots are claimed by advancing a position with
+//         compare-and-swap.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Types/Assert.hpp>
+#include <Os/Linux/RingQueue.hpp>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <new>
+
+namespace Os {
+
+  namespace {
+
+    void futexWait(U32* word, U32 value) {
+      long ret = syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+      // EAGAIN: word changed before sleeping, EINTR: signal. Caller re-checks in both cases.
+      FW_ASSERT((ret == 0) or (errno == EAGAIN) or (errno == EINTR), errno);
+    }
+
+    void futexWakeAll(U32* word) {
+      long ret = syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+      FW_ASSERT(ret >= 0, errno);
+    }
+
+  }
+
+  RingQueue::RingQueue() :
+    m_slots(nullptr), m_data(nullptr), m_depth(0), m_msgSize(0), m_maxCount(0)
+#if FW_QUEUE_INSTRUMENTATION
+    , m_stats(nullptr)
+#endif
+  {
+    memset(&this->m_sendCursor, 0, sizeof(this->m_sendCursor));
+    memset(&this->m_recvCursor, 0, sizeof(this->m_recvCursor));
+  }
+
+  RingQueue::~RingQueue() {
+    delete[] this->m_slots;
+    delete[] this->m_data;
+  }
+
+  bool RingQueue::create(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+    FW_ASSERT(nullptr == this->m_slots);
+    FW_ASSERT(depth > 0, depth);
+    FW_ASSERT(msgSize >= 0, msgSize);
+    this->m_slots = new(std::nothrow) Slot[depth];
+    this->m_data = new(std::nothrow) U8[depth * msgSize];
+    if ((nullptr == this->m_slots) or (nullptr == this->m_data)) {
+      return false;
+    }
+    for (NATIVE_INT_TYPE slot = 0; slot < depth; slot++) {
+      this->m_slots[slot].sequence = static_cast<U64>(slot);
+      this->m_slots[slot].size = 0;
+    }
+    this->m_depth = static_cast<U64>(depth);
+    this->m_msgSize = static_cast<NATIVE_UINT_TYPE>(msgSize);
+    return true;
+  }
+
+#if FW_QUEUE_INSTRUMENTATION
+  void RingQueue::setStats(QueueStats* stats) {
+    this->m_stats = stats;
+  }
+#endif
+
+  NATIVE_INT_TYPE RingQueue::getCount() const {
+    U64 recv = __atomic_load_n(&this->m_recvCursor.position, __ATOMIC_RELAXED);
+    U64 send = __atomic_load_n(&this->m_sendCursor.position, __ATOMIC_RELAXED);
+    return (send > recv) ? static_cast<NATIVE_INT_TYPE>(send - recv) : 0;
+  }
+
+  NATIVE_INT_TYPE RingQueue::getMaxCount() const {
+    return __atomic_load_n(&this->m_maxCount, __ATOMIC_RELAXED);
+  }
+
+  NATIVE_INT_TYPE RingQueue::getDepth() const {
+    return static_cast<NATIVE_INT_TYPE>(this->m_depth);
+  }
+
+  NATIVE_INT_TYPE RingQueue::getMsgSize() const {
+    return static_cast<NATIVE_INT_TYPE>(this->m_msgSize);
+  }
+
+  RingQueue::Status RingQueue::push(const U8* buffer, NATIVE_INT_TYPE size) {
+    U64 pos = __atomic_load_n(&this->m_sendCursor.position, __ATOMIC_RELAXED);
+    Slot* slot;
+    while (true) {
+      slot = &this->m_slots[pos % this->m_depth];
+      U64 seq = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+      if (seq == pos) {
+        // slot is free; claim it. On failure pos is reloaded with the current position.
+        if (__atomic_compare_exchange_n(&this->m_sendCursor.position, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+          break;
+        }
+      } else if (seq < pos) {
+        // slot still holds the message from one lap ago. If a receiver
+        // has claimed it the slot is freed once its copy finishes.
+        U64 recv = __atomic_load_n(&this->m_recvCursor.position, __ATOMIC_RELAXED);
+        return (recv > pos - this->m_depth) ? BUSY : NONE;
+      } else {
+        // another sender claimed this position first
+        pos = __atomic_load_n(&this->m_sendCursor.position, __ATOMIC_RELAXED);
+      }
+    }
+
+    (void) memcpy(&this->m_data[static_cast<NATIVE_UINT_TYPE>(slot - this->m_slots) * this->m_msgSize], buffer, static_cast<size_t>(size));
+    __atomic_store_n(&slot->size, size, __ATOMIC_RELAXED);
+#if FW_QUEUE_INSTRUMENTATION
+    IntervalTimer::getRawTime(slot->sent);
+#endif
+    __atomic_store_n(&slot->sequence, pos + 1, __ATOMIC_RELEASE);
+
+    // update high water mark
+    NATIVE_INT_TYPE count = this->getCount();
+#if FW_QUEUE_INSTRUMENTATION
+    if (nullptr != this->m_stats) {
+      this->m_stats->recordDepth(static_cast<U32>(count));
+    }
+#endif
+    NATIVE_INT_TYPE max = __atomic_load_n(&this->m_maxCount, __ATOMIC_RELAXED);
+    while ((count > max) and
+           not __atomic_compare_exchange_n(&this->m_maxCount, &max, count, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+
+    // wake receivers waiting on an empty queue. The fence orders the message
+    // store before the waiter check, so a receiver either sees the message
+    // when it retries or is counted here.
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&this->m_recvCursor.waiters, __ATOMIC_RELAXED) > 0) {
+      (void) __atomic_add_fetch(&this->m_recvCursor.wakeCount, 1, __ATOMIC_SEQ_CST);
+      futexWakeAll(&this->m_recvCursor.wakeCount);
+    }
+    return DONE;
+  }
+
+  RingQueue::Status RingQueue::pop(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE& actualSize) {
+    U64 pos = __atomic_load_n(&this->m_recvCursor.position, __ATOMIC_RELAXED);
+    Slot* slot;
+    while (true) {
+      slot = &this->m_slots[pos % this->m_depth];
+      U64 seq = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+      if (seq == pos + 1) {
+        // leave the message in place if the caller's buffer is too small
+        if (__atomic_load_n(&slot->size, __ATOMIC_RELAXED) > capacity) {
+          return TOO_SMALL;
+        }
+        if (__atomic_compare_exchange_n(&this->m_recvCursor.position, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+          break;
+        }
+      } else if (seq < pos + 1) {
+        // slot has not been filled yet. If a sender has claimed it the
+        // message is available once its copy finishes.
+        U64 send = __atomic_load_n(&this->m_sendCursor.position, __ATOMIC_RELAXED);
+        return (send > pos) ? BUSY : NONE;
+      } else {
+        // another receiver took this message first
+        pos = __atomic_load_n(&this->m_recvCursor.position, __ATOMIC_RELAXED);
+      }
+    }
+
+    actualSize = __atomic_load_n(&slot->size, __ATOMIC_RELAXED);
+    (void) memcpy(buffer, &this->m_data[static_cast<NATIVE_UINT_TYPE>(slot - this->m_slots) * this->m_msgSize], static_cast<size_t>(actualSize));
+#if FW_QUEUE_INSTRUMENTATION
+    if (nullptr != this->m_stats) {
+      IntervalTimer::RawTime now;
+      IntervalTimer::getRawTime(now);
+      this->m_stats->recordWait(IntervalTimer::getDiffUsec(now, slot->sent));
+    }
+#endif
+    // hand the slot to the sender one lap ahead
+    __atomic_store_n(&slot->sequence, pos + this->m_depth, __ATOMIC_RELEASE);
+
+    // wake senders waiting on a full queue. See push().
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&this->m_sendCursor.waiters, __ATOMIC_RELAXED) > 0) {
+      (void) __atomic_add_fetch(&this->m_sendCursor.wakeCount, 1, __ATOMIC_SEQ_CST);
+      futexWakeAll(&this->m_sendCursor.wakeCount);
+    }
+    return DONE;
+  }
+
+  Queue::QueueStatus RingQueue::send(const U8* buffer, NATIVE_INT_TYPE size, Queue::QueueBlocking block) {
+    FW_ASSERT(nullptr != this->m_slots);
+    FW_ASSERT((size >= 0) and (static_cast<NATIVE_UINT_TYPE>(size) <= this->m_msgSize), size);
+
+    Cursor& cursor = this->m_sendCursor;
+    Status status = this->push(buffer, size);
+    while (DONE != status) {
+      if ((NONE == status) and (Queue::QUEUE_NONBLOCKING == block)) {
+        return Queue::QUEUE_FULL;
+      }
+      // Announce the wait and read the wake count before trying again. A receive
+      // that frees a slot after the retry fails then changes the count, so the
+      // wait returns at once or is woken.
+      (void) __atomic_add_fetch(&cursor.waiters, 1, __ATOMIC_SEQ_CST);
+      U32 wakeCount = __atomic_load_n(&cursor.wakeCount, __ATOMIC_SEQ_CST);
+      status = this->push(buffer, size);
+      if ((BUSY == status) or
+          ((NONE == status) and (Queue::QUEUE_BLOCKING == block))) {
+        futexWait(&cursor.wakeCount, wakeCount);
+        status = this->push(buffer, size);
+      }
+      (void) __atomic_sub_fetch(&cursor.waiters, 1, __ATOMIC_SEQ_CST);
+    }
+    return Queue::QUEUE_OK;
+  }
+
+  Queue::QueueStatus RingQueue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE& actualSize, Queue::QueueBlocking block) {
+    FW_ASSERT(nullptr != this->m_slots);
+    FW_ASSERT(capacity >= 0, capacity);
+
+    Cursor& cursor = this->m_recvCursor;
+    Status status = this->pop(buffer, capacity, actualSize);
+    while ((NONE == status) or (BUSY == status)) {
+      if ((NONE == status) and (Queue::QUEUE_NONBLOCKING == block)) {
+        break;
+      }
+      // See send(): announce the wait before the retry so a message sent
+      // after it fails cannot be missed
+      (void) __atomic_add_fetch(&cursor.waiters, 1, __ATOMIC_SEQ_CST);
+      U32 wakeCount = __atomic_load_n(&cursor.wakeCount, __ATOMIC_SEQ_CST);
+      status = this->pop(buffer, capacity, actualSize);
+      if ((BUSY == status) or
+          ((NONE == status) and (Queue::QUEUE_BLOCKING == block))) {
+        futexWait(&cursor.wakeCount, wakeCount);
+        status = this->pop(buffer, capacity, actualSize);
+      }
+      (void) __atomic_sub_fetch(&cursor.waiters, 1, __ATOMIC_SEQ_CST);
+    }
+
+    switch (status) {
+      case DONE:
+        return Queue::QUEUE_OK;
+      case TOO_SMALL:
+        actualSize = 0;
+        return Queue::QUEUE_SIZE_MISMATCH;
+      default:
+        actualSize = 0;
+        return Queue::QUEUE_NO_MORE_MSGS;
+    }
+  }
+
+}
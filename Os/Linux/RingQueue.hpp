@@ -0,0 +1,159 @@
+// ======================================================================
+// \title  RingQueue.hpp
+// \brief  A bounded lock-free ring of fixed message slots.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef OS_LINUX_RING_QUEUE_HPP
+#define OS_LINUX_RING_QUEUE_HPP
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Os/Queue.hpp>
+#include <Os/IntervalTimer.hpp>
+
+namespace Os {
+
+  //! \class RingQueue
+  //! \brief A bounded lock-free ring of fixed message slots
+  //!
+  //! Backs Os::Queue when FPRIME_USE_RING_QUEUE is set. This is NOT an IPC
+  //! queue. It is meant to be used between threads within the same address
+  //! space. Senders and receivers claim slots with a compare-and-swap and
+  //! only enter the kernel (futex) to sleep when the queue is empty or full,
+  //! or for the short time another thread is still copying into or out of
+  //! the slot they need. Messages are delivered in FIFO order.
+  //!
+  class RingQueue {
+    public:
+
+    //! \brief RingQueue constructor
+    //!
+    RingQueue();
+
+    //! \brief RingQueue destructor
+    //!
+    ~RingQueue();
+
+    //! \brief RingQueue creation
+    //!
+    //! Allocate "depth" slots for messages of at most "msgSize" bytes.
+    //! Must be called once, before the queue is shared between threads.
+    //!
+    //! \param depth the maximum number of messages on the queue
+    //! \param msgSize the maximum size of a message
+    //! \return true if the slots were allocated
+    //!
+    bool create(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize);
+
+    //! \brief send a message
+    //!
+    //! Copy a message into the next free slot. When the queue is full a
+    //! blocking send sleeps until a receiver frees a slot.
+    //!
+    //! \param buffer the message to send
+    //! \param size the size of the message, at most the message size
+    //! \param block whether to wait for a free slot
+    //! \return QUEUE_OK, or QUEUE_FULL for a non-blocking send on a full queue
+    //!
+    Queue::QueueStatus send(const U8* buffer, NATIVE_INT_TYPE size, Queue::QueueBlocking block);
+
+    //! \brief receive a message
+    //!
+    //! Copy the oldest message out of the queue. When the queue is empty a
+    //! blocking receive sleeps until a message is sent. A message larger
+    //! than the capacity is left on the queue.
+    //!
+    //! \param buffer the buffer to copy the message into
+    //! \param capacity the size of buffer
+    //! \param actualSize the size of the message received, 0 on failure
+    //! \param block whether to wait for a message
+    //! \return QUEUE_OK, QUEUE_NO_MORE_MSGS for a non-blocking receive on an
+    //! empty queue, or QUEUE_SIZE_MISMATCH if the message does not fit
+    //!
+    Queue::QueueStatus receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE& actualSize, Queue::QueueBlocking block);
+
+    //! \brief Get the current number of messages on the queue
+    //!
+    NATIVE_INT_TYPE getCount() const;
+
+    //! \brief Get the maximum number of messages seen on the queue
+    //!
+    NATIVE_INT_TYPE getMaxCount() const;
+
+    //! \brief Get the maximum number of messages allowed on the queue
+    //!
+    NATIVE_INT_TYPE getDepth() const;
+
+    //! \brief Get the maximum message size
+    //!
+    NATIVE_INT_TYPE getMsgSize() const;
+
+#if FW_QUEUE_INSTRUMENTATION
+    //! \brief Set the statistics updated on each send and receive
+    //!
+    void setStats(QueueStats* stats);
+#endif
+
+    private:
+
+    enum Status {
+      DONE, //!< message pushed or popped
+      NONE, //!< queue full on push, empty on pop
+      BUSY, //!< another thread is still copying the slot; wait for it
+      TOO_SMALL //!< receive buffer is smaller than the message
+    };
+
+    // Keep the send and receive positions on separate cache lines so
+    // senders and the receiver do not invalidate each other's line
+    enum {
+      CACHE_LINE_SIZE = 64
+    };
+
+    // A slot whose sequence equals the send position is free, and a slot
+    // whose sequence is one past the receive position holds a message.
+    struct Slot {
+      U64 sequence;
+      NATIVE_INT_TYPE size;
+#if FW_QUEUE_INSTRUMENTATION
+      IntervalTimer::RawTime sent; //!< time the message was pushed
+#endif
+    };
+
+    // A position and the counter a thread sleeps on when waiting for it to move.
+    // The counter is only advanced when a thread has announced itself in waiters.
+    struct Cursor {
+      U64 position;
+      U32 wakeCount;
+      U32 waiters;
+      U8 pad[CACHE_LINE_SIZE - sizeof(U64) - 2 * sizeof(U32)];
+    };
+
+    // Claim a slot and copy a message into it without waiting
+    Status push(const U8* buffer, NATIVE_INT_TYPE size);
+    // Claim the oldest message and copy it out without waiting
+    Status pop(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE& actualSize);
+
+    // Disallow copying
+    RingQueue(const RingQueue&);
+    RingQueue& operator=(const RingQueue&);
+
+    Cursor m_sendCursor;
+    Cursor m_recvCursor;
+    Slot* m_slots;
+    U8* m_data;
+    U64 m_depth;
+    NATIVE_UINT_TYPE m_msgSize;
+    NATIVE_INT_TYPE m_maxCount;
+#if FW_QUEUE_INSTRUMENTATION
+    QueueStats* m_stats;
+#endif
+  };
+
+}
+
+#endif // OS_LINUX_RING_QUEUE_HPP
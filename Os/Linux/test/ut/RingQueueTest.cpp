@@ -0,0 +1,191 @@
+#include "Os/Linux/RingQueue.hpp"
+#include <Fw/Types/Assert.hpp>
+#include <cstdio>
+#include <cstring>
+#include <pthread.h>
+
+using namespace Os;
+
+#define DEPTH 5
+#define MSG_SIZE 3
+
+// Threaded test: each sender sends MSGS_PER_SENDER messages tagged with its
+// index and a sequence number. Each sender's messages must arrive in order.
+#define SENDERS 4
+#define RECEIVERS 3
+#define MSGS_PER_SENDER 20000
+
+struct Message {
+  U32 sender;
+  U32 sequence;
+};
+
+struct Shared {
+  RingQueue* queue;
+  U32 index;
+  U32 received[SENDERS];
+  U32 last[SENDERS];
+  bool ordered;
+};
+
+static void* sendTask(void* arg) {
+  Shared* shared = static_cast<Shared*>(arg);
+  Message msg;
+  msg.sender = shared->index;
+  for (U32 seq = 1; seq <= MSGS_PER_SENDER; ++seq) {
+    msg.sequence = seq;
+    Queue::QueueStatus stat = shared->queue->send(reinterpret_cast<U8*>(&msg), sizeof(msg), Queue::QUEUE_BLOCKING);
+    FW_ASSERT(stat == Queue::QUEUE_OK, stat);
+  }
+  return nullptr;
+}
+
+static void* recvTask(void* arg) {
+  Shared* shared = static_cast<Shared*>(arg);
+  Message msg;
+  NATIVE_INT_TYPE size;
+  while (true) {
+    Queue::QueueStatus stat = shared->queue->receive(reinterpret_cast<U8*>(&msg), sizeof(msg), size, Queue::QUEUE_BLOCKING);
+    FW_ASSERT(stat == Queue::QUEUE_OK, stat);
+    FW_ASSERT(size == sizeof(msg), size);
+    // a sequence of 0 tells the receiver to stop
+    if (msg.sequence == 0) {
+      break;
+    }
+    FW_ASSERT(msg.sender < SENDERS, msg.sender);
+    // messages of a sender taken by one receiver keep their order
+    if (msg.sequence <= shared->last[msg.sender]) {
+      shared->ordered = false;
+    }
+    shared->last[msg.sender] = msg.sequence;
+    shared->received[msg.sender]++;
+  }
+  return nullptr;
+}
+
+int main() {
+  printf("Creating queue.\n");
+  bool ret;
+  NATIVE_INT_TYPE size;
+  Queue::QueueStatus stat;
+  RingQueue queue;
+  ret = queue.create(DEPTH, MSG_SIZE);
+  FW_ASSERT(ret, ret);
+  FW_ASSERT(queue.getDepth() == DEPTH, queue.getDepth());
+  FW_ASSERT(queue.getMsgSize() == MSG_SIZE, queue.getMsgSize());
+  U8 recv[MSG_SIZE];
+
+  U8 send[MSG_SIZE];
+  for(U32 ii = 0; ii < sizeof(send); ++ii) {
+    send[ii] = ii;
+  }
+
+  printf("Test empty queue...\n");
+  stat = queue.receive(&recv[0], sizeof(recv), size, Queue::QUEUE_NONBLOCKING);
+  FW_ASSERT(stat == Queue::QUEUE_NO_MORE_MSGS, stat);
+  FW_ASSERT(size == 0, size);
+  FW_ASSERT(queue.getCount() == 0, queue.getCount());
+  printf("Passed.\n");
+
+  printf("Test full queue...\n");
+  for(NATIVE_INT_TYPE ii = 0; ii < DEPTH; ++ii) {
+    send[0] = ii;
+    stat = queue.send(&send[0], sizeof(send), Queue::QUEUE_NONBLOCKING);
+    FW_ASSERT(stat == Queue::QUEUE_OK, stat);
+    FW_ASSERT(queue.getCount() == ii + 1, queue.getCount());
+  }
+  stat = queue.send(&send[0], sizeof(send), Queue::QUEUE_NONBLOCKING);
+  FW_ASSERT(stat == Queue::QUEUE_FULL, stat);
+  FW_ASSERT(queue.getCount() == DEPTH, queue.getCount());
+  FW_ASSERT(queue.getMaxCount() == DEPTH, queue.getMaxCount());
+  printf("Passed.\n");
+
+  printf("Test messages come out in the order sent...\n");
+  for(NATIVE_INT_TYPE ii = 0; ii < DEPTH; ++ii) {
+    stat = queue.receive(&recv[0], sizeof(recv), size, Queue::QUEUE_NONBLOCKING);
+    FW_ASSERT(stat == Queue::QUEUE_OK, stat);
+    FW_ASSERT(size == sizeof(send), size);
+    FW_ASSERT(recv[0] == ii, recv[0]);
+    FW_ASSERT(memcmp(&recv[1], &send[1], sizeof(send) - 1) == 0);
+  }
+  FW_ASSERT(queue.getCount() == 0, queue.getCount());
+  printf("Passed.\n");
+
+  printf("Test wrapping around the ring several times...\n");
+  for(NATIVE_INT_TYPE ii = 0; ii < 4 * DEPTH + 1; ++ii) {
+    send[0] = ii;
+    stat = queue.send(&send[0], static_cast<NATIVE_INT_TYPE>(ii % (MSG_SIZE + 1)), Queue::QUEUE_NONBLOCKING);
+    FW_ASSERT(stat == Queue::QUEUE_OK, stat);
+    stat = queue.receive(&recv[0], sizeof(recv), size, Queue::QUEUE_NONBLOCKING);
+    FW_ASSERT(stat == Queue::QUEUE_OK, stat);
+    FW_ASSERT(size == ii % (MSG_SIZE + 1), size);
+    FW_ASSERT((size == 0) or (recv[0] == ii), recv[0]);
+  }
+  FW_ASSERT(queue.getMaxCount() == DEPTH, queue.getMaxCount());
+  printf("Passed.\n");
+
+  printf("Test a message larger than the receive buffer stays queued...\n");
+  send[0] = 42;
+  stat = queue.send(&send[0], sizeof(send), Queue::QUEUE_NONBLOCKING);
+  FW_ASSERT(stat == Queue::QUEUE_OK, stat);
+  stat = queue.receive(&recv[0], sizeof(recv) - 1, size, Queue::QUEUE_NONBLOCKING);
+  FW_ASSERT(stat == Queue::QUEUE_SIZE_MISMATCH, stat);
+  FW_ASSERT(size == 0, size);
+  FW_ASSERT(queue.getCount() == 1, queue.getCount());
+  stat = queue.receive(&recv[0], sizeof(recv), size, Queue::QUEUE_NONBLOCKING);
+  FW_ASSERT(stat == Queue::QUEUE_OK, stat);
+  FW_ASSERT(recv[0] == 42, recv[0]);
+  printf("Passed.\n");
+
+  printf("Test several blocking senders and receivers...\n");
+  Shared senders[SENDERS];
+  Shared receivers[RECEIVERS];
+  pthread_t sendThreads[SENDERS];
+  pthread_t recvThreads[RECEIVERS];
+  RingQueue shared;
+  ret = shared.create(DEPTH, sizeof(Message));
+  FW_ASSERT(ret, ret);
+  for (U32 ii = 0; ii < RECEIVERS; ++ii) {
+    memset(&receivers[ii], 0, sizeof(receivers[ii]));
+    receivers[ii].queue = &shared;
+    receivers[ii].ordered = true;
+    NATIVE_INT_TYPE err = pthread_create(&recvThreads[ii], nullptr, recvTask, &receivers[ii]);
+    FW_ASSERT(err == 0, err);
+  }
+  for (U32 ii = 0; ii < SENDERS; ++ii) {
+    memset(&senders[ii], 0, sizeof(senders[ii]));
+    senders[ii].queue = &shared;
+    senders[ii].index = ii;
+    NATIVE_INT_TYPE err = pthread_create(&sendThreads[ii], nullptr, sendTask, &senders[ii]);
+    FW_ASSERT(err == 0, err);
+  }
+  for (U32 ii = 0; ii < SENDERS; ++ii) {
+    NATIVE_INT_TYPE err = pthread_join(sendThreads[ii], nullptr);
+    FW_ASSERT(err == 0, err);
+  }
+  Message stop = {0, 0};
+  for (U32 ii = 0; ii < RECEIVERS; ++ii) {
+    stat = shared.send(reinterpret_cast<U8*>(&stop), sizeof(stop), Queue::QUEUE_BLOCKING);
+    FW_ASSERT(stat == Queue::QUEUE_OK, stat);
+  }
+  for (U32 ii = 0; ii < RECEIVERS; ++ii) {
+    NATIVE_INT_TYPE err = pthread_join(recvThreads[ii], nullptr);
+    FW_ASSERT(err == 0, err);
+  }
+  for (U32 sender = 0; sender < SENDERS; ++sender) {
+    U32 total = 0;
+    for (U32 ii = 0; ii < RECEIVERS; ++ii) {
+      total += receivers[ii].received[sender];
+    }
+    FW_ASSERT(total == MSGS_PER_SENDER, total);
+  }
+  for (U32 ii = 0; ii < RECEIVERS; ++ii) {
+    FW_ASSERT(receivers[ii].ordered, ii);
+  }
+  FW_ASSERT(shared.getCount() == 0, shared.getCount());
+  FW_ASSERT(shared.getMaxCount() <= DEPTH, shared.getMaxCount());
+  printf("Passed.\n");
+
+  printf("Test completed.\n");
+  return 0;
+}
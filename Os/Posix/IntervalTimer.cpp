@@ -5,6 +5,10 @@
  * implementations. That is: the lower U32 of the RawTime is nano-seconds, and the upper U32 of
  * RawTime object is seconds. Thus only the "getRawTime" function differs from the base X86
  * version of this file.
+ *
+ * The monotonic clock is read so that setting the system time does not skew or reverse intervals.
+ * Raw times are only ever subtracted from one another, never taken as a time of day, so users do
+ * not depend on which clock is read.
  */
 #include <Os/IntervalTimer.hpp>
 #include <Fw/Types/Assert.hpp>
@@ -15,7 +19,7 @@ namespace Os {
     void IntervalTimer::getRawTime(RawTime& time) {
         timespec t;
 
-        FW_ASSERT(clock_gettime(CLOCK_REALTIME,&t) == 0,errno);
+        FW_ASSERT(clock_gettime(CLOCK_MONOTONIC,&t) == 0,errno);
         time.upper = t.tv_sec;
         time.lower = t.tv_nsec;
     }
@@ -158,6 +158,11 @@ namespace Os {
                 }
             } else {
                 keepTrying=false;
+#if FW_QUEUE_INSTRUMENTATION
+                // Only the depth is recorded. Timing the wait would need the send time stored in each message,
+                // and mq_send offers no place for it other than a copy of the message per sender.
+                this->m_stats.recordDepth(this->getNumMsgs());
+#endif
                 // Wake up a thread that might be waiting on the other end of the queue:
                 ret = pthread_cond_signal(queueNotEmpty);
                 FW_ASSERT(ret == 0, ret); // If this fails, something horrible happened.
@@ -230,6 +235,24 @@ namespace Os {
         return QUEUE_OK;
     }
 
+    Queue::QueueStatus Queue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE maxMsgs, NATIVE_INT_TYPE* actualSizes, NATIVE_INT_TYPE* priorities, NATIVE_INT_TYPE &numMsgs, QueueBlocking block) {
+        numMsgs = 0;
+        FW_ASSERT(maxMsgs > 0, maxMsgs);
+        FW_ASSERT(actualSizes != nullptr);
+        FW_ASSERT(priorities != nullptr);
+        // Only the first receive may block, the rest take what is already queued. The receives are called
+        // on this class so that a derived queue (e.g. Fw::ComponentQueue) does not take them from its batch.
+        QueueStatus status = Queue::receive(buffer, capacity, actualSizes[0], priorities[0], block);
+        while (QUEUE_OK == status) {
+            ++numMsgs;
+            if (numMsgs == maxMsgs) {
+                break;
+            }
+            status = Queue::receive(&buffer[numMsgs * capacity], capacity, actualSizes[numMsgs], priorities[numMsgs], QUEUE_NONBLOCKING);
+        }
+        return (numMsgs > 0) ? QUEUE_OK : status;
+    }
+
     NATIVE_INT_TYPE Queue::getNumMsgs() const {
         QueueHandle* queueHandle = reinterpret_cast<QueueHandle*>(this->m_handle);
         mqd_t handle = queueHandle->handle;
@@ -15,8 +15,10 @@
 #include <Os/Pthreads/BufferQueue.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Os/Queue.hpp>
+#include <Os/IntervalTimer.hpp>
 
 #include <cerrno>
+#include <cstring>
 #include <pthread.h>
 #include <cstdio>
 #include <new>
@@ -41,10 +43,71 @@ namespace Os {
       (void) pthread_cond_destroy(&this->queueNotEmpty);
       (void) pthread_cond_destroy(&this->queueNotFull);
       (void) pthread_mutex_destroy(&this->queueLock);
+#if FW_QUEUE_INSTRUMENTATION
+      delete[] this->scratch;
+#endif
+    }
+#if FW_QUEUE_INSTRUMENTATION
+    // Each message is stored behind the time it was sent, so that the receiver
+    // can record how long it waited. The stamped message is assembled in, and
+    // taken apart from, a scratch buffer that is only used under the queue lock.
+    bool create(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+      delete[] this->scratch;
+      this->scratch = new(std::nothrow) U8[msgSize + STAMP_SIZE];
+      if (nullptr == this->scratch) {
+        return false;
+      }
+      return queue.create(depth, msgSize + STAMP_SIZE);
+    }
+    bool push(const U8* buffer, NATIVE_UINT_TYPE size, NATIVE_INT_TYPE priority) {
+      IntervalTimer::RawTime now;
+      IntervalTimer::getRawTime(now);
+      (void) memcpy(this->scratch, &now, STAMP_SIZE);
+      (void) memcpy(&this->scratch[STAMP_SIZE], buffer, size);
+      if (!queue.push(this->scratch, size + STAMP_SIZE, priority)) {
+        return false;
+      }
+      FW_ASSERT(this->stats != nullptr);
+      this->stats->recordDepth(queue.getCount());
+      return true;
+    }
+    bool pop(U8* buffer, NATIVE_UINT_TYPE& size, NATIVE_INT_TYPE& priority) {
+      NATIVE_UINT_TYPE stampedSize = size + STAMP_SIZE;
+      if (!queue.pop(this->scratch, stampedSize, priority)) {
+        // size is 0 when empty, otherwise the size of the message that did not fit
+        size = (stampedSize > STAMP_SIZE) ? stampedSize - STAMP_SIZE : 0;
+        return false;
+      }
+      IntervalTimer::RawTime sent;
+      IntervalTimer::RawTime now;
+      (void) memcpy(&sent, this->scratch, STAMP_SIZE);
+      size = stampedSize - STAMP_SIZE;
+      (void) memcpy(buffer, &this->scratch[STAMP_SIZE], size);
+      IntervalTimer::getRawTime(now);
+      FW_ASSERT(this->stats != nullptr);
+      this->stats->recordWait(IntervalTimer::getDiffUsec(now, sent));
+      return true;
+    }
+    NATIVE_UINT_TYPE getMsgSize() {
+      return queue.getMsgSize() - STAMP_SIZE;
     }
+    static const NATIVE_UINT_TYPE STAMP_SIZE = sizeof(IntervalTimer::RawTime);
+    U8* scratch = nullptr;
+    QueueStats* stats = nullptr;
+#else
     bool create(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
       return queue.create(depth, msgSize);
     }
+    bool push(const U8* buffer, NATIVE_UINT_TYPE size, NATIVE_INT_TYPE priority) {
+      return queue.push(buffer, size, priority);
+    }
+    bool pop(U8* buffer, NATIVE_UINT_TYPE& size, NATIVE_INT_TYPE& priority) {
+      return queue.pop(buffer, size, priority);
+    }
+    NATIVE_UINT_TYPE getMsgSize() {
+      return queue.getMsgSize();
+    }
+#endif
     BufferQueue queue;
     pthread_cond_t queueNotEmpty;
     pthread_cond_t queueNotFull;
@@ -69,6 +132,9 @@ namespace Os {
     if (nullptr == queueHandle) {
       return QUEUE_UNINITIALIZED;
     }
+#if FW_QUEUE_INSTRUMENTATION
+    queueHandle->stats = &this->m_stats;
+#endif
     if( !queueHandle->create(depth, msgSize) ) {
       return QUEUE_UNINITIALIZED;
     }
@@ -84,6 +150,11 @@ namespace Os {
   }
 
   Queue::~Queue() {
+#if FW_QUEUE_REGISTRATION
+    if (this->s_queueRegistry) {
+        this->s_queueRegistry->unregQueue(this);
+    }
+#endif
     // Clean up the queue handle:
     QueueHandle* queueHandle = reinterpret_cast<QueueHandle*>(this->m_handle);
     if (nullptr != queueHandle) {
@@ -94,7 +165,6 @@ namespace Os {
 
   Queue::QueueStatus sendNonBlock(QueueHandle* queueHandle, const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority) {
 
-    BufferQueue* queue = &queueHandle->queue;
     pthread_cond_t* queueNotEmpty = &queueHandle->queueNotEmpty;
     pthread_mutex_t* queueLock = &queueHandle->queueLock;
     NATIVE_INT_TYPE ret;
@@ -108,7 +178,7 @@ namespace Os {
     ///////////////////////////////
 
     // Push item onto queue:
-    bool pushSucceeded = queue->push(buffer, size, priority);
+    bool pushSucceeded = queueHandle->push(buffer, size, priority);
 
     if(pushSucceeded) {
       // Push worked - wake up a thread that might be waiting on
@@ -152,7 +222,7 @@ namespace Os {
     }
 
     // Push item onto queue:
-    bool pushSucceeded = queue->push(buffer, size, priority);
+    bool pushSucceeded = queueHandle->push(buffer, size, priority);
 
     // The only reason push would not succeed is if the queue
     // was full. Since we waited for the queue to NOT be full
@@ -178,7 +248,6 @@ namespace Os {
   Queue::QueueStatus Queue::send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority, QueueBlocking block) {
     (void) block; // Always non-blocking for now
     QueueHandle* queueHandle = reinterpret_cast<QueueHandle*>(this->m_handle);
-    BufferQueue* queue = &queueHandle->queue;
 
     if (nullptr == queueHandle) {
         return QUEUE_UNINITIALIZED;
@@ -188,7 +257,7 @@ namespace Os {
         return QUEUE_EMPTY_BUFFER;
     }
 
-    if (size < 0 || static_cast<NATIVE_UINT_TYPE>(size) > queue->getMsgSize()) {
+    if (size < 0 || static_cast<NATIVE_UINT_TYPE>(size) > queueHandle->getMsgSize()) {
         return QUEUE_SIZE_MISMATCH;
     }
 
@@ -201,7 +270,6 @@ namespace Os {
 
   Queue::QueueStatus receiveNonBlock(QueueHandle* queueHandle, U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority) {
 
-      BufferQueue* queue = &queueHandle->queue;
       pthread_mutex_t* queueLock = &queueHandle->queueLock;
       pthread_cond_t* queueNotFull = &queueHandle->queueNotFull;
       NATIVE_INT_TYPE ret;
@@ -218,7 +286,7 @@ namespace Os {
       ///////////////////////////////
 
       // Get an item off of the queue:
-      bool popSucceeded = queue->pop(buffer, size, pri);
+      bool popSucceeded = queueHandle->pop(buffer, size, pri);
 
       if(popSucceeded) {
         // Pop worked - set the return size and priority:
@@ -281,7 +349,7 @@ namespace Os {
       }
 
       // Get an item off of the queue:
-      bool popSucceeded = queue->pop(buffer, size, pri);
+      bool popSucceeded = queueHandle->pop(buffer, size, pri);
 
       if(popSucceeded) {
         // Pop worked - set the return size and priority:
@@ -341,6 +409,84 @@ namespace Os {
       return receiveBlock(queueHandle, buffer, capacity, actualSize, priority);
   }
 
+  Queue::QueueStatus Queue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE maxMsgs, NATIVE_INT_TYPE* actualSizes, NATIVE_INT_TYPE* priorities, NATIVE_INT_TYPE &numMsgs, QueueBlocking block) {
+
+      numMsgs = 0;
+
+      QueueHandle* queueHandle = reinterpret_cast<QueueHandle*>(this->m_handle);
+
+      if (nullptr == queueHandle) {
+        return QUEUE_UNINITIALIZED;
+      }
+
+      if (capacity < 0) {
+          return QUEUE_SIZE_MISMATCH;
+      }
+
+      FW_ASSERT(maxMsgs > 0, maxMsgs);
+      FW_ASSERT(actualSizes != nullptr);
+      FW_ASSERT(priorities != nullptr);
+
+      BufferQueue* queue = &queueHandle->queue;
+      pthread_cond_t* queueNotEmpty = &queueHandle->queueNotEmpty;
+      pthread_cond_t* queueNotFull = &queueHandle->queueNotFull;
+      pthread_mutex_t* queueLock = &queueHandle->queueLock;
+      NATIVE_INT_TYPE ret;
+
+      NATIVE_UINT_TYPE size = 0;
+      Queue::QueueStatus status = Queue::QUEUE_OK;
+
+      ////////////////////////////////
+      // Locked Section
+      ///////////////////////////////
+      ret = pthread_mutex_lock(queueLock);
+      FW_ASSERT(ret == 0, errno);
+      ///////////////////////////////
+
+      // If blocking, wait until a message is put on the queue:
+      while( (QUEUE_BLOCKING == block) && queue->isEmpty() ) {
+        NATIVE_INT_TYPE ret = pthread_cond_wait(queueNotEmpty, queueLock);
+        FW_ASSERT(ret == 0, errno);
+      }
+
+      // Take messages until the queue is empty, the batch is full, or
+      // the next message does not fit:
+      while( numMsgs < maxMsgs ) {
+        size = static_cast<NATIVE_UINT_TYPE>(capacity);
+        NATIVE_INT_TYPE pri = 0;
+        if( !queueHandle->pop(&buffer[numMsgs * capacity], size, pri) ) {
+          break;
+        }
+        actualSizes[numMsgs] = static_cast<NATIVE_INT_TYPE>(size);
+        priorities[numMsgs] = pri;
+        ++numMsgs;
+      }
+
+      if( numMsgs > 0 ) {
+        // Several slots may have been freed - wake up every thread that
+        // might be waiting on the send end of the queue:
+        NATIVE_INT_TYPE ret = pthread_cond_broadcast(queueNotFull);
+        FW_ASSERT(ret == 0, errno); // If this fails, something horrible happened.
+      }
+      else if( size > static_cast<NATIVE_UINT_TYPE>(capacity) ) {
+        // The buffer capacity was too small!
+        status = Queue::QUEUE_SIZE_MISMATCH;
+      }
+      else {
+        // The queue is empty:
+        FW_ASSERT(QUEUE_NONBLOCKING == block);
+        status = Queue::QUEUE_NO_MORE_MSGS;
+      }
+
+      ///////////////////////////////
+      ret = pthread_mutex_unlock(queueLock);
+      FW_ASSERT(ret == 0, errno);
+      ////////////////////////////////
+      ///////////////////////////////
+
+      return status;
+  }
+
   NATIVE_INT_TYPE Queue::getNumMsgs() const {
       QueueHandle* queueHandle = reinterpret_cast<QueueHandle*>(this->m_handle);
       if (nullptr == queueHandle) {
@@ -373,8 +519,7 @@ namespace Os {
       if (nullptr == queueHandle) {
           return 0;
       }
-      BufferQueue* queue = &queueHandle->queue;
-      return queue->getMsgSize();
+      return queueHandle->getMsgSize();
   }
 
 }
@@ -16,6 +16,7 @@
 #include <Fw/Obj/ObjBase.hpp>
 #include <Fw/Types/Serializable.hpp>
 #include <Os/QueueString.hpp>
+#include <Os/QueueStats.hpp>
 
 namespace Os {
     // forward declaration for registry
@@ -44,7 +45,10 @@ namespace Os {
 
             Queue();
             virtual ~Queue();
-            QueueStatus create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize); //!<  create a message queue
+            virtual QueueStatus create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize); //!<  create a message queue
+
+            // Raw receives and the message count are virtual so queues built on this one (e.g. Fw::ComponentQueue)
+            // can hold messages of their own. Serialized receives go through the raw receive.
 
             // Send serialized buffers
             QueueStatus send(const Fw::SerializeBufferBase &buffer, NATIVE_INT_TYPE priority, QueueBlocking block); //!<  send a message
@@ -52,9 +56,15 @@ namespace Os {
 
             // Send raw buffers
             QueueStatus send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority, QueueBlocking block); //!<  send a message
-            QueueStatus receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block); //!<  receive a message
+            virtual QueueStatus receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block); //!<  receive a message
+
+            //! Receive up to maxMsgs messages in one call. Message i is stored at buffer + i * capacity, with its size
+            //! and priority in actualSizes[i] and priorities[i]. A blocking receive waits for the first message only,
+            //! then takes whatever else is already queued.
+            //! \return QUEUE_OK with numMsgs >= 1, or the status of receiving the first message
+            QueueStatus receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE maxMsgs, NATIVE_INT_TYPE* actualSizes, NATIVE_INT_TYPE* priorities, NATIVE_INT_TYPE &numMsgs, QueueBlocking block); //!<  receive a batch of messages
 
-            NATIVE_INT_TYPE getNumMsgs() const; //!< get the number of messages in the queue
+            virtual NATIVE_INT_TYPE getNumMsgs() const; //!< get the number of messages in the queue
             NATIVE_INT_TYPE getMaxMsgs() const; //!< get the maximum number of messages (high watermark)
             NATIVE_INT_TYPE getQueueSize() const; //!< get the queue depth (maximum number of messages queue can hold)
             NATIVE_INT_TYPE getMsgSize() const; //!< get the message size (maximum message size queue can hold)
@@ -62,6 +72,11 @@ namespace Os {
             static NATIVE_INT_TYPE getNumQueues(); //!< get the number of queues in the system
 #if FW_QUEUE_REGISTRATION
             static void setQueueRegistry(QueueRegistry* reg); // !< set the queue registry
+            static QueueRegistry* getQueueRegistry(); // !< get the queue registry, nullptr when none is set
+#endif
+#if FW_QUEUE_INSTRUMENTATION
+            const QueueStats& getStats() const; //!< get the wait time, dispatch time and depth histograms
+            void resetStats(); //!< clear the histograms
 #endif
 
         protected:
@@ -78,6 +93,9 @@ namespace Os {
             static QueueRegistry* s_queueRegistry; //!< pointer to registry
 #endif
             static NATIVE_INT_TYPE s_numQueues; //!< tracks number of queues in the system
+#if FW_QUEUE_INSTRUMENTATION
+            QueueStats m_stats; //!< histograms recorded by the implementation and the receiver
+#endif
 
         private:
             Queue(Queue&); //!<  Disabled copy constructor
@@ -87,6 +105,8 @@ namespace Os {
     class QueueRegistry {
         public:
             virtual void regQueue(Queue* obj)=0; //!< method called by queue init() methods to register a new queue
+            virtual void unregQueue(Queue*) {}; //!< method called by queue destructors to remove a queue
+            virtual void dump() {}; //!< report the registered queues and their statistics, if the registry can
             virtual ~QueueRegistry() {}; //!< virtual destructor for registry object
     };
 }
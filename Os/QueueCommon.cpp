@@ -41,6 +41,8 @@ namespace Os {
     Queue::QueueStatus Queue::create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
         FW_ASSERT(depth > 0, depth);
         FW_ASSERT(msgSize > 0, depth);
+        // implementations may replace the name with one of their own
+        this->m_name = name;
         return createInternal(name, depth, msgSize);
     }
 
@@ -52,6 +54,22 @@ namespace Os {
         Queue::s_queueRegistry = reg;
     }
 
+    QueueRegistry* Queue::getQueueRegistry() {
+        return Queue::s_queueRegistry;
+    }
+
+#endif
+
+#if FW_QUEUE_INSTRUMENTATION
+
+    const QueueStats& Queue::getStats() const {
+        return this->m_stats;
+    }
+
+    void Queue::resetStats() {
+        this->m_stats.reset();
+    }
+
 #endif
 
     NATIVE_INT_TYPE Queue::getNumQueues() {
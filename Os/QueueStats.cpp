@@ -0,0 +1,72 @@
+#include <Os/QueueStats.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <cstring>
+
+#if FW_QUEUE_INSTRUMENTATION
+
+namespace Os {
+
+    QueueStats::QueueStats() {
+        this->reset();
+    }
+
+    void QueueStats::reset() {
+        memset(&this->m_wait, 0, sizeof(this->m_wait));
+        memset(&this->m_dispatch, 0, sizeof(this->m_dispatch));
+        memset(&this->m_depth, 0, sizeof(this->m_depth));
+    }
+
+    void QueueStats::recordWait(U32 usec) {
+        record(this->m_wait, usec);
+    }
+
+    void QueueStats::recordDispatch(U32 usec) {
+        record(this->m_dispatch, usec);
+    }
+
+    void QueueStats::recordDepth(U32 depth) {
+        record(this->m_depth, depth);
+    }
+
+    const QueueStats::Histogram& QueueStats::getWait() const {
+        return this->m_wait;
+    }
+
+    const QueueStats::Histogram& QueueStats::getDispatch() const {
+        return this->m_dispatch;
+    }
+
+    const QueueStats::Histogram& QueueStats::getDepth() const {
+        return this->m_depth;
+    }
+
+    NATIVE_UINT_TYPE QueueStats::getBin(U32 value) {
+        // number of significant bits
+        NATIVE_UINT_TYPE bin = 0;
+        while ((value != 0) and (bin < NUM_BINS - 1)) {
+            value >>= 1;
+            bin++;
+        }
+        return bin;
+    }
+
+    U32 QueueStats::getBinLimit(NATIVE_UINT_TYPE bin) {
+        FW_ASSERT(bin < NUM_BINS, bin);
+        if (bin == NUM_BINS - 1) {
+            return 0;
+        }
+        return static_cast<U32>(1) << bin;
+    }
+
+    void QueueStats::record(Histogram& histogram, U32 value) {
+        (void) __atomic_fetch_add(&histogram.bins[getBin(value)], 1, __ATOMIC_RELAXED);
+        (void) __atomic_fetch_add(&histogram.count, 1, __ATOMIC_RELAXED);
+        U32 max = __atomic_load_n(&histogram.max, __ATOMIC_RELAXED);
+        while ((value > max) and
+               not __atomic_compare_exchange_n(&histogram.max, &max, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        }
+    }
+
+}
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ * QueueStats.hpp:
+ *
+ * Histograms of how long messages wait in a queue, how long the receiver takes to dispatch each
+ * one, and how deep the queue is when a message is sent. Bins are powers of two: bin 0 holds the
+ * value 0, bin n holds values in [2^(n-1), 2^n), and the last bin holds everything larger. Times
+ * are in microseconds.
+ *
+ * Queues keep a QueueStats when FW_QUEUE_INSTRUMENTATION is set. Counters may be updated from
+ * several sending threads at once, so they are updated atomically. The pthread, ring and baremetal
+ * queues record every histogram. The POSIX message queue (Os/Posix/Queue.cpp) records only depth,
+ * since its messages have no room for the send time.
+ */
+#ifndef _QueueStats_hpp_
+#define _QueueStats_hpp_
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <FpConfig.hpp>
+
+#if FW_QUEUE_INSTRUMENTATION
+
+namespace Os {
+
+    class QueueStats {
+        public:
+            enum {
+                NUM_BINS = FW_QUEUE_STATS_NUM_BINS //!< number of histogram bins
+            };
+
+            struct Histogram {
+                U32 bins[NUM_BINS]; //!< number of samples in each bin
+                U32 count; //!< total number of samples
+                U32 max; //!< largest sample
+            };
+
+            QueueStats(); //!< Constructor
+            void reset(); //!< clear all histograms
+
+            void recordWait(U32 usec); //!< record the time a message spent in the queue
+            void recordDispatch(U32 usec); //!< record the time spent dispatching a message
+            void recordDepth(U32 depth); //!< record the number of messages queued after a send
+
+            const Histogram& getWait() const; //!< wait time histogram
+            const Histogram& getDispatch() const; //!< dispatch time histogram
+            const Histogram& getDepth() const; //!< queue depth histogram
+
+            static NATIVE_UINT_TYPE getBin(U32 value); //!< bin that holds a value
+            static U32 getBinLimit(NATIVE_UINT_TYPE bin); //!< smallest value of the next bin; 0 for the last bin
+
+        PRIVATE:
+            static void record(Histogram& histogram, U32 value);
+
+            Histogram m_wait;
+            Histogram m_dispatch;
+            Histogram m_depth;
+    };
+}
+
+#endif // FW_QUEUE_INSTRUMENTATION
+
+#endif
@@ -5,22 +5,106 @@
  *      Author: tcanham
  */
 
+#include <Os/SimpleQueueRegistry.hpp>
+
 #if FW_QUEUE_REGISTRATION
 
-#include <Os/SimpleQueueRegistry.hpp>
+#include <Fw/Logger/Logger.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <cstring>
 
 namespace Os {
 
     SimpleQueueRegistry::SimpleQueueRegistry() {
+        Queue::setQueueRegistry(this);
+        this->m_numEntries = 0;
+        for (NATIVE_INT_TYPE entry = 0; entry < FW_QUEUE_SIMPLE_QUEUE_ENTRIES; entry++) {
+            this->m_queuePtrArray[entry] = nullptr;
+        }
     }
 
     SimpleQueueRegistry::~SimpleQueueRegistry() {
+        Queue::setQueueRegistry(nullptr);
     }
 
     void SimpleQueueRegistry::regQueue(Queue* obj) {
+        FW_ASSERT(obj != nullptr);
+        // a queue that is created again registers again
+        for (NATIVE_INT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            if (this->m_queuePtrArray[entry] == obj) {
+                return;
+            }
+        }
+        FW_ASSERT(this->m_numEntries < FW_QUEUE_SIMPLE_QUEUE_ENTRIES, this->m_numEntries);
+        this->m_queuePtrArray[this->m_numEntries++] = obj;
+    }
+
+    void SimpleQueueRegistry::unregQueue(Queue* obj) {
+        FW_ASSERT(obj != nullptr);
+        for (NATIVE_INT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            if (this->m_queuePtrArray[entry] == obj) {
+                // keep the remaining queues in registration order
+                for (NATIVE_INT_TYPE next = entry + 1; next < this->m_numEntries; next++) {
+                    this->m_queuePtrArray[next - 1] = this->m_queuePtrArray[next];
+                }
+                this->m_queuePtrArray[--this->m_numEntries] = nullptr;
+                return;
+            }
+        }
     }
 
     void SimpleQueueRegistry::dump() {
+        for (NATIVE_INT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            dumpQueue(this->m_queuePtrArray[entry]);
+        }
+    }
+
+    void SimpleQueueRegistry::dump(const char* queueName) {
+        FW_ASSERT(queueName != nullptr);
+        for (NATIVE_INT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            if (strncmp(queueName, this->m_queuePtrArray[entry]->getName().toChar(), FW_QUEUE_NAME_MAX_SIZE) == 0) {
+                dumpQueue(this->m_queuePtrArray[entry]);
+            }
+        }
+    }
+
+    NATIVE_INT_TYPE SimpleQueueRegistry::getNumQueues() const {
+        return this->m_numEntries;
+    }
+
+    Queue* SimpleQueueRegistry::getQueue(NATIVE_INT_TYPE entry) const {
+        FW_ASSERT((entry >= 0) and (entry < this->m_numEntries), entry);
+        return this->m_queuePtrArray[entry];
+    }
+
+#if FW_QUEUE_INSTRUMENTATION
+    static void dumpHistogram(const char* title, const char* units, const QueueStats::Histogram& histogram) {
+        Fw::Logger::logMsg("  %s: count %u max %u%s\n", reinterpret_cast<POINTER_CAST>(title),
+                histogram.count, histogram.max, reinterpret_cast<POINTER_CAST>(units));
+        for (NATIVE_UINT_TYPE bin = 0; bin < QueueStats::NUM_BINS; bin++) {
+            if (histogram.bins[bin] == 0) {
+                continue;
+            }
+            U32 limit = QueueStats::getBinLimit(bin);
+            if (limit != 0) {
+                Fw::Logger::logMsg("    < %u: %u\n", limit, histogram.bins[bin]);
+            } else {
+                Fw::Logger::logMsg("    >= %u: %u\n", QueueStats::getBinLimit(bin - 1), histogram.bins[bin]);
+            }
+        }
+    }
+#endif
+
+    void SimpleQueueRegistry::dumpQueue(Queue* queue) {
+        Fw::Logger::logMsg("Queue: %s Msgs: %d Depth: %d High water: %d\n",
+                reinterpret_cast<POINTER_CAST>(queue->getName().toChar()),
+                queue->getNumMsgs(), queue->getQueueSize(), queue->getMaxMsgs());
+#if FW_QUEUE_INSTRUMENTATION
+        const QueueStats& stats = queue->getStats();
+        dumpHistogram("Wait", " us", stats.getWait());
+        dumpHistogram("Dispatch", " us", stats.getDispatch());
+        dumpHistogram("Depth", "", stats.getDepth());
+#endif
     }
 
 } /* namespace Os */
@@ -8,7 +8,9 @@
  * it registers itself with the setQueueRegistry() static method. When
  * queues in the system are instantiated, they will register themselves.
  * The registry can then query the instances about their names, sizes,
- * and high watermarks.
+ * and high watermarks. When FW_QUEUE_INSTRUMENTATION is set, the dump
+ * also lists each queue's wait time, dispatch time and depth histograms.
+ * Queues remove themselves from the registry when they are destroyed.
  *
  * \copyright
  * Copyright 2013-2016, by the California Institute of Technology.
@@ -20,6 +22,8 @@
 #ifndef SIMPLEQUEUEREGISTRY_HPP_
 #define SIMPLEQUEUEREGISTRY_HPP_
 
+#include <FpConfig.hpp>
+
 #if FW_QUEUE_REGISTRATION
 
 #include <Os/Queue.hpp>
@@ -31,7 +35,17 @@ namespace Os {
             SimpleQueueRegistry(); //!< constructor
             virtual ~SimpleQueueRegistry(); //!< destructor
             void regQueue(Queue* obj); //!< method called by queue init() methods to register a new queue
-            void dump(); //!< dump list of queues and stats
+            void unregQueue(Queue* obj) override; //!< method called by queue destructors to remove a queue
+            void dump() override; //!< dump list of queues and stats
+            void dump(const char* queueName); //!< dump stats of the named queue
+            NATIVE_INT_TYPE getNumQueues() const; //!< number of registered queues
+            Queue* getQueue(NATIVE_INT_TYPE entry) const; //!< registered queue at an entry
+
+        PRIVATE:
+            static void dumpQueue(Queue* queue); //!< dump one queue
+
+            Queue* m_queuePtrArray[FW_QUEUE_SIMPLE_QUEUE_ENTRIES]; //!< registered queues
+            NATIVE_INT_TYPE m_numEntries; //!< number of registered queues
     };
 
 } /* namespace Os */
@@ -58,6 +58,10 @@ namespace Os {
         Status createValidation(const char* fileName, const char* hashFileName);   //!< Create a validation of the file 'fileName' and store it in
                                                                                              //!< in a file 'hashFileName'
 
+        // hash already computed, e.g. while the file was written
+        Status writeValidation(const char* hashFileName, const Utils::HashBuffer &hashBuffer); //!< Store the hash 'hashBuffer' of a file
+                                                                                               //!< in a file 'hashFileName'
+
     }
 }
 
@@ -225,4 +225,14 @@ namespace Os {
         return createValidation(fileName, hashFileName, hashBuffer);
     }
 
+    ValidateFile::Status ValidateFile::writeValidation(const char* hashFileName, const Utils::HashBuffer &hashBuffer) {
+
+        const File::Status status = writeHash(hashFileName, hashBuffer);
+        if( File::OP_OK != status ) {
+            return translateStatus(status, HashFileType);
+        }
+
+        return ValidateFile::VALIDATION_OK;
+    }
+
 }
@@ -39,6 +39,13 @@ namespace Os {
       //! \return Status
       Os::ValidateFile::Status createHashFile();
 
+      //! Create the hash file from a hash computed while writing the file,
+      //! without reading the file back
+      //! \return Status
+      Os::ValidateFile::Status createHashFile(
+          const Utils::HashBuffer& hashBuffer //!< The hash of the file
+      );
+
     public:
 
       //! Get the file name
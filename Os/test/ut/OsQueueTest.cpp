@@ -16,7 +16,11 @@
 
 // Set this to 1 if testing a priority queue
 // Set this to 0 if testing a fifo queue
+#ifdef OS_RING_QUEUE
+#define PRIORITY_QUEUE 0
+#else
 #define PRIORITY_QUEUE 1
+#endif
 
 enum {
         SER_BUFFER_SIZE = 100,
@@ -120,6 +124,8 @@ void drainQueue(Os::Queue* queue) {
 extern "C" {
     void qtest_block_receive();
     void qtest_nonblock_receive();
+    void qtest_batch_receive();
+    void qtest_stats();
     void qtest_performance();
     void qtest_nonblock_send();
     void qtest_block_send();
@@ -391,6 +397,139 @@ void qtest_nonblock_receive() {
     printf("-----------------------------\n");
 }
 
+// This test verifies receiving several messages in one call
+void qtest_batch_receive() {
+    printf("-----------------------------\n");
+    printf("--- batch receive test ------\n");
+    printf("-----------------------------\n");
+    Os::Queue* testQueue = createTestQueue("TestQ", SER_BUFFER_SIZE, QUEUE_SIZE);
+    Os::Queue::QueueStatus stat;
+    U8 batch[4 * SER_BUFFER_SIZE];
+    NATIVE_INT_TYPE sizes[4];
+    NATIVE_INT_TYPE prios[4];
+    NATIVE_INT_TYPE numMsgs = -1;
+
+    // TEST 1
+    printf("Testing non-blocking batch receive on queue empty...\n");
+    stat = testQueue->receive(batch, SER_BUFFER_SIZE, 4, sizes, prios, numMsgs, Os::Queue::QUEUE_NONBLOCKING);
+    EXPECT_EQ(stat,Os::Queue::QUEUE_NO_MORE_MSGS);
+    EXPECT_EQ(numMsgs, 0);
+    printf("Passed.\n");
+
+    // TEST 2
+    printf("Testing batch receive takes at most the requested messages...\n");
+    I32 sendBuffStart[6] = {11, 45, 70, 123, 200, 400};
+    for( I32 ii = 0; ii < 6; ii++ ) {
+      MyTestSerializedBuffer sendBuff = getSendBuffer(sendBuffStart[ii]);
+      stat = testQueue->send(sendBuff, 0, Os::Queue::QUEUE_NONBLOCKING);
+      EXPECT_EQ(stat,Os::Queue::QUEUE_OK);
+    }
+    stat = testQueue->receive(batch, SER_BUFFER_SIZE, 4, sizes, prios, numMsgs, Os::Queue::QUEUE_BLOCKING);
+    EXPECT_EQ(stat,Os::Queue::QUEUE_OK);
+    EXPECT_EQ(numMsgs, 4);
+    EXPECT_EQ(testQueue->getNumMsgs(), 2);
+    for( I32 ii = 0; ii < numMsgs; ii++ ) {
+      MyTestSerializedBuffer expectedSendBuff = getSendBuffer(sendBuffStart[ii]);
+      EXPECT_EQ(sizes[ii], static_cast<NATIVE_INT_TYPE>(expectedSendBuff.getBuffLength()));
+      EXPECT_EQ(prios[ii], 0);
+      EXPECT_TRUE(memcmp(&batch[ii * SER_BUFFER_SIZE], expectedSendBuff.getBuffAddr(), sizes[ii]) == 0);
+    }
+    printf("Passed.\n");
+
+    // TEST 3
+    printf("Testing batch receive returns the messages left...\n");
+    stat = testQueue->receive(batch, SER_BUFFER_SIZE, 4, sizes, prios, numMsgs, Os::Queue::QUEUE_NONBLOCKING);
+    EXPECT_EQ(stat,Os::Queue::QUEUE_OK);
+    EXPECT_EQ(numMsgs, 2);
+    EXPECT_EQ(testQueue->getNumMsgs(), 0);
+    for( I32 ii = 0; ii < numMsgs; ii++ ) {
+      MyTestSerializedBuffer expectedSendBuff = getSendBuffer(sendBuffStart[4 + ii]);
+      EXPECT_TRUE(memcmp(&batch[ii * SER_BUFFER_SIZE], expectedSendBuff.getBuffAddr(), sizes[ii]) == 0);
+    }
+    printf("Passed.\n");
+
+    // TEST 4
+    printf("Testing batch receive with buffer too small...\n");
+    MyTestSerializedBuffer sendBuff = getSendBuffer(0);
+    stat = testQueue->send(sendBuff, 0, Os::Queue::QUEUE_NONBLOCKING);
+    EXPECT_EQ(stat,Os::Queue::QUEUE_OK);
+    stat = testQueue->receive(batch, 1, 4, sizes, prios, numMsgs, Os::Queue::QUEUE_NONBLOCKING);
+    EXPECT_EQ(stat,Os::Queue::QUEUE_SIZE_MISMATCH);
+    EXPECT_EQ(numMsgs, 0);
+    EXPECT_EQ(testQueue->getNumMsgs(), 1);
+    printf("Passed.\n");
+
+    delete testQueue;
+    printf("Test complete.\n");
+    printf("-----------------------------\n");
+    printf("-----------------------------\n");
+}
+
+// This test verifies the wait time and depth histograms kept with FW_QUEUE_INSTRUMENTATION
+void qtest_stats() {
+    printf("-----------------------------\n");
+    printf("------ queue stats test -----\n");
+    printf("-----------------------------\n");
+#if FW_QUEUE_INSTRUMENTATION
+    // TEST 1
+    printf("Testing histogram bins...\n");
+    EXPECT_EQ(Os::QueueStats::getBin(0), 0U);
+    EXPECT_EQ(Os::QueueStats::getBin(1), 1U);
+    EXPECT_EQ(Os::QueueStats::getBin(2), 2U);
+    EXPECT_EQ(Os::QueueStats::getBin(3), 2U);
+    EXPECT_EQ(Os::QueueStats::getBin(4), 3U);
+    EXPECT_EQ(Os::QueueStats::getBin(0xFFFFFFFF), static_cast<NATIVE_UINT_TYPE>(Os::QueueStats::NUM_BINS - 1));
+    EXPECT_EQ(Os::QueueStats::getBinLimit(0), 1U);
+    EXPECT_EQ(Os::QueueStats::getBinLimit(2), 4U);
+    EXPECT_EQ(Os::QueueStats::getBinLimit(Os::QueueStats::NUM_BINS - 1), 0U);
+    printf("Passed.\n");
+
+    // TEST 2
+    printf("Testing depth is recorded on send...\n");
+    Os::Queue* testQueue = createTestQueue("TestQ", SER_BUFFER_SIZE, QUEUE_SIZE);
+    Os::Queue::QueueStatus stat;
+    for( I32 ii = 0; ii < 3; ii++ ) {
+      MyTestSerializedBuffer sendBuff = getSendBuffer(ii);
+      stat = testQueue->send(sendBuff, 0, Os::Queue::QUEUE_NONBLOCKING);
+      EXPECT_EQ(stat,Os::Queue::QUEUE_OK);
+    }
+    const Os::QueueStats::Histogram& depth = testQueue->getStats().getDepth();
+    EXPECT_EQ(depth.count, 3U);
+    EXPECT_EQ(depth.max, 3U);
+    EXPECT_EQ(depth.bins[1], 1U);
+    EXPECT_EQ(depth.bins[2], 2U);
+    printf("Passed.\n");
+
+    // TEST 3
+    printf("Testing wait time is recorded on receive...\n");
+    usleep(20000);
+    MyTestSerializedBuffer recvBuff;
+    I32 prio;
+    stat = testQueue->receive(recvBuff, prio, Os::Queue::QUEUE_NONBLOCKING);
+    EXPECT_EQ(stat,Os::Queue::QUEUE_OK);
+    const Os::QueueStats::Histogram& wait = testQueue->getStats().getWait();
+    EXPECT_EQ(wait.count, 1U);
+    EXPECT_GE(wait.max, 10000U);
+    EXPECT_EQ(wait.bins[Os::QueueStats::getBin(wait.max)], 1U);
+    printf("Passed.\n");
+
+    // TEST 4
+    printf("Testing stats reset...\n");
+    testQueue->resetStats();
+    EXPECT_EQ(testQueue->getStats().getWait().count, 0U);
+    EXPECT_EQ(testQueue->getStats().getDepth().count, 0U);
+    EXPECT_EQ(testQueue->getStats().getDepth().max, 0U);
+    printf("Passed.\n");
+
+    delete testQueue;
+#else
+    printf("FW_QUEUE_INSTRUMENTATION is off; skipped.\n");
+#endif
+    printf("Test complete.\n");
+    printf("-----------------------------\n");
+    printf("-----------------------------\n");
+}
+
 // This test shows the performance of the queue:
 void qtest_performance() {
     printf("-----------------------------\n");
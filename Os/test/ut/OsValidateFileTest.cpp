@@ -79,6 +79,25 @@ void testValidateFile(const char* fileName) {
         return;
     }
 
+    // Write a hash file from an already computed hash:
+    Utils::HashBuffer hashBuffer;
+    validateStatus = Os::ValidateFile::validate(fileName, hashFileName, hashBuffer);
+    EXPECT_EQ(Os::ValidateFile::VALIDATION_OK, validateStatus);
+    fsStatus = Os::FileSystem::removeFile(hashFileName);
+    EXPECT_EQ(Os::FileSystem::OP_OK, fsStatus);
+    printf("Writing hash for file %s in %s\n", fileName, hashFileName);
+    validateStatus = Os::ValidateFile::writeValidation(hashFileName, hashBuffer);
+    if ( Os::ValidateFile::VALIDATION_OK != validateStatus ) {
+        printf("\tFailed to write hash file %s.\n", hashFileName);
+        printf("\tReturn status: %d\n", validateStatus);
+        EXPECT_TRUE(0);
+        return;
+    }
+    validateStatus = Os::ValidateFile::validate(fileName, hashFileName);
+    EXPECT_EQ(Os::ValidateFile::VALIDATION_OK, validateStatus);
+    validateStatus = Os::ValidateFile::writeValidation(hardtoaccessHashFileName, hashBuffer);
+    EXPECT_EQ(Os::ValidateFile::VALIDATION_FILE_DOESNT_EXIST, validateStatus);
+
     // Remove hash file:
     printf("Removing hash file %s\n", hashFileName);
     fsStatus = Os::FileSystem::removeFile(hashFileName);
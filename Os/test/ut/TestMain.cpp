@@ -7,6 +7,8 @@ extern "C" {
   void startTestTask();
   void qtest_block_receive();
   void qtest_nonblock_receive();
+  void qtest_batch_receive();
+  void qtest_stats();
   void qtest_nonblock_send();
   void qtest_block_send();
   void qtest_performance();
@@ -26,6 +28,12 @@ TEST(Nominal, QTestBlockRecv) {
 TEST(Nominal, QTestNonBlockRecv) {
    qtest_nonblock_receive();
 }
+TEST(Nominal, QTestBatchRecv) {
+   qtest_batch_receive();
+}
+TEST(Nominal, QTestStats) {
+   qtest_stats();
+}
 TEST(Nominal, QTestNonBlockSend) {
    qtest_nonblock_send();
 }
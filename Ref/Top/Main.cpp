@@ -3,6 +3,7 @@
 #include <ctype.h>
 
 #include <Os/Log.hpp>
+#include <Os/SimpleQueueRegistry.hpp>
 #include <Ref/Top/RefTopologyAc.hpp>
 
 void print_usage(const char* app) {
@@ -15,6 +16,10 @@ void print_usage(const char* app) {
 Ref::TopologyState state;
 // Enable the console logging provided by Os::Log
 Os::Log logger;
+#if FW_QUEUE_REGISTRATION
+// Record the queues so that the SystemResources QUEUE_DUMP command can report them
+Os::SimpleQueueRegistry queueRegistry;
+#endif
 
 volatile sig_atomic_t terminate = 0;
 
@@ -0,0 +1,528 @@
+// ======================================================================
+// \title  RefBenchmark.cpp
+// \brief  Headless throughput and latency benchmark of the Ref topology
+//
+// Runs the full Ref topology against a ground system stand-in listening on
+// loopback TCP. The stand-in frames commands up to the topology at fixed
+// rates and deframes everything sent down, measuring:
+//
+// - command latency: each measured command is a CMD_NO_OP_STRING carrying a
+//   sequence number, timed from the send of its frame to the arrival of the
+//   NoOpStringReceived event echoing that number back down
+// - throughput: commands completed, events and telemetry packets received
+//   per second, and downlink bytes per second
+// - drops: measured commands whose event never arrived, and command
+//   dispatcher error events seen
+//
+// Load is set with:
+//
+//   -c RATE  measured CMD_NO_OP_STRING commands per second, default 100
+//   -e RATE  additional CMD_NO_OP commands per second, adding event load, default 0
+//   -t HZ    rate group clock in Hz, scaling the telemetry load, default 10
+//   -d SECS  duration of the load, default 10
+//   -p PORT  loopback port of the ground stand-in, default 50000
+//   -j FILE  also write the results to FILE as JSON
+//
+// \copyright
+// Copyright 2009-2021, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <getopt.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <Drv/Ip/TcpServerSocket.hpp>
+#include <Fw/Cmd/CmdString.hpp>
+#include <Fw/Com/ComBuffer.hpp>
+#include <Fw/Com/ComPacket.hpp>
+#include <Fw/Log/LogPacket.hpp>
+#include <Fw/Log/LogString.hpp>
+#include <Fw/Types/String.hpp>
+#include <Os/IntervalTimer.hpp>
+#include <Os/Log.hpp>
+#include <Os/Mutex.hpp>
+#include <Os/Task.hpp>
+#include <Ref/Top/RefTopologyAc.hpp>
+#include <Svc/FramingProtocol/FprimeProtocol.hpp>
+#include <Utils/Types/CircularBuffer.hpp>
+
+Ref::TopologyState state;
+// Enable the console logging provided by Os::Log
+Os::Log logger;
+
+namespace {
+
+    const FwOpcodeType MEASURED_OPCODE = Ref::BaseIds::cmdDisp + Svc::CommandDispatcherImpl::OPCODE_CMD_NO_OP_STRING;
+    const FwOpcodeType LOAD_OPCODE = Ref::BaseIds::cmdDisp + Svc::CommandDispatcherImpl::OPCODE_CMD_NO_OP;
+    const FwEventIdType MEASURED_EVENT = Ref::BaseIds::cmdDisp + Svc::CommandDispatcherImpl::EVENTID_NOOPSTRINGRECEIVED;
+    const FwEventIdType ERROR_EVENTS[] = {
+        Ref::BaseIds::cmdDisp + Svc::CommandDispatcherImpl::EVENTID_OPCODEERROR,
+        Ref::BaseIds::cmdDisp + Svc::CommandDispatcherImpl::EVENTID_MALFORMEDCOMMAND,
+        Ref::BaseIds::cmdDisp + Svc::CommandDispatcherImpl::EVENTID_INVALIDCOMMAND,
+        Ref::BaseIds::cmdDisp + Svc::CommandDispatcherImpl::EVENTID_TOOMANYCOMMANDS
+    };
+    const char SEQUENCE_PREFIX[] = "bench ";
+    const U32 DOWNLINK_RING_SIZE = 64 * 1024;
+    const U32 DOWNLINK_READ_SIZE = 4096;
+    const U32 PACKET_MAX_SIZE = 2048;
+    const U32 SOCKET_TIMEOUT_USEC = 100000;
+    const U32 PACE_INTERVAL_MS = 1;
+    const U32 CONNECT_WAIT_MS = 1000;
+    const U32 DRAIN_MS = 2000;
+    const U32 NO_LATENCY = 0xFFFFFFFF;
+
+    struct Options {
+        U32 commandRate;
+        U32 eventRate;
+        U32 clockHz;
+        U32 durationSec;
+        U32 port;
+        const char* jsonPath;
+    };
+
+    class Ground;
+
+    //! Frames commands up to the topology
+    class Uplink : public FramingProtocolInterface {
+      public:
+        Uplink(Drv::IpSocket& socket) : m_socket(socket) {}
+
+        Fw::Buffer allocate(const U32 size) {
+            FW_ASSERT(size <= sizeof(m_frame), size);
+            return Fw::Buffer(m_frame, size);
+        }
+
+        void send(Fw::Buffer& outgoing) {
+            Drv::SocketIpStatus status = m_socket.send(outgoing.getData(), outgoing.getSize());
+            FW_ASSERT(status == Drv::SOCK_SUCCESS, status);
+        }
+
+        bool canSendSegments() {
+            return true;
+        }
+
+        void sendSegments(Fw::Buffer& header, const U8* const payload, const U32 size, Fw::Buffer& trailer) {
+            const U8* const data[] = {header.getData(), payload, trailer.getData()};
+            const U32 sizes[] = {header.getSize(), size, trailer.getSize()};
+            Drv::SocketIpStatus status = m_socket.sendSegments(data, sizes, FW_NUM_ARRAY_ELEMENTS(sizes));
+            FW_ASSERT(status == Drv::SOCK_SUCCESS, status);
+        }
+
+      private:
+        Drv::IpSocket& m_socket;
+        U8 m_frame[PACKET_MAX_SIZE];
+    };
+
+    //! Routes packets deframed from the topology's downlink back to the ground
+    class Downlink : public DeframingProtocolInterface {
+      public:
+        Downlink(Ground& ground) : m_ground(ground) {}
+
+        Fw::Buffer allocate(const U32 size) {
+            FW_ASSERT(size <= sizeof(m_packet), size);
+            return Fw::Buffer(m_packet, size);
+        }
+
+        void route(Fw::Buffer& data);
+
+      private:
+        Ground& m_ground;
+        U8 m_packet[PACKET_MAX_SIZE];
+    };
+
+    //! Ground system stand-in framing commands up and deframing packets down over one loopback TCP connection
+    class Ground {
+        friend class Downlink;
+      public:
+        Ground(const U32 maxCommands) :
+            m_uplink(m_socket),
+            m_downlink(*this),
+            m_ring(m_ringStore, sizeof(m_ringStore)),
+            m_maxCommands(maxCommands),
+            m_sendTimes(new Os::IntervalTimer::RawTime[maxCommands]),
+            m_latencies(new U32[maxCommands]),
+            m_sent(0),
+            m_loadSent(0),
+            m_events(0),
+            m_errorEvents(0),
+            m_tlmPackets(0),
+            m_otherPackets(0),
+            m_badFrames(0),
+            m_downlinkBytes(0),
+            m_stop(false) {
+            for (U32 i = 0; i < maxCommands; i++) {
+                m_latencies[i] = NO_LATENCY;
+            }
+            m_framing.setup(m_uplink);
+            m_deframing.setup(m_downlink);
+        }
+
+        ~Ground() {
+            delete[] m_sendTimes;
+            delete[] m_latencies;
+        }
+
+        //! Listens for the topology's comm driver on loopback
+        bool listen(const U32 port) {
+            m_socket.configure("127.0.0.1", static_cast<U16>(port), 0, SOCKET_TIMEOUT_USEC);
+            return m_socket.startup() == Drv::SOCK_SUCCESS;
+        }
+
+        //! Accepts the topology's connection and starts reading the downlink
+        bool accept() {
+            if (m_socket.open() != Drv::SOCK_SUCCESS) {
+                return false;
+            }
+            Fw::String name("BenchDownlink");
+            return m_downlinkTask.start(name, downlinkTask, this) == Os::Task::TASK_OK;
+        }
+
+        //! Stops reading the downlink and closes the connection
+        void stop() {
+            m_lock.lock();
+            m_stop = true;
+            m_lock.unLock();
+            // Closing the socket wakes the downlink task from its blocking recv
+            m_socket.close();
+            (void) m_downlinkTask.join(nullptr);
+            m_socket.shutdown();
+        }
+
+        //! Sends the next measured command, false once all maxCommands are sent
+        bool sendMeasured() {
+            Fw::SerializeStatus status;
+            if (m_sent >= m_maxCommands) {
+                return false;
+            }
+            char text[Fw::CmdStringArg::SERIALIZED_SIZE];
+            (void) snprintf(text, sizeof(text), "%s%u", SEQUENCE_PREFIX, m_sent);
+            Fw::CmdStringArg arg(text);
+            Fw::ComBuffer com;
+            status = com.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_COMMAND));
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+            status = com.serialize(MEASURED_OPCODE);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+            status = com.serialize(arg);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+            m_lock.lock();
+            Os::IntervalTimer::getRawTime(m_sendTimes[m_sent]);
+            m_sent++;
+            m_lock.unLock();
+            m_framing.frame(com.getBuffAddr(), com.getBuffLength(), Fw::ComPacket::FW_PACKET_UNKNOWN);
+            return true;
+        }
+
+        //! Sends a command generating event load only
+        void sendLoad() {
+            Fw::SerializeStatus status;
+            Fw::ComBuffer com;
+            status = com.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_COMMAND));
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+            status = com.serialize(LOAD_OPCODE);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+            m_framing.frame(com.getBuffAddr(), com.getBuffLength(), Fw::ComPacket::FW_PACKET_UNKNOWN);
+            m_loadSent++;
+        }
+
+        //! Prints the results and optionally writes them as JSON
+        bool report(const Options& options, const U32 elapsedUsec, const char* jsonPath) {
+            m_lock.lock();
+            U32 count = 0;
+            for (U32 i = 0; i < m_sent; i++) {
+                if (m_latencies[i] != NO_LATENCY) {
+                    m_latencies[count++] = m_latencies[i];
+                }
+            }
+            std::sort(m_latencies, m_latencies + count);
+            const F64 seconds = static_cast<F64>(elapsedUsec) / 1.0e6;
+            const U32 dropped = m_sent - count;
+            (void) printf("Duration          %10.3f s\n", seconds);
+            (void) printf("Commands sent     %10u (+%u load)\n", m_sent, m_loadSent);
+            (void) printf("Commands complete %10u  %10.1f /s\n", count, static_cast<F64>(count) / seconds);
+            (void) printf("Commands dropped  %10u\n", dropped);
+            (void) printf("Events            %10llu  %10.1f /s\n", static_cast<unsigned long long>(m_events),
+                          static_cast<F64>(m_events) / seconds);
+            (void) printf("Error events      %10llu\n", static_cast<unsigned long long>(m_errorEvents));
+            (void) printf("Telemetry packets %10llu  %10.1f /s\n", static_cast<unsigned long long>(m_tlmPackets),
+                          static_cast<F64>(m_tlmPackets) / seconds);
+            (void) printf("Downlink          %10llu B  %10.1f B/s\n", static_cast<unsigned long long>(m_downlinkBytes),
+                          static_cast<F64>(m_downlinkBytes) / seconds);
+            (void) printf("Other packets     %10llu\n", static_cast<unsigned long long>(m_otherPackets));
+            (void) printf("Bad frames        %10llu\n", static_cast<unsigned long long>(m_badFrames));
+            (void) printf("Latency us        p50 %u  p90 %u  p99 %u  p99.9 %u  max %u\n", percentile(count, 50.0),
+                          percentile(count, 90.0), percentile(count, 99.0), percentile(count, 99.9),
+                          percentile(count, 100.0));
+            bool ok = true;
+            if (jsonPath != nullptr) {
+                ok = writeJson(options, seconds, count, dropped, jsonPath);
+            }
+            m_lock.unLock();
+            return ok;
+        }
+
+      private:
+        //! Counts a deframed packet, timing measured commands from their events
+        void route(Fw::Buffer& data) {
+            Fw::SerializeStatus status;
+            Fw::SerializeBufferBase& serializer = data.getSerializeRepr();
+            status = serializer.setBuffLen(data.getSize());
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+            FwPacketDescriptorType descriptor = 0;
+            if (serializer.deserialize(descriptor) != Fw::FW_SERIALIZE_OK) {
+                m_badFrames++;
+                return;
+            }
+            switch (descriptor) {
+                case Fw::ComPacket::FW_PACKET_LOG:
+                    this->routeEvent(serializer);
+                    break;
+                case Fw::ComPacket::FW_PACKET_TELEM:
+                case Fw::ComPacket::FW_PACKET_TELEM_BATCH:
+                case Fw::ComPacket::FW_PACKET_PACKETIZED_TLM:
+                    m_tlmPackets++;
+                    break;
+                default:
+                    m_otherPackets++;
+                    break;
+            }
+        }
+
+        static void downlinkTask(void* pointer) {
+            Ground* self = static_cast<Ground*>(pointer);
+            U8 data[DOWNLINK_READ_SIZE];
+            while (true) {
+                self->m_lock.lock();
+                const bool stop = self->m_stop;
+                self->m_lock.unLock();
+                if (stop) {
+                    break;
+                }
+                I32 size = sizeof(data);
+                Drv::SocketIpStatus status = self->m_socket.recv(data, size);
+                if (status == Drv::SOCK_SUCCESS) {
+                    self->deframe(data, static_cast<U32>(size));
+                } else if (status != Drv::SOCK_INTERRUPTED_TRY_AGAIN) {
+                    break;
+                }
+            }
+        }
+
+        //! Deframes received bytes the way Svc::Deframer does
+        void deframe(const U8* data, const U32 size) {
+            Fw::SerializeStatus status;
+            m_lock.lock();
+            m_downlinkBytes += size;
+            U32 offset = 0;
+            while (offset < size) {
+                const U32 room = m_ring.get_remaining_size(true);
+                const U32 chunk = ((size - offset) < room) ? (size - offset) : room;
+                FW_ASSERT(chunk > 0);
+                status = m_ring.serialize(data + offset, chunk);
+                FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+                offset += chunk;
+                while (m_ring.get_remaining_size() > 0) {
+                    U32 needed = 0;
+                    const Svc::DeframingProtocol::DeframingStatus deframed = m_deframing.deframe(m_ring, needed);
+                    if (deframed == Svc::DeframingProtocol::DEFRAMING_STATUS_SUCCESS) {
+                        m_ring.rotate(needed);
+                    } else if (deframed == Svc::DeframingProtocol::DEFRAMING_MORE_NEEDED) {
+                        break;
+                    } else {
+                        m_badFrames++;
+                        m_ring.rotate(m_deframing.resync(m_ring));
+                    }
+                }
+            }
+            m_lock.unLock();
+        }
+
+        void routeEvent(Fw::SerializeBufferBase& serializer) {
+            Fw::LogPacket packet;
+            serializer.resetDeser();
+            if (serializer.deserialize(packet) != Fw::FW_SERIALIZE_OK) {
+                m_badFrames++;
+                return;
+            }
+            m_events++;
+            const FwEventIdType id = packet.getId();
+            for (U32 i = 0; i < FW_NUM_ARRAY_ELEMENTS(ERROR_EVENTS); i++) {
+                m_errorEvents += (id == ERROR_EVENTS[i]) ? 1 : 0;
+            }
+            if (id != MEASURED_EVENT) {
+                return;
+            }
+            Os::IntervalTimer::RawTime now;
+            Os::IntervalTimer::getRawTime(now);
+            Fw::LogStringArg message;
+            if ((packet.getLogBuffer().deserialize(message) != Fw::FW_SERIALIZE_OK) or
+                (strncmp(message.toChar(), SEQUENCE_PREFIX, sizeof(SEQUENCE_PREFIX) - 1) != 0)) {
+                return;
+            }
+            const U32 sequence = static_cast<U32>(strtoul(message.toChar() + sizeof(SEQUENCE_PREFIX) - 1, nullptr, 10));
+            if ((sequence < m_sent) and (m_latencies[sequence] == NO_LATENCY)) {
+                m_latencies[sequence] = Os::IntervalTimer::getDiffUsec(now, m_sendTimes[sequence]);
+            }
+        }
+
+        //! Latency at the given percentile of the count sorted latencies
+        U32 percentile(const U32 count, const F64 percent) const {
+            if (count == 0) {
+                return 0;
+            }
+            U32 index = static_cast<U32>((percent / 100.0) * static_cast<F64>(count));
+            return m_latencies[(index < count) ? index : (count - 1)];
+        }
+
+        bool writeJson(const Options& options, const F64 seconds, const U32 completed, const U32 dropped,
+                       const char* path) {
+            FILE* file = fopen(path, "w");
+            if (file == nullptr) {
+                return false;
+            }
+            (void) fprintf(file, "{\n  \"load\": {\n");
+            (void) fprintf(file, "    \"command_rate\": %u,\n    \"event_command_rate\": %u,\n", options.commandRate,
+                           options.eventRate);
+            (void) fprintf(file, "    \"clock_hz\": %u,\n    \"duration_s\": %u\n  },\n", options.clockHz,
+                           options.durationSec);
+            (void) fprintf(file, "  \"results\": {\n    \"elapsed_s\": %.3f,\n", seconds);
+            (void) fprintf(file, "    \"commands_sent\": %u,\n    \"load_commands_sent\": %u,\n", m_sent, m_loadSent);
+            (void) fprintf(file, "    \"commands_completed\": %u,\n    \"commands_dropped\": %u,\n", completed, dropped);
+            (void) fprintf(file, "    \"commands_per_second\": %.1f,\n", static_cast<F64>(completed) / seconds);
+            (void) fprintf(file, "    \"events\": %llu,\n    \"events_per_second\": %.1f,\n",
+                           static_cast<unsigned long long>(m_events), static_cast<F64>(m_events) / seconds);
+            (void) fprintf(file, "    \"error_events\": %llu,\n", static_cast<unsigned long long>(m_errorEvents));
+            (void) fprintf(file, "    \"telemetry_packets\": %llu,\n    \"telemetry_packets_per_second\": %.1f,\n",
+                           static_cast<unsigned long long>(m_tlmPackets), static_cast<F64>(m_tlmPackets) / seconds);
+            (void) fprintf(file, "    \"downlink_bytes_per_second\": %.1f,\n",
+                           static_cast<F64>(m_downlinkBytes) / seconds);
+            (void) fprintf(file, "    \"bad_frames\": %llu,\n", static_cast<unsigned long long>(m_badFrames));
+            (void) fprintf(file, "    \"latency_us\": {\"p50\": %u, \"p90\": %u, \"p99\": %u, \"p999\": %u, \"max\": %u}\n",
+                           percentile(completed, 50.0), percentile(completed, 90.0), percentile(completed, 99.0),
+                           percentile(completed, 99.9), percentile(completed, 100.0));
+            (void) fprintf(file, "  }\n}\n");
+            return fclose(file) == 0;
+        }
+
+        Drv::TcpServerSocket m_socket;
+        Uplink m_uplink;
+        Downlink m_downlink;
+        Svc::FprimeFraming m_framing;
+        Svc::FprimeDeframing m_deframing;
+        U8 m_ringStore[DOWNLINK_RING_SIZE];
+        Types::CircularBuffer m_ring;
+        Os::Task m_downlinkTask;
+        Os::Mutex m_lock; //!< Guards all state shared by the sending and downlink tasks
+        const U32 m_maxCommands;
+        Os::IntervalTimer::RawTime* m_sendTimes; //!< Send time of each measured command by sequence number
+        U32* m_latencies; //!< Latency of each measured command in microseconds, NO_LATENCY until completed
+        U32 m_sent;
+        U32 m_loadSent;
+        U64 m_events;
+        U64 m_errorEvents;
+        U64 m_tlmPackets;
+        U64 m_otherPackets;
+        U64 m_badFrames;
+        U64 m_downlinkBytes;
+        bool m_stop;
+    };
+
+    void Downlink::route(Fw::Buffer& data) {
+        m_ground.route(data);
+    }
+
+    void print_usage(const char* app) {
+        (void) printf("Usage: ./%s [options]\n-c\tmeasured commands per second\n-e\tevent load commands per second\n"
+                      "-t\trate group clock Hz\n-d\tduration seconds\n-p\tport_number\n-j\tJSON output file\n", app);
+    }
+
+    //! Number of events at rate per second due by elapsedUsec
+    U64 due(const U32 rate, const U32 elapsedUsec) {
+        return (static_cast<U64>(rate) * elapsedUsec) / 1000000;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options = {100, 0, 10, 10, 50000, nullptr};
+    I32 option = 0;
+    while ((option = getopt(argc, argv, "hc:e:t:d:p:j:")) != -1) {
+        switch (option) {
+            case 'c':
+                options.commandRate = static_cast<U32>(atoi(optarg));
+                break;
+            case 'e':
+                options.eventRate = static_cast<U32>(atoi(optarg));
+                break;
+            case 't':
+                options.clockHz = static_cast<U32>(atoi(optarg));
+                break;
+            case 'd':
+                options.durationSec = static_cast<U32>(atoi(optarg));
+                break;
+            case 'p':
+                options.port = static_cast<U32>(atoi(optarg));
+                break;
+            case 'j':
+                options.jsonPath = optarg;
+                break;
+            case 'h':
+                print_usage(argv[0]);
+                return 0;
+            default:
+                print_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    Ground ground(options.commandRate * options.durationSec);
+    if (not ground.listen(options.port)) {
+        (void) printf("Failed to listen on port %u\n", options.port);
+        return 1;
+    }
+    state = Ref::TopologyState("127.0.0.1", options.port);
+    Ref::setup(state);
+    if (not ground.accept()) {
+        (void) printf("Topology failed to connect\n");
+        Ref::teardown(state);
+        return 1;
+    }
+    // Let the topology finish starting before timing it
+    Os::Task::delay(CONNECT_WAIT_MS);
+
+    // Pace commands and rate group clock ticks against elapsed time, catching up after any late wake up
+    const U32 durationUsec = options.durationSec * 1000000;
+    U64 measured = 0;
+    U64 load = 0;
+    U64 ticks = 0;
+    Os::IntervalTimer::RawTime start;
+    Os::IntervalTimer::RawTime now;
+    Os::IntervalTimer::getRawTime(start);
+    U32 elapsed = 0;
+    while (elapsed < durationUsec) {
+        Os::IntervalTimer::getRawTime(now);
+        elapsed = Os::IntervalTimer::getDiffUsec(now, start);
+        for (; measured < due(options.commandRate, elapsed); measured++) {
+            (void) ground.sendMeasured();
+        }
+        for (; load < due(options.eventRate, elapsed); load++) {
+            ground.sendLoad();
+        }
+        for (; ticks < due(options.clockHz, elapsed); ticks++) {
+            Ref::blockDrv.callIsr();
+        }
+        Os::Task::delay(PACE_INTERVAL_MS);
+    }
+    // Give the last commands time to complete, then stop before the topology goes away
+    Os::Task::delay(DRAIN_MS);
+    ground.stop();
+    Ref::teardown(state);
+
+    const bool ok = ground.report(options, elapsed, options.jsonPath);
+    // Give time for threads to exit
+    Os::Task::delay(1000);
+    return ok ? 0 : 1;
+}
@@ -9,7 +9,11 @@
 
 #include <Svc/ActiveLogger/ActiveLoggerImpl.hpp>
 #include <Fw/Types/Assert.hpp>
+#include <Fw/Types/SerialBuffer.hpp>
 #include <Os/File.hpp>
+#include <Os/IntervalTimer.hpp>
+
+static_assert(ACTIVE_LOGGER_EVENT_LOG_SIZE > sizeof(U16) + FW_COM_BUFFER_MAX_SIZE, "ACTIVE_LOGGER_EVENT_LOG_SIZE must hold an event packet and its size");
 
 namespace Svc {
 
@@ -17,7 +21,11 @@ namespace Svc {
     typedef ActiveLogger_FilterSeverity FilterSeverity;
 
     ActiveLoggerImpl::ActiveLoggerImpl(const char* name) : 
-        ActiveLoggerComponentBase(name)
+        ActiveLoggerComponentBase(name),
+        m_batchPackets(ACTIVE_LOGGER_BATCH_PACKETS),
+        m_numIdFilters(0),
+        m_eventLog(m_eventLogStore,sizeof(m_eventLogStore)),
+        m_eventLogRecords(0)
     {
         // set filter defaults
         this->m_filterState[FilterSeverity::WARNING_HI].enabled =
@@ -33,7 +41,11 @@ namespace Svc {
         this->m_filterState[FilterSeverity::DIAGNOSTIC].enabled =
                 FILTER_DIAGNOSTIC_DEFAULT?Enabled::ENABLED:Enabled::DISABLED;
 
-        memset(m_filteredIDs,0,sizeof(m_filteredIDs));
+        memset(m_idFilter,0,sizeof(m_idFilter));
+
+        // start the first multi-event packet
+        Fw::SerializeStatus stat = this->m_logBatch.resetPktSer();
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
 
     }
 
@@ -90,12 +102,34 @@ namespace Svc {
                 return;
         }
 
-        // check ID filters
-        for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-            if (
-              (m_filteredIDs[entry] == id) &&
-              (severity != Fw::LogSeverity::FATAL)
-              ) {
+        // check ID filters. With none set, skip the lock. An event racing the command adding the first one may pass
+        if ((severity != Fw::LogSeverity::FATAL) and (__atomic_load_n(&this->m_numIdFilters,__ATOMIC_ACQUIRE) != 0)) {
+            bool drop = false;
+            this->m_idFilterLock.lock();
+            t_idFilter& entry = this->m_idFilter[this->findIdFilter(id)];
+            if (entry.id == id) {
+                if (entry.filtered) {
+                    drop = true;
+                } else if (entry.limit != 0) {
+                    // pass up to the limit each second of the interval timer. Event time tags are not used since
+                    // they can be set back, jump or stay at zero when a component has no time source
+                    Os::IntervalTimer::RawTime now;
+                    Os::IntervalTimer::getRawTime(now);
+                    if ((entry.count == 0) or
+                        (Os::IntervalTimer::getDiffUsec(now,entry.windowStart) >= ID_THROTTLE_WINDOW_USEC)) {
+                        entry.windowStart = now;
+                        entry.count = 0;
+                    }
+                    if (entry.count < entry.limit) {
+                        entry.count++;
+                    } else {
+                        entry.dropped++;
+                        drop = true;
+                    }
+                }
+            }
+            this->m_idFilterLock.unLock();
+            if (drop) {
                 return;
             }
         }
@@ -121,11 +155,31 @@ namespace Svc {
         Fw::SerializeStatus stat = this->m_logPacket.serialize(this->m_comBuffer);
         FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
 
-        if (this->isConnected_PktSend_OutputPort(0)) {
+        // keep the event in the event log
+        this->logEvent(this->m_comBuffer);
+
+        if (this->m_batchPackets) {
+            stat = this->m_logBatch.addEvent(id,timeTag,args);
+            if (Fw::FW_SERIALIZE_NO_ROOM_LEFT == stat) {
+                // packet is full, so send it and start a new one
+                this->sendEventPacket();
+                stat = this->m_logBatch.addEvent(id,timeTag,args);
+            }
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            // don't hold a FATAL event until the next call of the Run port
+            if (Fw::LogSeverity::FATAL == severity.e) {
+                this->sendEventPacket();
+            }
+        } else if (this->isConnected_PktSend_OutputPort(0)) {
             this->PktSend_out(0, this->m_comBuffer,0);
         }
     }
 
+    void ActiveLoggerImpl::Run_handler(NATIVE_INT_TYPE portNum, NATIVE_UINT_TYPE context) {
+        // send the events batched since the last call
+        this->sendEventPacket();
+    }
+
     void ActiveLoggerImpl::SET_EVENT_FILTER_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, FilterSeverity filterLevel, Enabled filterEnable) {
         if (  (filterLevel.e > FilterSeverity::DIAGNOSTIC) or
               (filterLevel.e < FilterSeverity::WARNING_HI) or
@@ -145,7 +199,7 @@ namespace Svc {
             Enabled idEnabled //!< ID filter state
         ) {
 
-        // check parameter
+        // check parameter. ID 0 is reserved for empty entries
         switch (idEnabled.e) {
             case Enabled::ENABLED:
             case Enabled::DISABLED:
@@ -154,45 +208,94 @@ namespace Svc {
                 this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::VALIDATION_ERROR);
                 return;
         }
+        if (0 == ID) {
+            this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::VALIDATION_ERROR);
+            return;
+        }
 
+        this->m_idFilterLock.lock();
+        const U32 slot = this->findIdFilter(ID);
+        const bool found = (this->m_idFilter[slot].id == ID);
         if (Enabled::ENABLED == idEnabled.e) { // add ID
-            // search list for existing entry
-            for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-                if (this->m_filteredIDs[entry] == ID) {
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
-                    this->log_ACTIVITY_HI_ID_FILTER_ENABLED(ID);
-                    return;
-                }
+            const bool added = found or (this->m_numIdFilters < TELEM_ID_FILTER_SIZE);
+            if (not found and added) {
+                this->addIdFilter(slot,ID);
             }
-            // if not already a match, search for an open slot
-            for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-                if (this->m_filteredIDs[entry] == 0) {
-                    this->m_filteredIDs[entry] = ID;
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
-                    this->log_ACTIVITY_HI_ID_FILTER_ENABLED(ID);
-                    return;
-                }
+            if (added) {
+                this->m_idFilter[slot].filtered = true;
+            }
+            this->m_idFilterLock.unLock();
+            if (added) {
+                this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
+                this->log_ACTIVITY_HI_ID_FILTER_ENABLED(ID);
+            } else {
+                // if an empty slot was not found, send an error event
+                this->log_WARNING_LO_ID_FILTER_LIST_FULL(ID);
+                this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
             }
-            // if an empty slot was not found, send an error event
-            this->log_WARNING_LO_ID_FILTER_LIST_FULL(ID);
-            this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
         } else { // remove ID
-            // search list for existing entry
-            for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-                if (this->m_filteredIDs[entry] == ID) {
-                    this->m_filteredIDs[entry] = 0; // zero entry
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
-                    this->log_ACTIVITY_HI_ID_FILTER_REMOVED(ID);
-                    return;
+            const bool removed = found and this->m_idFilter[slot].filtered;
+            if (removed) {
+                this->m_idFilter[slot].filtered = false;
+                // keep the entry while the ID is still throttled
+                if (0 == this->m_idFilter[slot].limit) {
+                    this->removeIdFilter(slot);
                 }
             }
-            // if it gets here, wasn't found
-            this->log_WARNING_LO_ID_FILTER_NOT_FOUND(ID);
-            this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+            this->m_idFilterLock.unLock();
+            if (removed) {
+                this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
+                this->log_ACTIVITY_HI_ID_FILTER_REMOVED(ID);
+            } else {
+                this->log_WARNING_LO_ID_FILTER_NOT_FOUND(ID);
+                this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+            }
         }
 
     }
 
+    void ActiveLoggerImpl::SET_ID_THROTTLE_cmdHandler(
+            FwOpcodeType opCode, //!< The opcode
+            U32 cmdSeq, //!< The command sequence number
+            U32 ID,
+            U32 limit //!< Events passed per second, 0 for no limit
+        ) {
+
+        // ID 0 is reserved for empty entries
+        if (0 == ID) {
+            this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::VALIDATION_ERROR);
+            return;
+        }
+
+        this->m_idFilterLock.lock();
+        const U32 slot = this->findIdFilter(ID);
+        const bool found = (this->m_idFilter[slot].id == ID);
+        bool full = false;
+        if (found) {
+            this->m_idFilter[slot].limit = limit;
+            this->m_idFilter[slot].count = 0;
+            // drop the entry once the ID is neither throttled nor filtered
+            if ((0 == limit) and (not this->m_idFilter[slot].filtered)) {
+                this->removeIdFilter(slot);
+            }
+        } else if (limit != 0) {
+            full = (this->m_numIdFilters >= TELEM_ID_FILTER_SIZE);
+            if (not full) {
+                this->addIdFilter(slot,ID);
+                this->m_idFilter[slot].limit = limit;
+            }
+        }
+        this->m_idFilterLock.unLock();
+
+        if (full) {
+            this->log_WARNING_LO_ID_FILTER_LIST_FULL(ID);
+            this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+            return;
+        }
+        this->log_ACTIVITY_HI_ID_THROTTLE_SET(ID,limit);
+        this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
+    }
+
     void ActiveLoggerImpl::DUMP_FILTER_STATE_cmdHandler(
             FwOpcodeType opCode, //!< The opcode
             U32 cmdSeq //!< The command sequence number
@@ -207,16 +310,62 @@ namespace Svc {
            );
         }
 
-        // iterate through ID filter
-        for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-            if (this->m_filteredIDs[entry] != 0) {
-                this->log_ACTIVITY_HI_ID_FILTER_ENABLED(this->m_filteredIDs[entry]);
+        // iterate through ID filter, copying out each entry so no event is sent with the lock held
+        for (NATIVE_UINT_TYPE slot = 0; slot < ID_FILTER_TABLE_SIZE; slot++) {
+            this->m_idFilterLock.lock();
+            const t_idFilter entry = this->m_idFilter[slot];
+            this->m_idFilterLock.unLock();
+            if (entry.id == 0) {
+                continue;
+            }
+            if (entry.filtered) {
+                this->log_ACTIVITY_HI_ID_FILTER_ENABLED(entry.id);
+            }
+            if (entry.limit != 0) {
+                this->log_ACTIVITY_LO_ID_THROTTLE_STATE(entry.id,entry.limit,entry.dropped);
             }
         }
 
         this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
     }
 
+    void ActiveLoggerImpl::DUMP_EVENT_LOG_cmdHandler(
+            FwOpcodeType opCode, //!< The opcode
+            U32 cmdSeq, //!< The command sequence number
+            const Fw::CmdStringArg& fileName //!< The file to write
+        ) {
+
+        Fw::LogStringArg logFileName(fileName.toChar());
+        Os::File file;
+        Os::File::Status status = file.open(fileName.toChar(),Os::File::OPEN_CREATE,false);
+
+        // the log is written as is, in the format of ComLogger files: a 16-bit size then the packet for each event
+        if (Os::File::OP_OK == status) {
+            Types::CircularBuffer::Span spans[2];
+            const Fw::SerializeStatus stat = this->m_eventLog.get_spans(spans[0],spans[1],this->m_eventLog.get_remaining_size());
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            for (NATIVE_UINT_TYPE span = 0; (span < 2) and (Os::File::OP_OK == status); span++) {
+                NATIVE_INT_TYPE size = static_cast<NATIVE_INT_TYPE>(spans[span].size);
+                if (size == 0) {
+                    continue;
+                }
+                status = file.write(spans[span].data,size,true);
+                if ((Os::File::OP_OK == status) and (size != static_cast<NATIVE_INT_TYPE>(spans[span].size))) {
+                    status = Os::File::BAD_SIZE;
+                }
+            }
+            file.close();
+        }
+
+        if (Os::File::OP_OK != status) {
+            this->log_WARNING_HI_EVENT_LOG_DUMP_ERROR(status,logFileName);
+            this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+            return;
+        }
+        this->log_ACTIVITY_HI_EVENT_LOG_DUMPED(this->m_eventLogRecords,logFileName);
+        this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
+    }
+
     void ActiveLoggerImpl::pingIn_handler(
           const NATIVE_INT_TYPE portNum,
           U32 key
@@ -226,4 +375,67 @@ namespace Svc {
         this->pingOut_out(0,key);
     }
 
+    void ActiveLoggerImpl::sendEventPacket() {
+        if (this->m_logBatch.getNumEntries() == 0) {
+            return;
+        }
+        if (this->isConnected_PktSend_OutputPort(0)) {
+            this->PktSend_out(0,this->m_logBatch.getBuffer(),0);
+        }
+        Fw::SerializeStatus stat = this->m_logBatch.resetPktSer();
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+    }
+
+    void ActiveLoggerImpl::logEvent(const Fw::ComBuffer& packet) {
+        U8 header[sizeof(U16)];
+        Fw::SerialBuffer headerBuffer(header,sizeof(header));
+        const NATIVE_UINT_TYPE size = packet.getBuffLength();
+        Fw::SerializeStatus stat;
+
+        // drop the oldest events until there is room for this one
+        while (this->m_eventLog.get_remaining_size(true) < (sizeof(header) + size)) {
+            FW_ASSERT(this->m_eventLogRecords > 0);
+            U16 oldest = 0;
+            stat = this->m_eventLog.peek(header,sizeof(header));
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            headerBuffer.fill();
+            stat = headerBuffer.deserialize(oldest);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            stat = this->m_eventLog.rotate(sizeof(header) + oldest);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            this->m_eventLogRecords--;
+        }
+
+        headerBuffer.resetSer();
+        stat = headerBuffer.serialize(static_cast<U16>(size));
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+        stat = this->m_eventLog.serialize(header,sizeof(header));
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+        stat = this->m_eventLog.serialize(packet.getBuffAddr(),size);
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+        this->m_eventLogRecords++;
+    }
+
+    U32 ActiveLoggerImpl::findIdFilter(FwEventIdType id) {
+        // the table is never more than half full, so an empty slot ends every probe
+        return Types::OpenAddressing<t_idFilter, IdFilterTraits>::find(this->m_idFilter, ID_FILTER_TABLE_SIZE, id,
+                                                                       IdFilterTraits());
+    }
+
+    void ActiveLoggerImpl::addIdFilter(U32 slot, FwEventIdType id) {
+        FW_ASSERT(slot < ID_FILTER_TABLE_SIZE, slot);
+        FW_ASSERT(this->m_idFilter[slot].id == 0, this->m_idFilter[slot].id);
+        FW_ASSERT(this->m_numIdFilters < TELEM_ID_FILTER_SIZE, this->m_numIdFilters);
+        memset(&this->m_idFilter[slot],0,sizeof(this->m_idFilter[slot]));
+        this->m_idFilter[slot].id = id;
+        __atomic_store_n(&this->m_numIdFilters,this->m_numIdFilters + 1,__ATOMIC_RELEASE);
+    }
+
+    void ActiveLoggerImpl::removeIdFilter(U32 slot) {
+        FW_ASSERT(this->m_numIdFilters > 0);
+        Types::OpenAddressing<t_idFilter, IdFilterTraits>::remove(this->m_idFilter, ID_FILTER_TABLE_SIZE, slot,
+                                                                  IdFilterTraits());
+        __atomic_store_n(&this->m_numIdFilters,this->m_numIdFilters - 1,__ATOMIC_RELEASE);
+    }
+
 } // namespace Svc
@@ -10,6 +10,11 @@
 
 #include <Svc/ActiveLogger/ActiveLoggerComponentAc.hpp>
 #include <Fw/Log/LogPacket.hpp>
+#include <Fw/Log/LogBatchPacket.hpp>
+#include <Os/Mutex.hpp>
+#include <Os/IntervalTimer.hpp>
+#include <Utils/Types/CircularBuffer.hpp>
+#include <Utils/Types/OpenAddressing.hpp>
 #include <ActiveLoggerImplCfg.hpp>
 
 namespace Svc {
@@ -26,6 +31,7 @@ namespace Svc {
         PRIVATE:
             void LogRecv_handler(NATIVE_INT_TYPE portNum, FwEventIdType id, Fw::Time &timeTag, const Fw::LogSeverity& severity, Fw::LogBuffer &args);
             void loqQueue_internalInterfaceHandler(FwEventIdType id, const Fw::Time &timeTag, const Fw::LogSeverity& severity, const Fw::LogBuffer &args);
+            void Run_handler(NATIVE_INT_TYPE portNum, NATIVE_UINT_TYPE context);
 
             void SET_EVENT_FILTER_cmdHandler(
                     FwOpcodeType opCode,
@@ -45,6 +51,34 @@ namespace Svc {
                     U32 cmdSeq //!< The command sequence number
                 );
 
+            void SET_ID_THROTTLE_cmdHandler(
+                    FwOpcodeType opCode, //!< The opcode
+                    U32 cmdSeq, //!< The command sequence number
+                    U32 ID,
+                    U32 limit //!< Events passed per second, 0 for no limit
+                );
+
+            void DUMP_EVENT_LOG_cmdHandler(
+                    FwOpcodeType opCode, //!< The opcode
+                    U32 cmdSeq, //!< The command sequence number
+                    const Fw::CmdStringArg& fileName //!< The file to write
+                );
+
+            //! Send the multi-event packet if it holds any events, and start a new one
+            void sendEventPacket();
+
+            //! Add an event packet to the event log, dropping the oldest events to make room
+            void logEvent(const Fw::ComBuffer& packet);
+
+            //! Find the ID filter slot holding an ID, or the empty slot it would be placed in
+            U32 findIdFilter(FwEventIdType id);
+
+            //! Add an ID to the empty ID filter slot found for it
+            void addIdFilter(U32 slot, FwEventIdType id);
+
+            //! Empty an ID filter slot, moving back the entries probed past it
+            void removeIdFilter(U32 slot);
+
             //! Handler implementation for pingIn
             //!
             void pingIn_handler(
@@ -59,11 +93,40 @@ namespace Svc {
 
             // Working members
             Fw::LogPacket m_logPacket; //!< packet buffer for assembling log packets
+            Fw::LogBatchPacket m_logBatch; //!< multi-event packet being filled when m_batchPackets is set
             Fw::ComBuffer m_comBuffer; //!< com buffer for sending event buffers
+            bool m_batchPackets; //!< pack events into multi-event packets. Set from ACTIVE_LOGGER_BATCH_PACKETS
+
+            enum {
+                ID_FILTER_TABLE_SIZE = 2 * TELEM_ID_FILTER_SIZE, //!< kept at most half full
+                ID_THROTTLE_WINDOW_USEC = 1000000 //!< length of a throttle window
+            };
+
+            // filtered and throttled event IDs, open-addressed by ID hash.
+            // an ID has an entry while it is filtered or throttled. ID of 0 means no entry
+            struct t_idFilter {
+                FwEventIdType id; //!< the event ID
+                bool filtered; //!< events of the ID are dropped
+                U32 limit; //!< events of the ID passed per second, 0 for no limit
+                Os::IntervalTimer::RawTime windowStart; //!< start of the current throttle window
+                U32 count; //!< events passed in the current throttle window, 0 before the first window
+                U32 dropped; //!< events dropped by the throttle
+            } m_idFilter[ID_FILTER_TABLE_SIZE];
+
+            //! open addressing of m_idFilter, keyed by event ID
+            struct IdFilterTraits {
+                bool isEmpty(const t_idFilter& entry) const { return entry.id == 0; }
+                U32 getKey(const t_idFilter& entry) const { return entry.id; }
+                U32 getHash(U32 key) const { return Types::hashKey(key); }
+                void clear(t_idFilter& entry) const { entry.id = 0; }
+            };
+            U32 m_numIdFilters; //!< number of IDs in m_idFilter, written under the lock and read without it
+            Os::Mutex m_idFilterLock; //!< guards m_idFilter, checked on the threads sending events
 
-            // array of filtered event IDs.
-            // value of 0 means no entry
-            FwEventIdType m_filteredIDs[TELEM_ID_FILTER_SIZE];
+            // most recent event packets, each stored as a 16-bit size followed by the packet
+            U8 m_eventLogStore[ACTIVE_LOGGER_EVENT_LOG_SIZE]; //!< storage of the event log
+            Types::CircularBuffer m_eventLog; //!< event log
+            U32 m_eventLogRecords; //!< number of events in the event log
 
     };
 
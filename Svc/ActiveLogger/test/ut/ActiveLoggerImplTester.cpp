@@ -9,9 +9,11 @@
 #include <Fw/Com/ComBuffer.hpp>
 #include <Fw/Com/ComPacket.hpp>
 #include <Os/IntervalTimer.hpp>
+#include <Os/Task.hpp>
 #include <gtest/gtest.h>
 #include <Fw/Test/UnitTest.hpp>
 #include <Os/Stubs/FileStubs.hpp>
+#include <Fw/Types/SerialBuffer.hpp>
 
 #include <cstdio>
 
@@ -28,7 +30,13 @@ namespace Svc {
             Svc::ActiveLoggerGTestBase("testerbase",100),
             m_impl(inst),
             m_receivedPacket(false),
-            m_receivedFatalEvent(false) {
+            m_sentPackets(0),
+            m_receivedFatalEvent(false),
+            m_testOpenStatus(Os::File::OP_OK),
+            m_testWriteStatus(Os::File::OP_OK),
+            m_writesToWait(0),
+            m_writeTestType(FILE_WRITE_WRITE_ERROR),
+            m_writeSize(0) {
     }
 
     ActiveLoggerImplTester::~ActiveLoggerImplTester() {
@@ -41,6 +49,7 @@ namespace Svc {
         ) {
         this->m_sentPacket = data;
         this->m_receivedPacket = true;
+        this->m_sentPackets++;
     }
 
     void ActiveLoggerImplTester::from_FatalAnnounce_handler(
@@ -380,6 +389,111 @@ namespace Svc {
 
     }
 
+    void ActiveLoggerImplTester::runThrottleId() {
+
+        U32 cmdSeq = 21;
+        const FwEventIdType id = 30;
+        const U32 limit = 3;
+        const U32 sent = 5;
+
+        REQUIREMENT("AL-005");
+
+        Fw::LogBuffer buff;
+        U32 val = 10;
+        Fw::SerializeStatus stat = buff.serialize(val);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+
+        // limit the ID
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_SET_ID_THROTTLE(0,cmdSeq,id,limit);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_SET_ID_THROTTLE,cmdSeq,Fw::CmdResponse::OK);
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_ID_THROTTLE_SET_SIZE(1);
+        ASSERT_EVENTS_ID_THROTTLE_SET(0,id,limit);
+
+        // in each throttle window only the first events up to the limit are queued. The window follows the
+        // interval timer, so events whose time tags change seconds or go back are still counted in the same window
+        for (U32 window = 0; window < 2; window++) {
+            if (window > 0) {
+                ASSERT_EQ(Os::Task::TASK_OK,Os::Task::delay(ActiveLoggerImpl::ID_THROTTLE_WINDOW_USEC / 1000 + 100));
+            }
+            for (U32 event = 0; event < sent; event++) {
+                Fw::Time timeTag(TB_NONE,(event % 2) + 1 - window,event);
+                this->invoke_to_LogRecv(0,id,timeTag,Fw::LogSeverity::ACTIVITY_HI,buff);
+            }
+            for (U32 event = 0; event < limit; event++) {
+                this->m_receivedPacket = false;
+                this->m_impl.doDispatch();
+                ASSERT_TRUE(this->m_receivedPacket);
+                FwPacketDescriptorType desc;
+                FwEventIdType sentId;
+                Fw::Time recTimeTag(TB_NONE,0,0);
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(desc));
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(sentId));
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(recTimeTag));
+                ASSERT_EQ(sentId,id);
+                ASSERT_EQ(recTimeTag.getSeconds(),(event % 2) + 1 - window);
+                ASSERT_EQ(recTimeTag.getUSeconds(),event);
+            }
+        }
+
+        // FATAL events are never throttled
+        Fw::Time fatalTime(TB_NONE,1,sent);
+        this->m_receivedPacket = false;
+        this->invoke_to_LogRecv(0,id,fatalTime,Fw::LogSeverity::FATAL,buff);
+        this->m_impl.doDispatch();
+        ASSERT_TRUE(this->m_receivedPacket);
+
+        // the dump reports the events dropped. Had more events been queued, it would dispatch one of them instead
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_DUMP_FILTER_STATE(0,cmdSeq);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_DUMP_FILTER_STATE,cmdSeq,Fw::CmdResponse::OK);
+        ASSERT_EVENTS_SIZE(6+1);
+        ASSERT_EVENTS_ID_FILTER_ENABLED_SIZE(0);
+        ASSERT_EVENTS_ID_THROTTLE_STATE_SIZE(1);
+        ASSERT_EVENTS_ID_THROTTLE_STATE(0,id,limit,2*(sent-limit));
+
+        // filtering a throttled ID drops all its events, and removing the filter leaves the throttle
+        this->sendCmd_SET_ID_FILTER(0,cmdSeq,id,Enabled::ENABLED);
+        this->m_impl.doDispatch();
+        this->sendCmd_SET_ID_FILTER(0,cmdSeq,id,Enabled::DISABLED);
+        this->m_impl.doDispatch();
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_DUMP_FILTER_STATE(0,cmdSeq);
+        this->m_impl.doDispatch();
+        ASSERT_EVENTS_ID_FILTER_ENABLED_SIZE(0);
+        ASSERT_EVENTS_ID_THROTTLE_STATE_SIZE(1);
+
+        // a limit of 0 removes the throttle
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_SET_ID_THROTTLE(0,cmdSeq,id,0);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_SET_ID_THROTTLE,cmdSeq,Fw::CmdResponse::OK);
+        ASSERT_EVENTS_ID_THROTTLE_SET(0,id,0);
+        ASSERT_EQ(this->m_impl.m_numIdFilters,0u);
+        for (U32 event = 0; event < sent; event++) {
+            Fw::Time timeTag(TB_NONE,2,event);
+            this->m_receivedPacket = false;
+            this->invoke_to_LogRecv(0,id,timeTag,Fw::LogSeverity::ACTIVITY_HI,buff);
+            this->m_impl.doDispatch();
+            ASSERT_TRUE(this->m_receivedPacket);
+        }
+
+        // ID 0 is reserved
+        this->clearHistory();
+        this->sendCmd_SET_ID_THROTTLE(0,cmdSeq,0,limit);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_SET_ID_THROTTLE,cmdSeq,Fw::CmdResponse::VALIDATION_ERROR);
+    }
+
     void ActiveLoggerImplTester::runFilterDump() {
         U32 cmdSeq = 21;
         // set random set of filters
@@ -535,6 +649,201 @@ namespace Svc {
 
     }
 
+    void ActiveLoggerImplTester::runFileDump() {
+        U32 cmdSeq = 21;
+        const char* fileName = "EventLog.bin";
+        const FwEventIdType id = 40;
+
+        REQUIREMENT("AL-006");
+
+        // the log holds the events sent
+        for (U32 event = 0; event < 3; event++) {
+            this->writeEvent(id + event,Fw::LogSeverity::WARNING_HI,10 + event);
+        }
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_DUMP_EVENT_LOG(0,cmdSeq,fileName);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_DUMP_EVENT_LOG,cmdSeq,Fw::CmdResponse::OK);
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_EVENT_LOG_DUMPED_SIZE(1);
+        ASSERT_EVENTS_EVENT_LOG_DUMPED(0,3,fileName);
+
+        Os::File file;
+        ASSERT_EQ(file.open(fileName,Os::File::OPEN_READ),Os::File::OP_OK);
+        for (U32 event = 0; event < 3; event++) {
+            this->readEvent(id + event,Fw::LogSeverity::WARNING_HI,10 + event,file);
+        }
+        U8 extra;
+        NATIVE_INT_TYPE readSize = sizeof(extra);
+        ASSERT_EQ(file.read(&extra,readSize,true),Os::File::OP_OK);
+        ASSERT_EQ(readSize,0);
+        file.close();
+
+        // once full, the log drops the oldest events. A byte of the log store is never used
+        const U32 recordSize = sizeof(U16) + sizeof(FwPacketDescriptorType) + sizeof(FwEventIdType) +
+            Fw::Time::SERIALIZED_SIZE + sizeof(U32);
+        const U32 kept = (ACTIVE_LOGGER_EVENT_LOG_SIZE - 1)/recordSize;
+        const U32 sent = kept + 10;
+        for (U32 event = 0; event < sent; event++) {
+            this->writeEvent(id,Fw::LogSeverity::WARNING_HI,event);
+        }
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_DUMP_EVENT_LOG(0,cmdSeq,fileName);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_DUMP_EVENT_LOG,cmdSeq,Fw::CmdResponse::OK);
+        ASSERT_EVENTS_EVENT_LOG_DUMPED(0,kept,fileName);
+
+        ASSERT_EQ(file.open(fileName,Os::File::OPEN_READ),Os::File::OP_OK);
+        for (U32 event = sent - kept; event < sent; event++) {
+            this->readEvent(id,Fw::LogSeverity::WARNING_HI,event,file);
+        }
+        readSize = sizeof(extra);
+        ASSERT_EQ(file.read(&extra,readSize,true),Os::File::OP_OK);
+        ASSERT_EQ(readSize,0);
+        file.close();
+    }
+
+    void ActiveLoggerImplTester::runFileDumpErrors() {
+        U32 cmdSeq = 21;
+        const char* fileName = "EventLog.bin";
+
+        REQUIREMENT("AL-006");
+
+        this->writeEvent(40,Fw::LogSeverity::WARNING_HI,10);
+
+        // open error
+        this->clearHistory();
+        this->clearEvents();
+        Os::registerOpenInterceptor(this->OpenInterceptor,static_cast<void*>(this));
+        this->m_testOpenStatus = Os::File::NO_PERMISSION;
+        this->sendCmd_DUMP_EVENT_LOG(0,cmdSeq,fileName);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_DUMP_EVENT_LOG,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_EVENT_LOG_DUMP_ERROR_SIZE(1);
+        ASSERT_EVENTS_EVENT_LOG_DUMP_ERROR(0,Os::File::NO_PERMISSION,fileName);
+        Os::clearOpenInterceptor();
+
+        // write error
+        this->clearHistory();
+        this->clearEvents();
+        Os::registerWriteInterceptor(this->WriteInterceptor,static_cast<void*>(this));
+        this->m_writesToWait = 0;
+        this->m_testWriteStatus = Os::File::NO_SPACE;
+        this->m_writeTestType = FILE_WRITE_WRITE_ERROR;
+        this->sendCmd_DUMP_EVENT_LOG(0,cmdSeq,fileName);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_DUMP_EVENT_LOG,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+        ASSERT_EVENTS_EVENT_LOG_DUMP_ERROR_SIZE(1);
+        ASSERT_EVENTS_EVENT_LOG_DUMP_ERROR(0,Os::File::NO_SPACE,fileName);
+        Os::clearWriteInterceptor();
+
+        // write size error
+        this->clearHistory();
+        this->clearEvents();
+        Os::registerWriteInterceptor(this->WriteInterceptor,static_cast<void*>(this));
+        this->m_writesToWait = 0;
+        this->m_writeTestType = FILE_WRITE_SIZE_ERROR;
+        this->m_writeSize = 1;
+        this->sendCmd_DUMP_EVENT_LOG(0,cmdSeq,fileName);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_DUMP_EVENT_LOG,cmdSeq,Fw::CmdResponse::EXECUTION_ERROR);
+        ASSERT_EVENTS_EVENT_LOG_DUMP_ERROR_SIZE(1);
+        ASSERT_EVENTS_EVENT_LOG_DUMP_ERROR(0,Os::File::BAD_SIZE,fileName);
+        Os::clearWriteInterceptor();
+    }
+
+    void ActiveLoggerImplTester::runBatchPackets() {
+        const FwEventIdType id = 50;
+        const NATIVE_UINT_TYPE entrySize = sizeof(FwEventIdType) + Fw::Time::SERIALIZED_SIZE + sizeof(U32);
+        const NATIVE_UINT_TYPE perPacket = (FW_COM_BUFFER_MAX_SIZE - sizeof(FwPacketDescriptorType))/entrySize;
+        Fw::Time timeTag(TB_NONE,1,2);
+
+        REQUIREMENT("AL-007");
+
+        // both settings of ACTIVE_LOGGER_BATCH_PACKETS are checked, whichever is configured
+        const bool configured = this->m_impl.m_batchPackets;
+
+        // without batching, each event is sent in its own packet, leaving nothing for the Run port to send
+        this->m_impl.m_batchPackets = false;
+        this->m_sentPackets = 0;
+        for (U32 event = 0; event <= perPacket; event++) {
+            Fw::LogBuffer buff;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(event));
+            this->invoke_to_LogRecv(0,id,timeTag,Fw::LogSeverity::ACTIVITY_HI,buff);
+            this->m_impl.doDispatch();
+        }
+        ASSERT_EQ(this->m_sentPackets,perPacket + 1);
+        FwPacketDescriptorType desc;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(desc));
+        ASSERT_EQ(desc,static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_LOG));
+        this->invoke_to_Run(0,0);
+        this->m_impl.doDispatch();
+        ASSERT_EQ(this->m_sentPackets,perPacket + 1);
+
+        // with batching, send one more event than fits in a packet
+        this->m_impl.m_batchPackets = true;
+        this->m_sentPackets = 0;
+        for (U32 event = 0; event <= perPacket; event++) {
+            Fw::LogBuffer buff;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(event));
+            this->invoke_to_LogRecv(0,id,timeTag,Fw::LogSeverity::ACTIVITY_HI,buff);
+            this->m_impl.doDispatch();
+        }
+
+        // the full packet is sent under its own descriptor, and the event that did not fit starts the next packet
+        ASSERT_EQ(this->m_sentPackets,1u);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_sentPacket.deserialize(desc));
+        ASSERT_EQ(desc,static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_LOG_BATCH));
+        Fw::LogBatchPacket packet;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,packet.setBuffer(this->m_sentPacket));
+        for (U32 event = 0; event < perPacket; event++) {
+            FwEventIdType sentId;
+            Fw::Time sentTime;
+            Fw::LogBuffer sentBuff;
+            U32 value;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,packet.extractEvent(sentId,sentTime,sentBuff,sizeof(U32)));
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,sentBuff.deserialize(value));
+            ASSERT_EQ(sentId,id);
+            ASSERT_EQ(sentTime,timeTag);
+            ASSERT_EQ(value,event);
+        }
+        ASSERT_EQ(packet.getBuffer().getBuffLeft(),0u);
+
+        // the Run port sends the partial packet, and only if it holds events
+        this->invoke_to_Run(0,0);
+        this->m_impl.doDispatch();
+        ASSERT_EQ(this->m_sentPackets,2u);
+        ASSERT_EQ(this->m_sentPacket.getBuffLength(),sizeof(FwPacketDescriptorType) + entrySize);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,packet.setBuffer(this->m_sentPacket));
+        {
+            FwEventIdType sentId;
+            Fw::Time sentTime;
+            Fw::LogBuffer sentBuff;
+            U32 value;
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,packet.extractEvent(sentId,sentTime,sentBuff,sizeof(U32)));
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,sentBuff.deserialize(value));
+            ASSERT_EQ(value,perPacket);
+        }
+        this->invoke_to_Run(0,0);
+        this->m_impl.doDispatch();
+        ASSERT_EQ(this->m_sentPackets,2u);
+
+        // a FATAL event is sent without waiting for the Run port
+        Fw::LogBuffer buff;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U32>(0)));
+        this->invoke_to_LogRecv(0,id,timeTag,Fw::LogSeverity::FATAL,buff);
+        this->m_impl.doDispatch();
+        ASSERT_EQ(this->m_sentPackets,3u);
+        ASSERT_EQ(this->m_sentPacket.getBuffLength(),sizeof(FwPacketDescriptorType) + entrySize);
+
+        this->m_impl.m_batchPackets = configured;
+    }
+
     void ActiveLoggerImplTester::writeEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value) {
         Fw::LogBuffer buff;
 
@@ -579,19 +888,24 @@ namespace Svc {
     }
 
     void ActiveLoggerImplTester::readEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value, Os::File& file) {
-        static const BYTE delimiter = 0xA5;
-
-        // first read should be delimiter
-        BYTE de;
-        NATIVE_INT_TYPE readSize = sizeof(de);
-
-        ASSERT_EQ(file.read(&de,readSize,true),Os::File::OP_OK);
-        ASSERT_EQ(delimiter,de);
+        // size is specific to this test
+        const U16 packetSize = sizeof(FwPacketDescriptorType) + sizeof(FwEventIdType) + Fw::Time::SERIALIZED_SIZE + sizeof(U32);
+
+        // first read should be packet size
+        U8 sizeBytes[sizeof(U16)];
+        NATIVE_INT_TYPE readSize = sizeof(sizeBytes);
+        ASSERT_EQ(file.read(sizeBytes,readSize,true),Os::File::OP_OK);
+        ASSERT_EQ(readSize,static_cast<NATIVE_INT_TYPE>(sizeof(sizeBytes)));
+        Fw::SerialBuffer sizeBuffer(sizeBytes,sizeof(sizeBytes));
+        sizeBuffer.fill();
+        U16 size;
+        ASSERT_EQ(sizeBuffer.deserialize(size),Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(packetSize,size);
         // next is LogPacket
         Fw::ComBuffer comBuff;
-        // size is specific to this test
-        readSize = sizeof(FwPacketDescriptorType) + sizeof(FwEventIdType) + Fw::Time::SERIALIZED_SIZE + sizeof(U32);
+        readSize = size;
         ASSERT_EQ(file.read(comBuff.getBuffAddr(),readSize,true),Os::File::OP_OK);
+        ASSERT_EQ(readSize,static_cast<NATIVE_INT_TYPE>(size));
         comBuff.setBuffLen(readSize);
 
         // deserialize LogPacket
@@ -610,6 +924,36 @@ namespace Svc {
 
     }
 
+    bool ActiveLoggerImplTester::OpenInterceptor(Os::File::Status& stat, const char* fileName, Os::File::Mode mode, void* ptr) {
+        EXPECT_TRUE(ptr);
+        ActiveLoggerImplTester* compPtr = static_cast<ActiveLoggerImplTester*>(ptr);
+        stat = compPtr->m_testOpenStatus;
+        return false;
+    }
+
+    bool ActiveLoggerImplTester::WriteInterceptor(Os::File::Status& stat, const void * buffer, NATIVE_INT_TYPE &size, bool waitForDone, void* ptr) {
+        EXPECT_TRUE(ptr);
+        ActiveLoggerImplTester* compPtr = static_cast<ActiveLoggerImplTester*>(ptr);
+        if (not compPtr->m_writesToWait--) {
+            // check test scenario
+            switch (compPtr->m_writeTestType) {
+                case FILE_WRITE_WRITE_ERROR:
+                    stat = compPtr->m_testWriteStatus;
+                    break;
+                case FILE_WRITE_SIZE_ERROR:
+                    size = compPtr->m_writeSize;
+                    stat = Os::File::OP_OK;
+                    break;
+                default:
+                    EXPECT_TRUE(false);
+                    break;
+            }
+            return false;
+        } else {
+            return true;
+        }
+    }
+
     void ActiveLoggerImplTester::textLogIn(const FwEventIdType id, //!< The event ID
             Fw::Time& timeTag, //!< The time
             const Fw::LogSeverity severity, //!< The severity
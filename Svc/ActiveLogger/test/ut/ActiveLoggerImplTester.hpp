@@ -24,11 +24,13 @@ namespace Svc {
             void runEventNominal();
             void runFilterEventNominal();
             void runFilterIdNominal();
+            void runThrottleId();
             void runFilterDump();
             void runFilterInvalidCommands();
             void runEventFatal();
             void runFileDump();
             void runFileDumpErrors();
+            void runBatchPackets();
 
         private:
 
@@ -46,6 +48,7 @@ namespace Svc {
 
             bool m_receivedPacket;
             Fw::ComBuffer m_sentPacket;
+            U32 m_sentPackets;
 
             bool m_receivedFatalEvent;
             FwEventIdType m_fatalID;
@@ -23,6 +23,7 @@ void connectPorts(Svc::ActiveLoggerImpl& impl, Svc::ActiveLoggerImplTester& test
     impl.set_FatalAnnounce_OutputPort(0,tester.get_from_FatalAnnounce(0));
 
     tester.connect_to_LogRecv(0,impl.get_LogRecv_InputPort(0));
+    tester.connect_to_Run(0,impl.get_Run_InputPort(0));
 
     impl.set_Log_OutputPort(0,tester.get_from_Log(0));
     impl.set_LogText_OutputPort(0,tester.get_from_LogText(0));
@@ -93,6 +94,25 @@ TEST(ActiveLoggerTest,FilterIdTest) {
 
 }
 
+TEST(ActiveLoggerTest,ThrottleIdTest) {
+
+    TEST_CASE(100.1.6,"Throttle events by ID");
+
+    Svc::ActiveLoggerImpl impl("ActiveLoggerImpl");
+
+    impl.init(10,0);
+
+    Svc::ActiveLoggerImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runThrottleId();
+
+}
+
 TEST(ActiveLoggerTest,FilterDumpTest) {
 
     TEST_CASE(100.1.3,"Dump filter values");
@@ -150,6 +170,63 @@ TEST(ActiveLoggerTest,FatalTesting) {
 
 }
 
+TEST(ActiveLoggerTest,EventLogDump) {
+
+    TEST_CASE(100.1.7,"Dump the event log to a file");
+
+    Svc::ActiveLoggerImpl impl("ActiveLoggerImpl");
+
+    impl.init(10,0);
+
+    Svc::ActiveLoggerImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runFileDump();
+
+}
+
+TEST(ActiveLoggerTest,BatchPackets) {
+
+    TEST_CASE(100.1.8,"Batch events into multi-event packets");
+
+    Svc::ActiveLoggerImpl impl("ActiveLoggerImpl");
+
+    impl.init(10,0);
+
+    Svc::ActiveLoggerImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runBatchPackets();
+
+}
+
+TEST(ActiveLoggerTest,EventLogDumpErrors) {
+
+    TEST_CASE(100.2.3,"Off-Nominal event log file errors");
+
+    Svc::ActiveLoggerImpl impl("ActiveLoggerImpl");
+
+    impl.init(10,0);
+
+    Svc::ActiveLoggerImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runFileDumpErrors();
+
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
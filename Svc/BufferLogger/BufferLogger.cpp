@@ -53,6 +53,40 @@ namespace Svc {
       m_file.init(logFilePrefix, logFileSuffix, maxFileSize, sizeOfSize);
   }
 
+  void BufferLogger ::
+    allocateStaging(
+        const NATIVE_UINT_TYPE identifier,
+        Fw::MemAllocator& allocator,
+        const U32 stagingSize,
+        const U32 numBuffers
+    )
+  {
+      m_file.allocateStaging(identifier, allocator, stagingSize, numBuffers);
+  }
+
+  void BufferLogger ::
+    deallocateStaging(Fw::MemAllocator& allocator)
+  {
+      m_file.deallocateStaging(allocator);
+  }
+
+  void BufferLogger ::
+    startWriter(
+        const Fw::StringBase& name,
+        const NATIVE_UINT_TYPE priority,
+        const NATIVE_UINT_TYPE stack,
+        const NATIVE_UINT_TYPE cpuAffinity
+    )
+  {
+      m_file.startWriter(name, priority, stack, cpuAffinity);
+  }
+
+  void BufferLogger ::
+    stopWriter()
+  {
+      m_file.stopWriter();
+  }
+
   // ----------------------------------------------------------------------
   // Handler implementations for user-defined typed input ports
   // ----------------------------------------------------------------------
@@ -97,7 +131,8 @@ namespace Svc {
         NATIVE_UINT_TYPE context
     )
   {
-    // TODO
+    // Bound how long buffers stay staged in memory
+    m_file.writeStaging();
   }
 
   // ----------------------------------------------------------------------
@@ -18,6 +18,9 @@
 #include "Fw/Types/String.hpp"
 #include "Fw/Types/Assert.hpp"
 #include "Os/Mutex.hpp"
+#include "Os/Queue.hpp"
+#include "Os/Task.hpp"
+#include "Fw/Types/MemAllocator.hpp"
 #include "Utils/Hash/Hash.hpp"
 
 namespace Svc {
@@ -80,10 +83,45 @@ namespace Svc {
           void closeAndEmitEvent();
 
           //! Flush the file
+          //! \return Whether every staged write since the last flush succeeded
           bool flush();
 
+          //! Write out the staging buffer, handing it to the writer task if it is running
+          void writeStaging();
+
+          //! Allocate memory for staging buffers
+          void allocateStaging(
+              const NATIVE_UINT_TYPE identifier, //!< The memory segment identifier
+              Fw::MemAllocator& allocator, //!< The memory allocator
+              const U32 stagingSize, //!< The size of each staging buffer
+              const U32 numBuffers //!< The number of staging buffers
+          );
+
+          //! Write out the staged buffers and return the staging memory
+          void deallocateStaging(
+              Fw::MemAllocator& allocator //!< The memory allocator
+          );
+
+          //! Start the writer task
+          void startWriter(
+              const Fw::StringBase& name, //!< The task name
+              const NATIVE_UINT_TYPE priority, //!< The task priority
+              const NATIVE_UINT_TYPE stack, //!< The task stack size
+              const NATIVE_UINT_TYPE cpuAffinity //!< The task cpu affinity
+          );
+
+          //! Wait for the writer task to write out the buffers handed to it, then stop it
+          void stopWriter();
+
         PRIVATE:
 
+          //! A staging buffer handed to the writer task, or returned by it once written
+          struct StagingMessage {
+            U32 index; //!< The staging buffer index
+            U32 length; //!< The number of bytes to write; zero stops the writer task
+            bool status; //!< Whether the write succeeded
+          };
+
           //! Open the file
           void open();
 
@@ -100,6 +138,38 @@ namespace Svc {
               const U32 size //!< The size
           );
 
+          //! Serialize the size field of a buffer
+          void serializeSize(
+              const U32 size, //!< The size
+              U8 *const sizeBuffer //!< The destination, sizeOfSize bytes long
+          );
+
+          //! Copy a buffer and its size field into the staging buffer,
+          //! writing out the staging buffer first if the buffer does not fit
+          void stageBuffer(
+              const U8 *const data, //!< The buffer data
+              const U32 size //!< The size
+          );
+
+          //! Write a staging buffer to the file
+          //! Called on the writer task when it is running
+          //! \return Success or failure
+          bool writeStagingBuffer(
+              const U32 index, //!< The staging buffer index
+              const U32 length //!< The number of bytes to write
+          );
+
+          //! Wait for the writer task to return one staging buffer
+          void receiveWritten();
+
+          //! Wait for the writer task to return all staging buffers
+          void waitForWriter();
+
+          //! The writer task
+          static void writerTask(
+              void* pointer //!< Pointer to the File
+          );
+
           //! Write bytes to a file
           //! \return Success or failure
           bool writeBytes(
@@ -145,9 +215,52 @@ namespace Svc {
           //! The underlying Os::File representation
           Os::File osFile;
 
-          //! The number of bytes written to the current file
+          //! The number of bytes written or staged to the current file
           U32 bytesWritten;
 
+          //! The hash of the bytes written or staged to the current file
+          Utils::Hash hash;
+
+          //! Whether the hash matches the file; false after a failed write,
+          //! when the hash file must read the file back
+          bool hashValid;
+
+          //! The staging memory segment identifier
+          NATIVE_UINT_TYPE stagingId;
+
+          //! The staging memory; nullptr when buffers are written as they arrive
+          U8* stagingMemory;
+
+          //! The size of each staging buffer
+          U32 stagingSize;
+
+          //! The number of staging buffers
+          U32 numStagingBuffers;
+
+          //! The index of the staging buffer being filled
+          U32 stagingIndex;
+
+          //! The number of bytes in the staging buffer being filled
+          U32 stagingLength;
+
+          //! The number of staging buffers held by the writer task
+          U32 stagingInFlight;
+
+          //! Whether a staged write failed since the last flush
+          bool stagingWriteFailed;
+
+          //! Whether the writer task is running
+          bool writerRunning;
+
+          //! The writer task
+          Os::Task writer;
+
+          //! Staging buffers to write, sent to the writer task
+          Os::Queue writeQueue;
+
+          //! Staging buffers written, returned by the writer task
+          Os::Queue writtenQueue;
+
       }; // class File
 
     public:
@@ -179,6 +292,36 @@ namespace Svc {
           const U8 sizeOfSize //!< The number of bytes to use when storing the size field at the start of each buffer
       );
 
+      //! Allocate staging buffers, so that buffers are gathered in memory
+      //! and written to the log file in large writes.
+      //! Only call this before opening a log file.
+      void allocateStaging(
+          const NATIVE_UINT_TYPE identifier, //!< The memory segment identifier
+          Fw::MemAllocator& allocator, //!< The memory allocator
+          const U32 stagingSize, //!< The size of each staging buffer
+          const U32 numBuffers //!< The number of staging buffers
+      );
+
+      //! Write out the staged buffers and return the staging memory.
+      //! Stop the writer task first.
+      void deallocateStaging(
+          Fw::MemAllocator& allocator //!< The memory allocator
+      );
+
+      //! Start a task writing full staging buffers to the log file, so that
+      //! the component only waits on the file when every staging buffer is
+      //! waiting to be written. Requires at least two staging buffers.
+      void startWriter(
+          const Fw::StringBase& name, //!< The task name
+          const NATIVE_UINT_TYPE priority = Os::Task::TASK_DEFAULT, //!< The task priority
+          const NATIVE_UINT_TYPE stack = Os::Task::TASK_DEFAULT, //!< The task stack size
+          const NATIVE_UINT_TYPE cpuAffinity = Os::Task::TASK_DEFAULT //!< The task cpu affinity
+      );
+
+      //! Stop the writer task once it has written the buffers handed to it.
+      //! Call this while the component thread is stopped.
+      void stopWriter();
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
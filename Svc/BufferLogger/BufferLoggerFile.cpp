@@ -32,7 +32,17 @@ namespace Svc {
       maxSize(0),
       sizeOfSize(0),
       mode(Mode::CLOSED),
-      bytesWritten(0)
+      bytesWritten(0),
+      hashValid(false),
+      stagingId(0),
+      stagingMemory(nullptr),
+      stagingSize(0),
+      numStagingBuffers(0),
+      stagingIndex(0),
+      stagingLength(0),
+      stagingInFlight(0),
+      stagingWriteFailed(false),
+      writerRunning(false)
   {
   }
 
@@ -103,6 +113,130 @@ namespace Svc {
     }
   }
 
+  void BufferLogger::File ::
+    writeStaging()
+  {
+    if (this->stagingLength == 0) {
+      return;
+    }
+    if (this->writerRunning) {
+      StagingMessage message = { this->stagingIndex, this->stagingLength, true };
+      const Os::Queue::QueueStatus stat = this->writeQueue.send(
+          reinterpret_cast<U8*>(&message),
+          sizeof(message),
+          0,
+          Os::Queue::QUEUE_BLOCKING
+      );
+      FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+      this->stagingInFlight++;
+      this->stagingIndex = (this->stagingIndex + 1) % this->numStagingBuffers;
+      // The next staging buffer is still held by the writer when all of them are
+      if (this->stagingInFlight == this->numStagingBuffers) {
+        this->receiveWritten();
+      }
+    }
+    else if (not this->writeStagingBuffer(this->stagingIndex, this->stagingLength)) {
+      this->stagingWriteFailed = true;
+      this->hashValid = false;
+    }
+    this->stagingLength = 0;
+  }
+
+  void BufferLogger::File ::
+    allocateStaging(
+        const NATIVE_UINT_TYPE identifier,
+        Fw::MemAllocator& allocator,
+        const U32 stagingSize,
+        const U32 numBuffers
+    )
+  {
+    FW_ASSERT(this->mode == File::Mode::CLOSED);
+    FW_ASSERT(this->stagingMemory == nullptr);
+    FW_ASSERT(stagingSize > 0);
+    FW_ASSERT(numBuffers > 0);
+    this->stagingId = identifier;
+    NATIVE_UINT_TYPE memSize = stagingSize * numBuffers;
+    bool recoverable = false;
+    this->stagingMemory = static_cast<U8*>(
+        allocator.allocate(identifier, memSize, recoverable)
+    );
+    FW_ASSERT(this->stagingMemory != nullptr);
+    // Use as many whole staging buffers as were allocated
+    this->numStagingBuffers = memSize / stagingSize;
+    FW_ASSERT(this->numStagingBuffers > 0, memSize);
+    this->stagingSize = stagingSize;
+    this->stagingIndex = 0;
+    this->stagingLength = 0;
+  }
+
+  void BufferLogger::File ::
+    deallocateStaging(Fw::MemAllocator& allocator)
+  {
+    FW_ASSERT(not this->writerRunning);
+    this->writeStaging();
+    if (this->stagingMemory != nullptr) {
+      allocator.deallocate(this->stagingId, this->stagingMemory);
+      this->stagingMemory = nullptr;
+    }
+    this->stagingSize = 0;
+    this->numStagingBuffers = 0;
+  }
+
+  void BufferLogger::File ::
+    startWriter(
+        const Fw::StringBase& name,
+        const NATIVE_UINT_TYPE priority,
+        const NATIVE_UINT_TYPE stack,
+        const NATIVE_UINT_TYPE cpuAffinity
+    )
+  {
+    FW_ASSERT(not this->writerRunning);
+    // With one staging buffer the component would wait on every write
+    FW_ASSERT(this->numStagingBuffers > 1, this->numStagingBuffers);
+    Os::Queue::QueueStatus stat = this->writeQueue.create(
+        Os::QueueString("BufferLoggerWrite"),
+        this->numStagingBuffers,
+        sizeof(StagingMessage)
+    );
+    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    stat = this->writtenQueue.create(
+        Os::QueueString("BufferLoggerWritten"),
+        this->numStagingBuffers,
+        sizeof(StagingMessage)
+    );
+    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    const Os::Task::TaskStatus taskStat = this->writer.start(
+        name,
+        BufferLogger::File::writerTask,
+        this,
+        priority,
+        stack,
+        cpuAffinity
+    );
+    FW_ASSERT(taskStat == Os::Task::TASK_OK, taskStat);
+    this->writerRunning = true;
+  }
+
+  void BufferLogger::File ::
+    stopWriter()
+  {
+    if (not this->writerRunning) {
+      return;
+    }
+    this->waitForWriter();
+    StagingMessage message = { 0, 0, true };
+    const Os::Queue::QueueStatus stat = this->writeQueue.send(
+        reinterpret_cast<U8*>(&message),
+        sizeof(message),
+        0,
+        Os::Queue::QUEUE_BLOCKING
+    );
+    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    const Os::Task::TaskStatus taskStat = this->writer.join(nullptr);
+    FW_ASSERT(taskStat == Os::Task::TASK_OK, taskStat);
+    this->writerRunning = false;
+  }
+
   void BufferLogger::File ::
     closeAndEmitEvent()
   {
@@ -156,6 +290,9 @@ namespace Svc {
       this->fileCounter++;
       // Reset bytes written
       this->bytesWritten = 0;
+      // Reset hash
+      this->hash.init();
+      this->hashValid = true;
       // Set mode
       this->mode = File::Mode::OPEN;
     }
@@ -171,6 +308,14 @@ namespace Svc {
         const U32 size
     )
   {
+    if ((this->stagingMemory != nullptr) &&
+        (this->sizeOfSize + size <= this->stagingSize)) {
+      this->stageBuffer(data, size);
+      return true;
+    }
+    // Write out the staged buffers ahead of one too big to stage
+    this->writeStaging();
+    this->waitForWriter();
     bool status = this->writeSize(size);
     if (status) {
       status = this->writeBytes(data, size);
@@ -178,16 +323,25 @@ namespace Svc {
     return status;
   }
 
-  bool BufferLogger::File ::
-    writeSize(const U32 size)
+  void BufferLogger::File ::
+    serializeSize(
+        const U32 size,
+        U8 *const sizeBuffer
+    )
   {
     FW_ASSERT(this->sizeOfSize <= sizeof(U32));
-    U8 sizeBuffer[sizeof(U32)];
     U32 sizeRegister = size;
     for (U8 i = 0; i < this->sizeOfSize; ++i) {
       sizeBuffer[this->sizeOfSize - i - 1] = sizeRegister & 0xFF;
       sizeRegister >>= 8;
     }
+  }
+
+  bool BufferLogger::File ::
+    writeSize(const U32 size)
+  {
+    U8 sizeBuffer[sizeof(U32)];
+    this->serializeSize(size, sizeBuffer);
     const bool status = this->writeBytes(
         sizeBuffer,
         this->sizeOfSize
@@ -207,9 +361,11 @@ namespace Svc {
     bool status;
     if (fileStatus == Os::File::OP_OK && size == static_cast<NATIVE_INT_TYPE>(length)) {
       this->bytesWritten += length;
+      this->hash.update(data, length);
       status = true;
     }
     else {
+      this->hashValid = false;
       Fw::LogStringArg string(this->name.toChar());
 
       this->bufferLogger.log_WARNING_HI_BL_LogFileWriteError(fileStatus, size, length, string);
@@ -218,12 +374,123 @@ namespace Svc {
     return status;
   }
 
+  void BufferLogger::File ::
+    stageBuffer(
+        const U8 *const data,
+        const U32 size
+    )
+  {
+    const U32 recordSize = this->sizeOfSize + size;
+    FW_ASSERT(recordSize <= this->stagingSize, recordSize, this->stagingSize);
+    if (recordSize > this->stagingSize - this->stagingLength) {
+      this->writeStaging();
+    }
+    U8 *const staging =
+      &this->stagingMemory[this->stagingIndex * this->stagingSize + this->stagingLength];
+    this->serializeSize(size, staging);
+    this->hash.update(staging, this->sizeOfSize);
+    if (size > 0) {
+      this->hash.updateCopy(&staging[this->sizeOfSize], data, size);
+    }
+    this->stagingLength += recordSize;
+    this->bytesWritten += recordSize;
+  }
+
+  bool BufferLogger::File ::
+    writeStagingBuffer(
+        const U32 index,
+        const U32 length
+    )
+  {
+    FW_ASSERT(index < this->numStagingBuffers, index);
+    FW_ASSERT(length <= this->stagingSize, length);
+    NATIVE_INT_TYPE size = length;
+    const Os::File::Status fileStatus =
+      this->osFile.write(&this->stagingMemory[index * this->stagingSize], size);
+    if (fileStatus == Os::File::OP_OK && size == static_cast<NATIVE_INT_TYPE>(length)) {
+      return true;
+    }
+    Fw::LogStringArg string(this->name.toChar());
+    this->bufferLogger.log_WARNING_HI_BL_LogFileWriteError(fileStatus, size, length, string);
+    return false;
+  }
+
+  void BufferLogger::File ::
+    receiveWritten()
+  {
+    FW_ASSERT(this->stagingInFlight > 0);
+    StagingMessage message;
+    NATIVE_INT_TYPE size = 0;
+    NATIVE_INT_TYPE priority = 0;
+    const Os::Queue::QueueStatus stat = this->writtenQueue.receive(
+        reinterpret_cast<U8*>(&message),
+        sizeof(message),
+        size,
+        priority,
+        Os::Queue::QUEUE_BLOCKING
+    );
+    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    FW_ASSERT(size == sizeof(message), size);
+    this->stagingInFlight--;
+    if (not message.status) {
+      this->stagingWriteFailed = true;
+      this->hashValid = false;
+    }
+  }
+
+  void BufferLogger::File ::
+    waitForWriter()
+  {
+    while (this->stagingInFlight > 0) {
+      this->receiveWritten();
+    }
+  }
+
+  void BufferLogger::File ::
+    writerTask(void* pointer)
+  {
+    FW_ASSERT(pointer != nullptr);
+    File* file = static_cast<File*>(pointer);
+    while (true) {
+      StagingMessage message;
+      NATIVE_INT_TYPE size = 0;
+      NATIVE_INT_TYPE priority = 0;
+      Os::Queue::QueueStatus stat = file->writeQueue.receive(
+          reinterpret_cast<U8*>(&message),
+          sizeof(message),
+          size,
+          priority,
+          Os::Queue::QUEUE_BLOCKING
+      );
+      FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+      FW_ASSERT(size == sizeof(message), size);
+      if (message.length == 0) {
+        break;
+      }
+      message.status = file->writeStagingBuffer(message.index, message.length);
+      stat = file->writtenQueue.send(
+          reinterpret_cast<U8*>(&message),
+          sizeof(message),
+          0,
+          Os::Queue::QUEUE_BLOCKING
+      );
+      FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    }
+  }
+
   void BufferLogger::File ::
     writeHashFile()
   {
     Os::ValidatedFile validatedFile(this->name.toChar());
-    const Os::ValidateFile::Status status =
-      validatedFile.createHashFile();
+    Os::ValidateFile::Status status;
+    if (this->hashValid) {
+      Utils::HashBuffer hashBuffer;
+      this->hash.final(hashBuffer);
+      status = validatedFile.createHashFile(hashBuffer);
+    }
+    else {
+      status = validatedFile.createHashFile();
+    }
     if (status !=  Os::ValidateFile::VALIDATION_OK) {
       const Fw::String &hashFileName = validatedFile.getHashFileName();
       Fw::LogStringArg logStringArg(hashFileName.toChar());
@@ -237,7 +504,12 @@ namespace Svc {
   bool BufferLogger::File ::
   flush()
   {
-    return true;
+    // Write out the staged buffers and wait for them to reach the file
+    this->writeStaging();
+    this->waitForWriter();
+    const bool status = not this->stagingWriteFailed;
+    this->stagingWriteFailed = false;
+    return status;
     // NOTE(if your fprime uses buffered file I/O, re-enable this)
     /*bool status = true;
     if(this->mode == File::Mode::OPEN)
@@ -259,6 +531,9 @@ namespace Svc {
     close()
   {
     if (this->mode == File::Mode::OPEN) {
+      // Write out the staged buffers
+      this->writeStaging();
+      this->waitForWriter();
       // Close file
       this->osFile.close();
       // Write out the hash file to disk
@@ -12,6 +12,7 @@
 
 #include "Logging.hpp"
 #include "Os/FileSystem.hpp"
+#include "Fw/Types/MallocAllocator.hpp"
 
 namespace Svc {
 
@@ -210,6 +211,91 @@ namespace Svc {
       tester.test(3, "BufferSendIn");
     }
 
+    //! The size of a logged com buffer and its size field
+    static const U32 RECORD_SIZE = COM_BUFFER_LENGTH + sizeof(SIZE_TYPE);
+
+    class StagingTester :
+      public ComInTester
+    {
+
+      public:
+
+        //! Check that buffers stay in memory until flushed
+        void testFlush() {
+          this->sendCmd_BL_OpenFile(0, 0, "StagingFlush");
+          this->dispatchOne();
+          this->sendComBuffers(1);
+          this->checkFileSize(0);
+          this->clearHistory();
+          this->sendCmd_BL_FlushFile(0, 0);
+          this->dispatchOne();
+          ASSERT_CMD_RESPONSE_SIZE(1);
+          ASSERT_CMD_RESPONSE(
+              0,
+              BufferLogger::OPCODE_BL_FLUSHFILE,
+              0,
+              Fw::CmdResponse::OK
+          );
+          this->checkFileSize(RECORD_SIZE);
+          this->sendCmd_BL_CloseFile(0, 0);
+          this->dispatchOne();
+          this->checkLogFileIntegrity(
+              this->component.m_file.name.toChar(),
+              RECORD_SIZE,
+              1
+          );
+          this->clearHistory();
+        }
+
+      private:
+
+        //! Check the size of the open file
+        void checkFileSize(const U64 expectedSize) {
+          U64 size = 0;
+          const Os::FileSystem::Status status = Os::FileSystem::getFileSize(
+              this->component.m_file.name.toChar(),
+              size
+          );
+          ASSERT_EQ(Os::FileSystem::OP_OK, status);
+          ASSERT_EQ(expectedSize, size);
+        }
+
+    };
+
+    void Tester ::
+      Staging()
+    {
+      Fw::MallocAllocator allocator;
+      {
+        // Two buffers fit in each staging buffer
+        StagingTester tester;
+        tester.component.allocateStaging(0, allocator, 2*RECORD_SIZE, 2);
+        tester.testFlush();
+        tester.test(3, "Staging");
+        tester.component.deallocateStaging(allocator);
+      }
+      {
+        // Buffers too big to stage are written directly
+        StagingTester tester;
+        tester.component.allocateStaging(0, allocator, RECORD_SIZE - 1, 2);
+        tester.test(3, "StagingTooBig");
+        tester.component.deallocateStaging(allocator);
+      }
+    }
+
+    void Tester ::
+      StagingWriter()
+    {
+      Fw::MallocAllocator allocator;
+      StagingTester tester;
+      tester.component.allocateStaging(0, allocator, 2*RECORD_SIZE, 3);
+      tester.component.startWriter(Fw::String("BLWriter"));
+      tester.testFlush();
+      tester.test(3, "StagingWriter");
+      tester.component.stopWriter();
+      tester.component.deallocateStaging(allocator);
+    }
+
     class OnOffTester :
       Logging::Tester
     {
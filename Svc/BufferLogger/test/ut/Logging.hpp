@@ -41,6 +41,12 @@ namespace Svc {
         //! Test logging on/off capability
         void OnOff();
 
+        //! Test logging through staging buffers
+        void Staging();
+
+        //! Test logging through staging buffers written by the writer task
+        void StagingWriter();
+
     };
 
   }
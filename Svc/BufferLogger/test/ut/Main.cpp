@@ -55,6 +55,16 @@ TEST(TestLogging, OnOff) {
   tester.OnOff();
 }
 
+TEST(TestLogging, Staging) {
+  Svc::Logging::Tester tester;
+  tester.Staging();
+}
+
+TEST(TestLogging, StagingWriter) {
+  Svc::Logging::Tester tester;
+  tester.StagingWriter();
+}
+
 // ----------------------------------------------------------------------
 // Test Health
 // ----------------------------------------------------------------------
@@ -31,6 +31,7 @@ namespace Svc {
     ,m_cleaned(false)
     ,m_mgrId(0)
     ,m_buffers(nullptr)
+    ,m_numBins(0)
     ,m_allocator(nullptr)
     ,m_memId(0)
     ,m_numStructs(0)
@@ -107,8 +108,9 @@ namespace Svc {
       FW_ASSERT(reinterpret_cast<U8*>(fwBuffer.getData()) < (this->m_buffers[id].memory + this->m_buffers[id].size),id,this->m_mgrId);
       // user can make smaller for their own purposes, but it shouldn't be bigger
       FW_ASSERT(fwBuffer.getSize() <= this->m_buffers[id].size,id,this->m_mgrId);
-      // clear the allocated flag
+      // clear the allocated flag and make the buffer available again
       this->m_buffers[id].allocated = false;
+      this->pushFree(id);
       this->m_currBuffs--;
   }
 
@@ -121,9 +123,19 @@ namespace Svc {
       // make sure component has been set up
       FW_ASSERT(this->m_setup);
       FW_ASSERT(m_buffers);
-      // find smallest buffer based on size.
-      for (NATIVE_UINT_TYPE buff = 0; buff < this->m_numStructs; buff++) {
-          if ((not this->m_buffers[buff].allocated) and (size <= this->m_buffers[buff].size)) {
+      // find smallest buffer based on size. Bins are searched from smallest to largest.
+      for (NATIVE_UINT_TYPE order = 0; order < this->m_numBins; order++) {
+          const NATIVE_UINT_TYPE bin = this->m_binOrder[order];
+          FreeList& freeList = this->m_freeLists[bin];
+          if ((freeList.head != NO_BUFFER) and (size <= this->m_bufferBins.bins[bin].bufferSize)) {
+              // take the buffer off the head of the free list
+              const NATIVE_UINT_TYPE buff = freeList.head;
+              FW_ASSERT(buff < this->m_numStructs,buff,this->m_numStructs);
+              FW_ASSERT(not this->m_buffers[buff].allocated,buff,this->m_mgrId);
+              freeList.head = this->m_buffers[buff].nextFree;
+              if (freeList.head == NO_BUFFER) {
+                  freeList.tail = NO_BUFFER;
+              }
               this->m_buffers[buff].allocated = true;
               this->m_currBuffs++;
               if (this->m_currBuffs > this->m_highWater) {
@@ -143,6 +155,21 @@ namespace Svc {
 
   }
 
+  void BufferManagerComponentImpl ::
+    pushFree(
+        NATIVE_UINT_TYPE id
+    )
+  {
+      FreeList& freeList = this->m_freeLists[this->m_buffers[id].bin];
+      this->m_buffers[id].nextFree = NO_BUFFER;
+      if (freeList.tail == NO_BUFFER) {
+          freeList.head = id;
+      } else {
+          this->m_buffers[freeList.tail].nextFree = id;
+      }
+      freeList.tail = id;
+  }
+
   void BufferManagerComponentImpl::setup(
     NATIVE_UINT_TYPE mgrId, //!< manager ID
     NATIVE_UINT_TYPE memId, //!< Memory segment identifier
@@ -185,6 +212,24 @@ namespace Svc {
     // struct past the number of structs
     U8* bufferMem = reinterpret_cast<U8*>(&this->m_buffers[this->m_numStructs]);
 
+    // sort used bins by buffer size so requests are filled from the best fitting bin.
+    // Insertion sort keeps bins of equal size in table order.
+    this->m_numBins = 0;
+    for (NATIVE_UINT_TYPE bin = 0; bin < BUFFERMGR_MAX_NUM_BINS; bin++) {
+        this->m_freeLists[bin].head = NO_BUFFER;
+        this->m_freeLists[bin].tail = NO_BUFFER;
+        if (this->m_bufferBins.bins[bin].numBuffers) {
+            NATIVE_UINT_TYPE order = this->m_numBins;
+            while ((order > 0) and
+                   (this->m_bufferBins.bins[this->m_binOrder[order - 1]].bufferSize > this->m_bufferBins.bins[bin].bufferSize)) {
+                this->m_binOrder[order] = this->m_binOrder[order - 1];
+                order--;
+            }
+            this->m_binOrder[order] = bin;
+            this->m_numBins++;
+        }
+    }
+
     // walk through entries and initialize them
     NATIVE_UINT_TYPE currStruct = 0;
     for (NATIVE_UINT_TYPE bin = 0; bin < BUFFERMGR_MAX_NUM_BINS; bin++) {
@@ -197,6 +242,8 @@ namespace Svc {
                 this->m_buffers[currStruct].allocated = false;
                 this->m_buffers[currStruct].memory = bufferMem;
                 this->m_buffers[currStruct].size = this->m_bufferBins.bins[bin].bufferSize;
+                this->m_buffers[currStruct].bin = bin;
+                this->pushFree(currStruct);
                 bufferMem += this->m_bufferBins.bins[bin].bufferSize;
                 currStruct++;
             }
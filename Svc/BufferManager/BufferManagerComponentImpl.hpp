@@ -28,10 +28,10 @@ namespace Svc
     // The rules for specifying bins:
     // 1. For each bin (BufferBins.bins[n]), specify the size of the buffers (bufferSize) in the
     //    bin and how many buffers for that bin (numBuffers).
-    // 2. The bins should be ordered based on an increasing bufferSize to allow BufferManager to
-    //    search for available buffers. When receiving a request for a buffer, the component will
-    //    search for the first buffer from the bins that is equal to or greater
-    //    than the requested size, starting at the beginning of the table.
+    // 2. The bins may be listed in any order. When receiving a request for a buffer, the component
+    //    will take the next free buffer from the bin with the smallest bufferSize that is equal to or
+    //    greater than the requested size, moving to larger bins when that bin is empty. Each bin keeps
+    //    a list of its free buffers, so finding a buffer does not depend on the number of buffers.
     // 3. Any unused bins should have numBuffers set to 0.
     // 4. A single bin can be specified if a single size is needed.
     //
@@ -143,9 +143,29 @@ namespace Svc
             U8 *memory;      //!< pointer to memory buffer
             U32 size;        //!< size of the buffer
             bool allocated;  //!< this buffer has been allocated
+            NATIVE_UINT_TYPE bin; //!< bin the buffer belongs to
+            NATIVE_UINT_TYPE nextFree; //!< next buffer in the bin's free list
         };
 
+        //! Free list of a bin. Buffers are taken from the head and returned to the tail.
+        struct FreeList
+        {
+            NATIVE_UINT_TYPE head; //!< first free buffer, or NO_BUFFER if none are free
+            NATIVE_UINT_TYPE tail; //!< last free buffer, or NO_BUFFER if none are free
+        };
+
+        //! Marks the end of a free list
+        static const NATIVE_UINT_TYPE NO_BUFFER = 0xFFFFFFFF;
+
+        //! Add a buffer to the end of its bin's free list
+        void pushFree(
+            NATIVE_UINT_TYPE id //!< index of the buffer
+        );
+
         AllocatedBuffer *m_buffers;    //!< pointer to allocated buffer space
+        FreeList m_freeLists[BUFFERMGR_MAX_NUM_BINS]; //!< free buffers of each bin
+        NATIVE_UINT_TYPE m_binOrder[BUFFERMGR_MAX_NUM_BINS]; //!< used bins in order of increasing buffer size
+        NATIVE_UINT_TYPE m_numBins; //!< number of used bins
         Fw::MemAllocator *m_allocator; //!< allocator for memory
         NATIVE_UINT_TYPE m_memId; //!< identifier for allocator
         NATIVE_UINT_TYPE m_numStructs; //!< number of allocated structs
@@ -504,6 +504,82 @@ namespace Svc {
 
 
 
+  void Tester::unorderedBins() {
+
+      // largest bin first, smallest bin last
+      BufferManagerComponentImpl::BufferBins bins;
+      memset(&bins,0,sizeof(bins));
+      bins.bins[0].bufferSize = BIN2_BUFFER_SIZE;
+      bins.bins[0].numBuffers = BIN2_NUM_BUFFERS;
+      bins.bins[1].bufferSize = BIN1_BUFFER_SIZE;
+      bins.bins[1].numBuffers = BIN1_NUM_BUFFERS;
+      bins.bins[2].bufferSize = BIN0_BUFFER_SIZE;
+      bins.bins[2].numBuffers = BIN0_NUM_BUFFERS;
+
+      TestAllocator alloc;
+
+      this->component.setup(MGR_ID,MEM_ID,alloc,bins);
+
+      // buffers of each bin in the tracking structs
+      const NATIVE_UINT_TYPE bin2Start = 0;
+      const NATIVE_UINT_TYPE bin1Start = BIN2_NUM_BUFFERS;
+      const NATIVE_UINT_TYPE bin0Start = BIN2_NUM_BUFFERS + BIN1_NUM_BUFFERS;
+
+      Fw::Buffer buffs[BIN0_NUM_BUFFERS+BIN1_NUM_BUFFERS+BIN2_NUM_BUFFERS];
+
+      // smallest requests come from the smallest bin first, then the next larger bins
+      NATIVE_UINT_TYPE b = 0;
+      for (NATIVE_UINT_TYPE entry = 0; entry < BIN0_NUM_BUFFERS; entry++, b++) {
+          buffs[b] = this->invoke_to_bufferGetCallee(0,BIN0_BUFFER_SIZE);
+          ASSERT_EQ((MGR_ID << 16) | (bin0Start + entry),buffs[b].getContext());
+          ASSERT_TRUE(this->component.m_buffers[bin0Start + entry].allocated);
+      }
+      for (NATIVE_UINT_TYPE entry = 0; entry < BIN1_NUM_BUFFERS; entry++, b++) {
+          buffs[b] = this->invoke_to_bufferGetCallee(0,BIN0_BUFFER_SIZE);
+          ASSERT_EQ((MGR_ID << 16) | (bin1Start + entry),buffs[b].getContext());
+      }
+      for (NATIVE_UINT_TYPE entry = 0; entry < BIN2_NUM_BUFFERS; entry++, b++) {
+          buffs[b] = this->invoke_to_bufferGetCallee(0,BIN0_BUFFER_SIZE);
+          ASSERT_EQ((MGR_ID << 16) | (bin2Start + entry),buffs[b].getContext());
+      }
+      ASSERT_EQ(BIN0_NUM_BUFFERS+BIN1_NUM_BUFFERS+BIN2_NUM_BUFFERS,this->component.m_currBuffs);
+
+      // pool is empty
+      Fw::Buffer noBuff = this->invoke_to_bufferGetCallee(0,BIN0_BUFFER_SIZE);
+      ASSERT_EQ(0U,noBuff.getSize());
+      ASSERT_EQ(1U,this->component.m_noBuffs);
+
+      // return two bin 1 buffers out of order. They are reused in the order returned.
+      this->invoke_to_bufferSendIn(0,buffs[BIN0_NUM_BUFFERS + 2]);
+      this->invoke_to_bufferSendIn(0,buffs[BIN0_NUM_BUFFERS + 0]);
+      ASSERT_FALSE(this->component.m_buffers[bin1Start + 2].allocated);
+      ASSERT_FALSE(this->component.m_buffers[bin1Start + 0].allocated);
+
+      // too big for bin 1
+      noBuff = this->invoke_to_bufferGetCallee(0,BIN1_BUFFER_SIZE + 1);
+      ASSERT_EQ(0U,noBuff.getSize());
+      ASSERT_EQ(2U,this->component.m_noBuffs);
+
+      buffs[BIN0_NUM_BUFFERS + 2] = this->invoke_to_bufferGetCallee(0,BIN1_BUFFER_SIZE);
+      ASSERT_EQ((MGR_ID << 16) | (bin1Start + 2),buffs[BIN0_NUM_BUFFERS + 2].getContext());
+      ASSERT_EQ(BIN1_BUFFER_SIZE,buffs[BIN0_NUM_BUFFERS + 2].getSize());
+      buffs[BIN0_NUM_BUFFERS + 0] = this->invoke_to_bufferGetCallee(0,BIN1_BUFFER_SIZE);
+      ASSERT_EQ((MGR_ID << 16) | (bin1Start + 0),buffs[BIN0_NUM_BUFFERS + 0].getContext());
+
+      // return everything
+      for (b = 0; b < BIN0_NUM_BUFFERS+BIN1_NUM_BUFFERS+BIN2_NUM_BUFFERS; b++) {
+          this->invoke_to_bufferSendIn(0,buffs[b]);
+      }
+      ASSERT_EQ(0U,this->component.m_currBuffs);
+      for (b = 0; b < this->component.m_numStructs; b++) {
+          ASSERT_FALSE(this->component.m_buffers[b].allocated);
+      }
+
+      // cleanup BufferManager memory
+      this->component.cleanup();
+
+  }
+
   // ----------------------------------------------------------------------
   // Helper methods
   // ----------------------------------------------------------------------
@@ -52,6 +52,9 @@ namespace Svc {
       //! Multiple buffer sizes
       void multBuffSize();
 
+      //! Bins listed out of size order
+      void unorderedBins();
+
     private:
 
       // ----------------------------------------------------------------------
@@ -13,12 +13,17 @@
 namespace Svc {
     CommandDispatcherImpl::CommandDispatcherImpl(const char* name) :
         CommandDispatcherComponentBase(name),
+        m_numEntries(0),
+        m_numPending(0),
         m_seq(0),
         m_numCmdsDispatched(0),
         m_numCmdErrors(0)
     {
         memset(this->m_entryTable,0,sizeof(this->m_entryTable));
         memset(this->m_sequenceTracker,0,sizeof(this->m_sequenceTracker));
+        for (U32 index = 0; index < FW_NUM_ARRAY_ELEMENTS(this->m_entryIndex); index++) {
+            this->m_entryIndex[index] = NO_ENTRY;
+        }
     }
 
     CommandDispatcherImpl::~CommandDispatcherImpl() {
@@ -32,26 +37,22 @@ namespace Svc {
     }
 
     void CommandDispatcherImpl::compCmdReg_handler(NATIVE_INT_TYPE portNum, FwOpcodeType opCode) {
-        // search for an empty slot
-        bool slotFound = false;
-        for (U32 slot = 0; slot < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable); slot++) {
-            if ((not this->m_entryTable[slot].used) and (not slotFound)) {
-                this->m_entryTable[slot].opcode = opCode;
-                this->m_entryTable[slot].port = portNum;
-                this->m_entryTable[slot].used = true;
-                this->log_DIAGNOSTIC_OpCodeRegistered(opCode,portNum,slot);
-                slotFound = true;
-            } else if ((this->m_entryTable[slot].used) &&
-                (this->m_entryTable[slot].opcode == opCode) &&
-                (this->m_entryTable[slot].port == portNum) &&
-                (not slotFound)) {
-                    slotFound = true;
-                    this->log_DIAGNOSTIC_OpCodeReregistered(opCode,portNum);
-            } else if (this->m_entryTable[slot].used) { // make sure no duplicates
-                FW_ASSERT(this->m_entryTable[slot].opcode != opCode, opCode);
-            }
+        // look for an existing registration
+        U32 index = this->findEntry(opCode);
+        if (this->m_entryIndex[index] != NO_ENTRY) {
+            // make sure no duplicates
+            FW_ASSERT(this->m_entryTable[this->m_entryIndex[index]].port == portNum, opCode);
+            this->log_DIAGNOSTIC_OpCodeReregistered(opCode,portNum);
+            return;
         }
-        FW_ASSERT(slotFound,opCode);
+        // take the next empty slot
+        FW_ASSERT(this->m_numEntries < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable), opCode);
+        U32 slot = this->m_numEntries++;
+        this->m_entryTable[slot].opcode = opCode;
+        this->m_entryTable[slot].port = portNum;
+        this->m_entryTable[slot].used = true;
+        this->m_entryIndex[index] = slot;
+        this->log_DIAGNOSTIC_OpCodeRegistered(opCode,portNum,slot);
     }
 
     void CommandDispatcherImpl::compCmdStat_handler(NATIVE_INT_TYPE portNum, FwOpcodeType opCode, U32 cmdSeq, const Fw::CmdResponse &response) {
@@ -67,18 +68,14 @@ namespace Svc {
         // look for command source
         NATIVE_INT_TYPE portToCall = -1;
         U32 context;
-        for (U32 pending = 0; pending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); pending++) {
-            if (
-                    (this->m_sequenceTracker[pending].seq == cmdSeq) &&
-                    (this->m_sequenceTracker[pending].used)
-                ) {
-                portToCall = this->m_sequenceTracker[pending].callerPort;
-                context = this->m_sequenceTracker[pending].context;
-                FW_ASSERT(opCode == this->m_sequenceTracker[pending].opCode);
-                FW_ASSERT(portToCall < this->getNum_seqCmdStatus_OutputPorts());
-                this->m_sequenceTracker[pending].used = false;
-                break;
-            }
+        U32 pending = this->findPending(cmdSeq);
+        // a full tracker can hold no entry for the sequence number
+        if (this->m_sequenceTracker[pending].used and (this->m_sequenceTracker[pending].seq == cmdSeq)) {
+            portToCall = this->m_sequenceTracker[pending].callerPort;
+            context = this->m_sequenceTracker[pending].context;
+            FW_ASSERT(opCode == this->m_sequenceTracker[pending].opCode);
+            FW_ASSERT(portToCall < this->getNum_seqCmdStatus_OutputPorts());
+            this->removePending(pending);
         }
 
         if (portToCall != -1) {
@@ -103,31 +100,24 @@ namespace Svc {
             return;
         }
 
-        // search for opcode in dispatch table
-        U32 entry;
-        bool entryFound = false;
+        // look up opcode in dispatch table
+        NATIVE_INT_TYPE entry = this->m_entryIndex[this->findEntry(cmdPkt.getOpCode())];
+        bool entryFound = (entry != NO_ENTRY);
 
-        for (entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable); entry++) {
-            if ((this->m_entryTable[entry].used) and (cmdPkt.getOpCode() == this->m_entryTable[entry].opcode)) {
-                entryFound = true;
-                break;
-            }
-        }
         if (entryFound and this->isConnected_compCmdSend_OutputPort(this->m_entryTable[entry].port)) {
             // register command in command tracker only if response port is connect
             if (this->isConnected_seqCmdStatus_OutputPort(portNum)) {
                 bool pendingFound = false;
 
-                for (U32 pending = 0; pending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); pending++) {
-                    if (not this->m_sequenceTracker[pending].used) {
-                        pendingFound = true;
-                        this->m_sequenceTracker[pending].used = true;
-                        this->m_sequenceTracker[pending].opCode = cmdPkt.getOpCode();
-                        this->m_sequenceTracker[pending].seq = this->m_seq;
-                        this->m_sequenceTracker[pending].context = context;
-                        this->m_sequenceTracker[pending].callerPort = portNum;
-                        break;
-                    }
+                if (this->m_numPending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker)) {
+                    U32 pending = this->findPending(this->m_seq);
+                    pendingFound = true;
+                    this->m_sequenceTracker[pending].used = true;
+                    this->m_sequenceTracker[pending].opCode = cmdPkt.getOpCode();
+                    this->m_sequenceTracker[pending].seq = this->m_seq;
+                    this->m_sequenceTracker[pending].context = context;
+                    this->m_sequenceTracker[pending].callerPort = portNum;
+                    this->m_numPending++;
                 }
 
                 // if we couldn't find a slot to track the command, quit
@@ -186,6 +176,7 @@ namespace Svc {
         for (NATIVE_INT_TYPE entry = 0; entry < CMD_DISPATCHER_SEQUENCER_TABLE_SIZE; entry++) {
             this->m_sequenceTracker[entry].used = false;
         }
+        this->m_numPending = 0;
         this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
     }
 
@@ -194,4 +185,24 @@ namespace Svc {
         this->pingOut_out(0,key);
     }
 
+    U32 CommandDispatcherImpl::findEntry(FwOpcodeType opCode) {
+        // the index is never more than half full, so an empty slot ends every probe
+        EntryIndexTraits traits;
+        traits.table = this->m_entryTable;
+        return Types::OpenAddressing<NATIVE_INT_TYPE, EntryIndexTraits>::find(
+            this->m_entryIndex, FW_NUM_ARRAY_ELEMENTS(this->m_entryIndex), opCode, traits);
+    }
+
+    U32 CommandDispatcherImpl::findPending(U32 cmdSeq) {
+        return Types::OpenAddressing<SequenceTracker, SequenceTrackerTraits>::find(
+            this->m_sequenceTracker, FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker), cmdSeq, SequenceTrackerTraits());
+    }
+
+    void CommandDispatcherImpl::removePending(U32 slot) {
+        FW_ASSERT(this->m_numPending > 0);
+        Types::OpenAddressing<SequenceTracker, SequenceTrackerTraits>::remove(
+            this->m_sequenceTracker, FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker), slot, SequenceTrackerTraits());
+        this->m_numPending--;
+    }
+
 }
@@ -16,6 +16,7 @@
 
 #include <Svc/CmdDispatcher/CommandDispatcherComponentAc.hpp>
 #include <Os/Mutex.hpp>
+#include <Utils/Types/OpenAddressing.hpp>
 #include <CommandDispatcherImplCfg.hpp>
 
 namespace Svc {
@@ -129,6 +130,30 @@ namespace Svc {
             //!  \param cmdSeq the assigned sequence number for the command
             void CMD_CLEAR_TRACKING_cmdHandler(FwOpcodeType opCode, U32 cmdSeq);
 
+            //!  \brief find the dispatch index slot of an opcode
+            //!
+            //!  Probes the dispatch index from the opcode's hash until the
+            //!  slot holding the opcode or an empty slot is found.
+            //!
+            //!  \param opCode the opcode to look up
+            //!  \return the index slot holding the opcode, or the empty slot it would be placed in
+            U32 findEntry(FwOpcodeType opCode);
+            //!  \brief find the tracker slot of a pending command
+            //!
+            //!  Probes the sequence tracker from the sequence number's home slot
+            //!  until the command or an unused slot is found.
+            //!
+            //!  \param cmdSeq the sequence number of the command
+            //!  \return the slot holding the command, or the unused slot it would be placed in
+            U32 findPending(U32 cmdSeq);
+            //!  \brief remove a completed command from the sequence tracker
+            //!
+            //!  Shifts back the commands probed past the freed slot so each
+            //!  pending command stays reachable from its home slot.
+            //!
+            //!  \param slot the slot of the completed command
+            void removePending(U32 slot);
+
             //! \struct DispatchEntry
             //! \brief table used to store opcode to port mappings
             //!
@@ -137,8 +162,9 @@ namespace Svc {
             //! As each command opcode is registered, a new entry is found
             //! in the table by checking for the "used" flag. The opcode
             //! member is set to the opcode, and the port member set to the
-            //! port to dispatch to. When a new opcode is received for
-            //! execution, the table is traversed until the opcode is located.
+            //! port to dispatch to. The slot of each entry is also placed in
+            //! m_entryIndex, an open-addressed hash index of the opcodes, so
+            //! that a received opcode is located without traversing the table.
 
             struct DispatchEntry {
                     bool used; //!< if entry has been used yet
@@ -146,6 +172,14 @@ namespace Svc {
                     NATIVE_INT_TYPE port; //!< which port the entry invokes
             } m_entryTable[CMD_DISPATCHER_DISPATCH_TABLE_SIZE]; //!< table of dispatch entries
 
+            enum {
+                DISPATCH_INDEX_SIZE = 2 * CMD_DISPATCHER_DISPATCH_TABLE_SIZE, //!< size of the hash index, kept at most half full
+                NO_ENTRY = -1 //!< marks an empty slot of the hash index
+            };
+
+            NATIVE_INT_TYPE m_entryIndex[DISPATCH_INDEX_SIZE]; //!< m_entryTable slot of each opcode, probed linearly from the opcode hash
+            U32 m_numEntries; //!< number of entries used in m_entryTable
+
             //! \struct SequenceTracker
             //! \brief table used to store opcode that are being executed
             //!
@@ -158,6 +192,10 @@ namespace Svc {
             //! used for the opcode, and the "callerPort" field is used to store
             //! the port number of the caller so the status can be reported back to
             //! correct port.
+            //!
+            //! Each command is placed at its home slot, the sequence number modulo
+            //! the table size, or the next unused slot after it, so the status of
+            //! a command is normally matched in the first slot checked.
 
             struct SequenceTracker {
                     bool used; //!< if this slot is used
@@ -167,6 +205,25 @@ namespace Svc {
                     NATIVE_INT_TYPE callerPort; //!< port command source port
             } m_sequenceTracker[CMD_DISPATCHER_SEQUENCER_TABLE_SIZE]; //!< sequence tracking port for command completions;
 
+            //! open addressing of m_entryIndex, keyed by the opcodes of the m_entryTable slots it holds
+            struct EntryIndexTraits {
+                const DispatchEntry* table; //!< the dispatch table
+                bool isEmpty(const NATIVE_INT_TYPE& entry) const { return entry == NO_ENTRY; }
+                U32 getKey(const NATIVE_INT_TYPE& entry) const { return this->table[entry].opcode; }
+                U32 getHash(U32 key) const { return Types::hashKey(key); }
+                void clear(NATIVE_INT_TYPE& entry) const { entry = NO_ENTRY; }
+            };
+
+            //! open addressing of m_sequenceTracker. Sequence numbers are consecutive, so they are their own hash
+            struct SequenceTrackerTraits {
+                bool isEmpty(const SequenceTracker& entry) const { return not entry.used; }
+                U32 getKey(const SequenceTracker& entry) const { return entry.seq; }
+                U32 getHash(U32 key) const { return key; }
+                void clear(SequenceTracker& entry) const { entry.used = false; }
+            };
+
+            U32 m_numPending; //!< number of slots used in m_sequenceTracker
+
             I32 m_seq; //!< current command sequence number
 
             U32 m_numCmdsDispatched; //!< number of commands dispatched
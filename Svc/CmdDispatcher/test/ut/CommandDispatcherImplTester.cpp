@@ -759,6 +759,30 @@ namespace Svc {
             }
         }
 
+        // a response for an untracked command, e.g. one dispatched without a status port,
+        // leaves the full tracker alone
+        const U32 untrackedSeq = 3*CMD_DISPATCHER_SEQUENCER_TABLE_SIZE + 1;
+        this->clearEvents();
+        this->m_seqStatusRcvd = false;
+        this->invoke_to_compCmdStat(0,testOpCode+1,untrackedSeq,Fw::CmdResponse::OK);
+        ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
+        ASSERT_FALSE(this->m_seqStatusRcvd);
+        ASSERT_EQ(static_cast<U32>(CMD_DISPATCHER_SEQUENCER_TABLE_SIZE),this->m_impl.m_numPending);
+        for (NATIVE_UINT_TYPE entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_impl.m_sequenceTracker); entry++) {
+            ASSERT_TRUE(this->m_impl.m_sequenceTracker[entry].used);
+            ASSERT_EQ(entry,this->m_impl.m_sequenceTracker[entry].seq);
+        }
+
+        // the tracked command in the same home slot still completes
+        const U32 trackedSeq = untrackedSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE;
+        this->invoke_to_compCmdStat(0,testOpCode,trackedSeq,Fw::CmdResponse::OK);
+        ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
+        ASSERT_TRUE(this->m_seqStatusRcvd);
+        ASSERT_EQ(testOpCode,this->m_seqStatusOpCode);
+        ASSERT_EQ(13u,this->m_seqStatusCmdSeq);
+        ASSERT_EQ(static_cast<U32>(CMD_DISPATCHER_SEQUENCER_TABLE_SIZE-1),this->m_impl.m_numPending);
+        ASSERT_FALSE(this->m_impl.m_sequenceTracker[trackedSeq].used);
+
     }
 
     void CommandDispatcherImplTester::runClearCommandTracking() {
@@ -881,6 +905,80 @@ namespace Svc {
 
     }
 
+    void CommandDispatcherImplTester::runOutOfOrderCompletion() {
+
+        // register built-in commands
+        this->m_impl.regCommands();
+
+        // fill the dispatch table with opcodes of components at neighboring base IDs
+        const U32 numOpCodes = CMD_DISPATCHER_DISPATCH_TABLE_SIZE - 4;
+        FwOpcodeType opCodes[CMD_DISPATCHER_DISPATCH_TABLE_SIZE];
+        for (U32 op = 0; op < numOpCodes; op++) {
+            opCodes[op] = 0x1000 + (op / 8) * 0x100 + (op % 8);
+            this->clearEvents();
+            this->invoke_to_compCmdReg(0,opCodes[op]);
+            ASSERT_EVENTS_OpCodeRegistered_SIZE(1);
+            ASSERT_EVENTS_OpCodeRegistered(0,opCodes[op],0,op + 4);
+        }
+        ASSERT_EQ(this->m_impl.m_numEntries,static_cast<U32>(CMD_DISPATCHER_DISPATCH_TABLE_SIZE));
+
+        // keep the tracker nearly full and complete commands out of order, so that
+        // sequence numbers wrap around onto slots of commands still pending
+        struct Pending {
+            U32 seq;
+            FwOpcodeType opCode;
+            U32 context;
+        } pending[CMD_DISPATCHER_SEQUENCER_TABLE_SIZE];
+        U32 numPending = 0;
+        const U32 numCommands = 10 * CMD_DISPATCHER_SEQUENCER_TABLE_SIZE;
+
+        for (U32 cmd = 0; cmd < numCommands + CMD_DISPATCHER_SEQUENCER_TABLE_SIZE; cmd++) {
+            if ((numPending < CMD_DISPATCHER_SEQUENCER_TABLE_SIZE) and (cmd < numCommands)) {
+                // dispatch a command to one of the registered opcodes
+                const FwOpcodeType opCode = opCodes[(cmd * 7) % numOpCodes];
+                const U32 context = 1000 + cmd;
+                this->clearEvents();
+                this->m_cmdSendRcvd = false;
+                Fw::ComBuffer buff;
+                ASSERT_EQ(buff.serialize(FwPacketDescriptorType(Fw::ComPacket::FW_PACKET_COMMAND)),Fw::FW_SERIALIZE_OK);
+                ASSERT_EQ(buff.serialize(opCode),Fw::FW_SERIALIZE_OK);
+                this->invoke_to_seqCmdBuff(0,buff,context);
+                ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
+                ASSERT_EVENTS_OpCodeDispatched_SIZE(1);
+                ASSERT_EVENTS_OpCodeDispatched(0,opCode,0);
+                ASSERT_TRUE(this->m_cmdSendRcvd);
+                ASSERT_EQ(this->m_cmdSendOpCode,opCode);
+                pending[numPending].seq = this->m_cmdSendCmdSeq;
+                pending[numPending].opCode = opCode;
+                pending[numPending].context = context;
+                numPending++;
+            }
+            if ((numPending == CMD_DISPATCHER_SEQUENCER_TABLE_SIZE) or (cmd >= numCommands)) {
+                if (numPending == 0) {
+                    break;
+                }
+                // complete a command picked out of order
+                const U32 pick = (cmd * 11) % numPending;
+                this->clearEvents();
+                this->m_seqStatusRcvd = false;
+                this->invoke_to_compCmdStat(0,pending[pick].opCode,pending[pick].seq,Fw::CmdResponse::OK);
+                ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
+                ASSERT_EVENTS_OpCodeCompleted_SIZE(1);
+                ASSERT_TRUE(this->m_seqStatusRcvd);
+                ASSERT_EQ(this->m_seqStatusOpCode,pending[pick].opCode);
+                ASSERT_EQ(this->m_seqStatusCmdSeq,pending[pick].context);
+                pending[pick] = pending[numPending - 1];
+                numPending--;
+            }
+            ASSERT_EQ(this->m_impl.m_numPending,numPending);
+        }
+
+        // verify sequence tracker table is empty
+        for (NATIVE_UINT_TYPE entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_impl.m_sequenceTracker); entry++) {
+            ASSERT_TRUE(this->m_impl.m_sequenceTracker[entry].used == false);
+        }
+    }
+
     void CommandDispatcherImplTester::from_pingOut_handler(
               const NATIVE_INT_TYPE portNum, /*!< The port number*/
               U32 key /*!< Value to return to pinger*/
@@ -28,6 +28,7 @@ namespace Svc {
             void runOverflowCommands();
             void runNopCommands();
             void runClearCommandTracking();
+            void runOutOfOrderCompletion();
 
         private:
             Svc::CommandDispatcherImpl& m_impl;
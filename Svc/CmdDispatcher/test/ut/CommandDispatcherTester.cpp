@@ -201,6 +201,26 @@ TEST(CmdDispTestOffNominal,ClearSequenceTracker) {
 
 }
 
+TEST(CmdDispTestNominal,OutOfOrderCompletion) {
+
+    TEST_CASE(102.1.4,"Out of Order Completion");
+    COMMENT("Fill the dispatch table and complete commands out of order while the sequence tracker is full.");
+
+    Svc::CommandDispatcherImpl impl("CmdDispImpl");
+
+    impl.init(10,0);
+
+    Svc::CommandDispatcherImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runOutOfOrderCompletion();
+
+}
+
 #ifndef TGT_OS_TYPE_VXWORKS
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -23,6 +23,7 @@ namespace Svc {
       maxFileSize(maxFileSize),
       fileMode(CLOSED),
       byteCount(0),
+      fileHashValid(false),
       writeErrorOccurred(false),
       openErrorOccurred(false),
       storeBufferLength(storeBufferLength)
@@ -174,6 +175,10 @@ namespace Svc {
       // Reset byte count:
       this->byteCount = 0;
 
+      // Reset hash:
+      this->fileHash.init();
+      this->fileHashValid = true;
+
       // Set mode:
       this->fileMode = OPEN;
     }
@@ -233,6 +238,8 @@ namespace Svc {
     NATIVE_INT_TYPE size = length;
     Os::File::Status ret = file.write(data, size);
     if( Os::File::OP_OK != ret || size != static_cast<NATIVE_INT_TYPE>(length) ) {
+      // The file contents are unknown, so the hash file must read them back:
+      this->fileHashValid = false;
       if( !this->writeErrorOccurred ) { // throttle this event, otherwise a positive
                                         // feedback event loop can occur!
         Fw::LogStringArg logStringArg(this->fileName);
@@ -242,6 +249,7 @@ namespace Svc {
       return false;
     }
 
+    this->fileHash.update(data, length);
     this->writeErrorOccurred = false;
     return true;
   }
@@ -251,7 +259,14 @@ namespace Svc {
     )
   {
     Os::ValidateFile::Status validateStatus;
-    validateStatus = Os::ValidateFile::createValidation(this->fileName, this->hashFileName);
+    if( this->fileHashValid ) {
+      Utils::HashBuffer hashBuffer;
+      this->fileHash.final(hashBuffer);
+      validateStatus = Os::ValidateFile::writeValidation(this->hashFileName, hashBuffer);
+    }
+    else {
+      validateStatus = Os::ValidateFile::createValidation(this->fileName, this->hashFileName);
+    }
     if( Os::ValidateFile::VALIDATION_OK != validateStatus ) {
       Fw::LogStringArg logStringArg1(this->fileName);
       Fw::LogStringArg logStringArg2(this->hashFileName);
@@ -102,6 +102,9 @@ namespace Svc {
       CHAR fileName[MAX_FILENAME_SIZE + MAX_PATH_SIZE];
       CHAR hashFileName[MAX_FILENAME_SIZE + MAX_PATH_SIZE];
       U32 byteCount;
+      // Hash of the bytes written to the file, so the hash file needn't re-read it:
+      Utils::Hash fileHash;
+      bool fileHashValid;
       bool writeErrorOccurred;
       bool openErrorOccurred;
       bool storeBufferLength;
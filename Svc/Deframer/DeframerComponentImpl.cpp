@@ -136,9 +136,11 @@ void DeframerComponentImpl ::processRing() {
             FW_ASSERT(needed > m_in_ring.get_remaining_size(), needed, m_in_ring.get_remaining_size());
             break;
         }
-        // Error statuses  reset needed and rotate away 1 byte
+        // Error statuses rotate away data up to the next possible frame start
         else {
-            m_in_ring.rotate(1);
+            const U32 skip = m_protocol->resync(m_in_ring);
+            FW_ASSERT((skip > 0) and (skip <= remaining), skip, remaining);
+            m_in_ring.rotate(skip);
             // Checksum errors get logged as it is unlikely to get to a checksum check on random data
             if (status == DeframingProtocol::DEFRAMING_INVALID_CHECKSUM) {
                 Fw::Logger::logMsg("[ERROR] Deframing checksum validation failed\n");
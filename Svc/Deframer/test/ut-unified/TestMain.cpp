@@ -76,6 +76,23 @@ TEST(Nominal, BasicPollUplink) {
     send.apply(tester);
 }
 
+TEST(Nominal, ResyncToStartWord) {
+    Svc::FprimeDeframing deframing;
+    U8 store[64];
+    Types::CircularBuffer ring(store, sizeof(store));
+    // Partial start words before a full one and a partial one at the end
+    const U8 data[] = {0xde, 0x00, 0xde, 0xad, 0xbe, 0x00, 0xde, 0xad,
+                       0xbe, 0xef, 0x00, 0x00, 0x00, 0x00, 0xde, 0xad};
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, ring.serialize(data, sizeof(data)));
+    ASSERT_EQ(6U, deframing.resync(ring));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, ring.rotate(6));
+    // A trailing candidate is kept until the rest of it arrives
+    ASSERT_EQ(8U, deframing.resync(ring));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, ring.rotate(9));
+    // No candidate remains so everything is discarded
+    ASSERT_EQ(1U, deframing.resync(ring));
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -62,6 +62,22 @@ void FramerComponentImpl ::send(Fw::Buffer& outgoing) {
     }
 }
 
+void FramerComponentImpl ::sendSegments(Fw::Buffer& header,
+                                        const U8* const payload,
+                                        const U32 size,
+                                        Fw::Buffer& trailer) {
+    // The payload is only read by the driver, and remains owned by the caller of the framer
+    Fw::Buffer payloadBuffer(const_cast<U8*>(payload), size);
+    Drv::SendStatus sendStatus = framedOutSegments_out(0, header, payloadBuffer, trailer);
+    if (sendStatus.e != Drv::SendStatus::SEND_OK) {
+        Fw::Logger::logMsg("[ERROR] Failed to send framed data: %d\n", sendStatus.e);
+    }
+}
+
+bool FramerComponentImpl ::canSendSegments() {
+    return isConnected_framedOutSegments_OutputPort(0);
+}
+
 Fw::Buffer FramerComponentImpl ::allocate(const U32 size) {
     this->getTime();
     return framedAllocate_out(0, size);
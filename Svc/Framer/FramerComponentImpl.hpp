@@ -62,6 +62,13 @@ class FramerComponentImpl : public FramerComponentBase, public FramingProtocolIn
     //! \return Fw::Buffer containing allocation to write into
     Fw::Buffer allocate(const U32 size);
 
+    //! \brief Check if the framing protocol may send frames in segments
+    //!
+    //! Frames are sent in segments when the framedOutSegments port is connected.
+    //!
+    //! \return true when framedOutSegments is connected
+    bool canSendSegments();
+
   PRIVATE:
     // ----------------------------------------------------------------------
     // Handler implementations for user-defined typed input ports
@@ -83,6 +90,10 @@ class FramerComponentImpl : public FramerComponentBase, public FramingProtocolIn
     //!
     void send(Fw::Buffer& outgoing);
 
+    //! Segmented send helper implementation
+    //!
+    void sendSegments(Fw::Buffer& header, const U8* const payload, const U32 size, Fw::Buffer& trailer);
+
     FramingProtocol* m_protocol;
 };
 
@@ -22,6 +22,11 @@ TEST(Nominal, ManySends) {
     tester.test_buffer(31);
 }
 
+TEST(Nominal, Segments) {
+    Svc::Tester tester(true);
+    tester.test_segments(31);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
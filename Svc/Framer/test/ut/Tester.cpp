@@ -11,6 +11,8 @@
 // ======================================================================
 
 #include "Tester.hpp"
+#include "Utils/Hash/Hash.hpp"
+#include <cstring>
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 1000
@@ -30,7 +32,7 @@ void Tester::MockFramer::frame(const U8* const data, const U32 size, Fw::ComPack
 // Construction and destruction
 // ----------------------------------------------------------------------
 
-Tester ::Tester()
+Tester ::Tester(const bool segments)
     :
       FramerGTestBase("Tester", MAX_HISTORY_SIZE),
       component("Framer"),
@@ -41,7 +43,12 @@ Tester ::Tester()
 {
     this->initComponents();
     this->connectPorts();
-    component.setup(this->m_mock);
+    if (segments) {
+        this->component.set_framedOutSegments_OutputPort(0, this->get_from_framedOutSegments(0));
+        component.setup(this->m_fprime);
+    } else {
+        component.setup(this->m_mock);
+    }
 }
 
 Tester ::~Tester() {}
@@ -72,6 +79,22 @@ void Tester ::test_buffer(U32 iterations) {
     }
 }
 
+void Tester ::test_segments(U32 iterations) {
+    for (U32 i = 0; i < iterations; i++) {
+        const U32 size = (i * 997) % 3412 + 1;
+        Fw::Buffer buffer(new U8[size], size);
+        for (U32 j = 0; j < size; j++) {
+            buffer.getData()[j] = static_cast<U8>(j + i);
+        }
+        m_framed = false;
+        m_returned = false;
+        m_payload = buffer;
+        invoke_to_bufferIn(0, buffer);
+        ASSERT_TRUE(m_framed);
+        ASSERT_TRUE(m_returned);
+    }
+}
+
 void Tester ::check_last_buffer(Fw::Buffer buffer) {
     ASSERT_EQ(buffer, m_buffer);
 }
@@ -105,6 +128,46 @@ Drv::SendStatus Tester ::from_framedOut_handler(const NATIVE_INT_TYPE portNum, F
     return Drv::SendStatus::SEND_OK;
 }
 
+Drv::SendStatus Tester ::from_framedOutSegments_handler(const NATIVE_INT_TYPE portNum,
+                                                        Fw::Buffer& header,
+                                                        Fw::Buffer& payload,
+                                                        Fw::Buffer& trailer) {
+    this->pushFromPortEntry_framedOutSegments(header, payload, trailer);
+    // Payload is sent in place, and not yet returned
+    EXPECT_EQ(payload.getData(), m_payload.getData());
+    EXPECT_EQ(payload.getSize(), m_payload.getSize());
+    this->check_not_freed();
+
+    // Segments joined must form the same frame as a contiguous send
+    const U32 total = header.getSize() + payload.getSize() + trailer.getSize();
+    U8* frame = new U8[total];
+    ::memcpy(frame, header.getData(), header.getSize());
+    ::memcpy(frame + header.getSize(), payload.getData(), payload.getSize());
+    ::memcpy(frame + header.getSize() + payload.getSize(), trailer.getData(), trailer.getSize());
+    Fw::ExternalSerializeBuffer repr(frame, total);
+    repr.setBuffLen(total);
+    FP_FRAME_TOKEN_TYPE start = 0;
+    FP_FRAME_TOKEN_TYPE size = 0;
+    I32 type = 0;
+    EXPECT_EQ(repr.deserialize(start), Fw::FW_SERIALIZE_OK);
+    EXPECT_EQ(repr.deserialize(size), Fw::FW_SERIALIZE_OK);
+    EXPECT_EQ(repr.deserialize(type), Fw::FW_SERIALIZE_OK);
+    EXPECT_EQ(start, FprimeFraming::START_WORD);
+    EXPECT_EQ(size, m_payload.getSize() + sizeof(I32));
+    EXPECT_EQ(type, static_cast<I32>(Fw::ComPacket::FW_PACKET_FILE));
+    EXPECT_EQ(::memcmp(frame + header.getSize(), m_payload.getData(), m_payload.getSize()), 0);
+    Utils::HashBuffer hash;
+    Utils::Hash::hash(frame, total - HASH_DIGEST_LENGTH, hash);
+    EXPECT_EQ(trailer.getSize(), static_cast<U32>(HASH_DIGEST_LENGTH));
+    EXPECT_EQ(::memcmp(trailer.getData(), hash.getBuffAddr(), HASH_DIGEST_LENGTH), 0);
+    delete[] frame;
+
+    // Header is handed over as a framedOut buffer is, and holds the trailer
+    delete[] header.getData();
+    m_framed = true;
+    return Drv::SendStatus::SEND_OK;
+}
+
 // ----------------------------------------------------------------------
 // Helper methods
 // ----------------------------------------------------------------------
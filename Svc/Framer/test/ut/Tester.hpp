@@ -15,6 +15,7 @@
 
 #include "GTestBase.hpp"
 #include "Svc/Framer/FramerComponentImpl.hpp"
+#include "Svc/FramingProtocol/FprimeProtocol.hpp"
 
 namespace Svc {
 
@@ -33,7 +34,7 @@ class Tester : public FramerGTestBase {
   public:
     //! Construct object Tester
     //!
-    Tester();
+    Tester(const bool segments = false /*!< Frame with FprimeFraming out framedOutSegments*/);
 
     //! Destroy object Tester
     //!
@@ -52,6 +53,10 @@ class Tester : public FramerGTestBase {
     //!
     void test_buffer(U32 iterations = 1);
 
+    //! Test buffers framed around the payload in place
+    //!
+    void test_segments(U32 iterations = 1);
+
     void check_last_buffer(Fw::Buffer buffer);
 
     void check_not_freed();
@@ -75,6 +80,13 @@ class Tester : public FramerGTestBase {
     Drv::SendStatus from_framedOut_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
                                            Fw::Buffer& sendBuffer);
 
+    //! Handler for from_framedOutSegments
+    //!
+    Drv::SendStatus from_framedOutSegments_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                                   Fw::Buffer& header,
+                                                   Fw::Buffer& payload,
+                                                   Fw::Buffer& trailer);
+
   private:
     // ----------------------------------------------------------------------
     // Helper methods
@@ -99,6 +111,8 @@ class Tester : public FramerGTestBase {
 
     Fw::Buffer m_buffer;
     MockFramer m_mock;
+    FprimeFraming m_fprime;
+    Fw::Buffer m_payload;
     bool m_framed;
     bool m_returned;
 };
@@ -22,4 +22,8 @@ void DeframingProtocol::setup(DeframingProtocolInterface& interface) {
     FW_ASSERT(m_interface == nullptr);
     m_interface = &interface;
 }
+
+U32 DeframingProtocol::resync(Types::CircularBuffer& buffer) {
+    return 1;
+}
 };
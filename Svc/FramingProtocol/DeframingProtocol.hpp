@@ -58,6 +58,12 @@ class DeframingProtocol {
                                     U32& needed  /*!< Return needed number of bytes */
     ) = 0;
 
+    //! Find where the next frame could start after a failed deframe. The default steps past a single byte.
+    //! Protocols with a start word may skip all data that cannot begin a frame.
+    //! \return number of bytes to discard, at least one and at most the data in the buffer
+    virtual U32 resync(Types::CircularBuffer& buffer  /*!< Circular buffer positioned at the failed frame */
+    );
+
   PROTECTED:
     DeframingProtocolInterface* m_interface;
 };
@@ -12,6 +12,7 @@
 
 #include "FprimeProtocol.hpp"
 #include "Utils/Hash/Hash.hpp"
+#include <cstring>
 
 namespace Svc {
 
@@ -27,9 +28,15 @@ void FprimeFraming::frame(const U8* const data, const U32 size, Fw::ComPacket::C
     // Use of I32 size is explicit as ComPacketType will be specifically serialized as an I32
     FP_FRAME_TOKEN_TYPE real_data_size = size + ((packet_type != Fw::ComPacket::FW_PACKET_UNKNOWN) ? sizeof(I32) : 0);
     FP_FRAME_TOKEN_TYPE total = real_data_size + FP_FRAME_HEADER_SIZE + HASH_DIGEST_LENGTH;
+    if (m_interface->canSendSegments()) {
+        this->frameSegments(data, size, packet_type, real_data_size);
+        return;
+    }
     Fw::Buffer buffer = m_interface->allocate(total);
+    FW_ASSERT(buffer.getSize() >= total, buffer.getSize());
     Fw::SerializeBufferBase& serializer = buffer.getSerializeRepr();
-    Utils::HashBuffer hash;
+    Utils::Hash hash;
+    Utils::HashBuffer hashBuffer;
 
     // Serialize data
     Fw::SerializeStatus status;
@@ -45,12 +52,17 @@ void FprimeFraming::frame(const U8* const data, const U32 size, Fw::ComPacket::C
         FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
     }
     
-    status = serializer.serialize(data, size, true);  // Serialize without length
+    // Hash the header, then copy in the data hashing it in the same pass
+    const NATIVE_UINT_TYPE header_size = serializer.getBuffLength();
+    hash.init();
+    hash.update(buffer.getData(), static_cast<NATIVE_INT_TYPE>(header_size));
+    hash.updateCopy(serializer.getBuffAddrSer(), data, static_cast<NATIVE_INT_TYPE>(size));
+    status = serializer.setBuffLen(header_size + size);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
 
-    // Calculate and add transmission hash
-    Utils::Hash::hash(buffer.getData(), total - HASH_DIGEST_LENGTH, hash);
-    status = serializer.serialize(hash.getBuffAddr(), HASH_DIGEST_LENGTH, true);
+    // Add transmission hash
+    hash.final(hashBuffer);
+    status = serializer.serialize(hashBuffer.getBuffAddr(), HASH_DIGEST_LENGTH, true);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
 
     buffer.setSize(total);
@@ -58,27 +70,81 @@ void FprimeFraming::frame(const U8* const data, const U32 size, Fw::ComPacket::C
     m_interface->send(buffer);
 }
 
+void FprimeFraming::frameSegments(const U8* const data,
+                                  const U32 size,
+                                  Fw::ComPacket::ComPacketType packet_type,
+                                  const FP_FRAME_TOKEN_TYPE real_data_size) {
+    const U32 header_size = FP_FRAME_HEADER_SIZE + (real_data_size - size);
+    // The trailer is allocated with the header, leaving the payload in place
+    Fw::Buffer header = m_interface->allocate(header_size + HASH_DIGEST_LENGTH);
+    FW_ASSERT(header.getSize() >= (header_size + HASH_DIGEST_LENGTH), header.getSize());
+    Fw::SerializeBufferBase& serializer = header.getSerializeRepr();
+    Utils::Hash hash;
+    Utils::HashBuffer hashBuffer;
+
+    Fw::SerializeStatus status;
+    status = serializer.serialize(START_WORD);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+
+    status = serializer.serialize(real_data_size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+
+    // Serialize packet type if supplied, otherwise it *must* be present in the data
+    if (packet_type != Fw::ComPacket::FW_PACKET_UNKNOWN) {
+        status = serializer.serialize(static_cast<I32>(packet_type)); // I32 used for enum storage
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    }
+
+    // Calculate the transmission hash across the header and payload
+    hash.init();
+    hash.update(header.getData(), static_cast<NATIVE_INT_TYPE>(header_size));
+    hash.update(data, static_cast<NATIVE_INT_TYPE>(size));
+    hash.final(hashBuffer);
+    status = serializer.serialize(hashBuffer.getBuffAddr(), HASH_DIGEST_LENGTH, true);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+
+    Fw::Buffer trailer(header.getData() + header_size, HASH_DIGEST_LENGTH);
+    header.setSize(header_size);
+
+    m_interface->sendSegments(header, data, size, trailer);
+}
+
 bool FprimeDeframing::validate(Types::CircularBuffer& ring, U32 size) {
     Utils::Hash hash;
     Utils::HashBuffer hashBuffer;
-    // Initialize the checksum and loop through all bytes calculating it
+    Types::CircularBuffer::Span first;
+    Types::CircularBuffer::Span second;
+    // Initialize the checksum and calculate it directly over the ring's store
+    Fw::SerializeStatus status = ring.get_spans(first, second, size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
     hash.init();
-    for (U32 i = 0; i < size; i++) {
-        char byte;
-        ring.peek(byte, i);
-        hash.update(&byte, 1);
+    hash.update(first.data, static_cast<NATIVE_INT_TYPE>(first.size));
+    if (second.size > 0) {
+        hash.update(second.data, static_cast<NATIVE_INT_TYPE>(second.size));
     }
     hash.final(hashBuffer);
-    // Now loop through the hash digest bytes and check for equality
-    for (U32 i = 0; i < HASH_DIGEST_LENGTH; i++) {
-        char calc = static_cast<char>(hashBuffer.getBuffAddr()[i]);
-        char sent = 0;
-        ring.peek(sent, size + i);
-        if (calc != sent) {
-            return false;
+    // Now check the hash digest bytes for equality
+    U8 sent[HASH_DIGEST_LENGTH];
+    status = ring.peek(sent, HASH_DIGEST_LENGTH, size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    return ::memcmp(hashBuffer.getBuffAddr(), sent, HASH_DIGEST_LENGTH) == 0;
+}
+
+U32 FprimeDeframing::resync(Types::CircularBuffer& ring) {
+    // Start word is serialized big-endian, so a frame can only begin at a copy of its leading byte
+    const U8 lead = static_cast<U8>(FprimeFraming::START_WORD >> ((sizeof(FP_FRAME_TOKEN_TYPE) - 1) * 8));
+    // The frame at the head failed, so the search starts past it
+    NATIVE_UINT_TYPE offset = 1;
+    while (ring.find(lead, offset) == Fw::FW_SERIALIZE_OK) {
+        FP_FRAME_TOKEN_TYPE start = 0;
+        // Candidates too close to the end to hold a start word are kept until more data arrives
+        if ((ring.peek(start, offset) != Fw::FW_SERIALIZE_OK) || (start == FprimeFraming::START_WORD)) {
+            return offset;
         }
+        offset++;
     }
-    return true;
+    // Nothing left in the buffer can begin a frame
+    return ring.get_remaining_size();
 }
 
 DeframingProtocol::DeframingStatus FprimeDeframing::deframe(Types::CircularBuffer& ring, U32& needed) {
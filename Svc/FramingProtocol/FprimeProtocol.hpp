@@ -28,6 +28,17 @@ class FprimeFraming: public FramingProtocol {
     FprimeFraming();
 
     void frame(const U8* const data, const U32 size, Fw::ComPacket::ComPacketType packet_type);
+
+  PRIVATE:
+    //! \brief frame into a header and trailer sent around the payload in place
+    //! \param data: pointer to a set of bytes to be framed
+    //! \param size: size of data pointed to by `data`
+    //! \param packet_type: type of data supplied for File downlink packets
+    //! \param real_data_size: size of the frame's data, including any packet type
+    void frameSegments(const U8* const data,
+                       const U32 size,
+                       Fw::ComPacket::ComPacketType packet_type,
+                       const FP_FRAME_TOKEN_TYPE real_data_size);
 };
 
 class FprimeDeframing : public DeframingProtocol {
@@ -37,6 +48,8 @@ class FprimeDeframing : public DeframingProtocol {
     bool validate(Types::CircularBuffer& buffer, U32 size);
 
     DeframingStatus deframe(Types::CircularBuffer& buffer, U32& needed);
+
+    U32 resync(Types::CircularBuffer& buffer);
 };
 };
 #endif  // FPRIMEPROTOCOL_HPP
@@ -35,6 +35,20 @@ class FramingProtocolInterface {
     //! \param outgoing: framed data wrapped in an Fw::Buffer
     virtual void send(Fw::Buffer& outgoing) = 0;
 
+    //! \brief check if framed data may be sent as separate header, payload and trailer
+    //! \return true when `sendSegments` is available, false by default
+    virtual bool canSendSegments() { return false; }
+
+    //! \brief send framed data held in separate buffers out of the framer
+    //!
+    //! Sends a frame without copying its payload next to the framing tokens. Only called when `canSendSegments`
+    //! returns true, but implemented by every interface so that no protocol can reach a missing implementation.
+    //! \param header: leading framing tokens wrapped in an allocated Fw::Buffer, handed over as in `send`
+    //! \param payload: data framed, referenced in place for the duration of the call
+    //! \param size: size of payload
+    //! \param trailer: trailing framing tokens, held within the header's allocation past its size
+    virtual void sendSegments(Fw::Buffer& header, const U8* const payload, const U32 size, Fw::Buffer& trailer) = 0;
+
 };
 
 #endif  // OWLS_PROTOCOLINTERFACE_HPP
@@ -95,6 +95,19 @@ void SystemResources ::VERSION_cmdHandler(const FwOpcodeType opCode, const U32 c
     this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
 }
 
+void SystemResources ::QUEUE_DUMP_cmdHandler(const FwOpcodeType opCode, const U32 cmdSeq) {
+#if FW_QUEUE_REGISTRATION
+    Os::QueueRegistry* registry = Os::Queue::getQueueRegistry();
+    if (registry != nullptr) {
+        registry->dump();
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+        return;
+    }
+#endif
+    // No registry to report the queues
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+}
+
 F32 SystemResources::compCpuUtil(Os::SystemResources::CpuTicks current, Os::SystemResources::CpuTicks previous) {
     F32 util = 100.0f;
     // Prevent divide by zero on fast-sample
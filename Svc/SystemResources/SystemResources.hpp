@@ -16,6 +16,7 @@
 #include "Svc/SystemResources/SystemResourcesComponentAc.hpp"
 #include "Os/SystemResources.hpp"
 #include "Os/FileSystem.hpp"
+#include "Os/Queue.hpp"
 
 namespace Svc {
 
@@ -73,6 +74,12 @@ class SystemResources : public SystemResourcesComponentBase {
                             const U32 cmdSeq           /*!< The command sequence number*/
     );
 
+    //! Implementation for QUEUE_DUMP command handler
+    //! Dump the size, high water mark and statistics of every registered queue to the console
+    void QUEUE_DUMP_cmdHandler(const FwOpcodeType opCode, /*!< The opcode*/
+                               const U32 cmdSeq           /*!< The command sequence number*/
+    );
+
   private:
     void Cpu();
     void Mem();
@@ -19,6 +19,11 @@ TEST(Nominal, Events) {
     tester.test_version_evr();
 }
 
+TEST(Nominal, QueueDump) {
+    Svc::Tester tester;
+    tester.test_queue_dump();
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
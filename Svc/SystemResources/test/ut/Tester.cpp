@@ -12,6 +12,7 @@
 
 #include "Tester.hpp"
 #include "version.hpp"
+#include "Os/SimpleQueueRegistry.hpp"
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 100
 
@@ -117,6 +118,38 @@ void Tester ::test_version_evr() {
     ASSERT_EVENTS_VERSION(0, VERSION);
 }
 
+void Tester ::test_queue_dump() {
+#if FW_QUEUE_REGISTRATION
+    // Without a registry there is nothing to report
+    Os::QueueRegistry* previous = Os::Queue::getQueueRegistry();
+    Os::Queue::setQueueRegistry(nullptr);
+    this->sendCmd_QUEUE_DUMP(0, 10);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, SystemResources::OPCODE_QUEUE_DUMP, 10, Fw::CmdResponse::EXECUTION_ERROR);
+
+    // Queues created once a registry is set are dumped
+    this->clearHistory();
+    {
+        Os::SimpleQueueRegistry registry;
+        {
+            Os::Queue queue;
+            ASSERT_EQ(Os::Queue::QUEUE_OK, queue.create(Os::QueueString("DumpQ"), 4, 8));
+            ASSERT_EQ(1, registry.getNumQueues());
+            this->sendCmd_QUEUE_DUMP(0, 11);
+            ASSERT_CMD_RESPONSE_SIZE(1);
+            ASSERT_CMD_RESPONSE(0, SystemResources::OPCODE_QUEUE_DUMP, 11, Fw::CmdResponse::OK);
+        }
+        // Destroyed queues are no longer dumped
+        ASSERT_EQ(0, registry.getNumQueues());
+    }
+    Os::Queue::setQueueRegistry(previous);
+#else
+    this->sendCmd_QUEUE_DUMP(0, 10);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, SystemResources::OPCODE_QUEUE_DUMP, 10, Fw::CmdResponse::EXECUTION_ERROR);
+#endif
+}
+
 // ----------------------------------------------------------------------
 // Helper methods
 // ----------------------------------------------------------------------
@@ -49,6 +49,10 @@ class Tester : public SystemResourcesGTestBase {
     //!
     void test_version_evr();
 
+    //! Test queue dump command
+    //!
+    void test_queue_dump();
+
   private:
     // ----------------------------------------------------------------------
     // Helper methods
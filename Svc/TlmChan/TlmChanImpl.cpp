@@ -19,7 +19,8 @@
 
 namespace Svc {
 
-    TlmChanImpl::TlmChanImpl(const char* name) : TlmChanComponentBase(name)
+    TlmChanImpl::TlmChanImpl(const char* name) : TlmChanComponentBase(name),
+        m_seqLockStore(TLMCHAN_SEQLOCK_STORE)
     {
         // clear data
         this->m_activeBuffer = 0;
@@ -34,16 +35,25 @@ namespace Svc {
             this->m_tlmEntries[0].buckets[entry].updated = false;
             this->m_tlmEntries[0].buckets[entry].bucketNo = entry;
             this->m_tlmEntries[0].buckets[entry].next = nullptr;
+            this->m_tlmEntries[0].buckets[entry].nextUpdated = nullptr;
             this->m_tlmEntries[0].buckets[entry].id = 0;
+            this->m_tlmEntries[0].buckets[entry].seq = 0;
             this->m_tlmEntries[1].buckets[entry].used = false;
             this->m_tlmEntries[1].buckets[entry].updated = false;
             this->m_tlmEntries[1].buckets[entry].bucketNo = entry;
             this->m_tlmEntries[1].buckets[entry].next = nullptr;
+            this->m_tlmEntries[1].buckets[entry].nextUpdated = nullptr;
             this->m_tlmEntries[1].buckets[entry].id = 0;
+            this->m_tlmEntries[1].buckets[entry].seq = 0;
         }
         // clear free index
         this->m_tlmEntries[0].free = 0;
         this->m_tlmEntries[1].free = 0;
+        // clear updated lists
+        this->m_tlmEntries[0].updatedHead = nullptr;
+        this->m_tlmEntries[0].updatedTail = nullptr;
+        this->m_tlmEntries[1].updatedHead = nullptr;
+        this->m_tlmEntries[1].updatedTail = nullptr;
 
 
     }
@@ -17,6 +17,7 @@
 #include <TlmChanImplCfg.hpp>
 #include <Os/Mutex.hpp>
 #include <Fw/Tlm/TlmPacket.hpp>
+#include <Fw/Tlm/TlmBatchPacket.hpp>
 
 namespace Svc {
 
@@ -53,21 +54,41 @@ namespace Svc {
                 Fw::Time lastUpdate; //!< last updated time
                 Fw::TlmBuffer buffer; //!< buffer to store serialized telemetry
                 tlmEntry* next; //!< pointer to next bucket in table
+                tlmEntry* nextUpdated; //!< pointer to next entry in list of updated entries
                 bool used; //!< if entry has been used
                 NATIVE_UINT_TYPE bucketNo; //!< for testing
+                U32 seq; //!< sequence count, odd while value is being written. Only used with TLMCHAN_SEQLOCK_STORE
             } TlmEntry;
 
             struct TlmSet {
                 TlmEntry* slots[TLMCHAN_NUM_TLM_HASH_SLOTS]; //!< set of hash slots in hash table
                 TlmEntry buckets[TLMCHAN_HASH_BUCKETS]; //!< set of buckets used in hash table
                 NATIVE_INT_TYPE free; //!< next free bucket
+                TlmEntry* updatedHead; //!< first entry updated since last run. Avoids scanning all buckets
+                TlmEntry* updatedTail; //!< last entry updated since last run
             } m_tlmEntries[2];
 
             U32 m_activeBuffer; // !< which buffer is active for storing telemetry
 
+            Os::Mutex m_lock; //!< protects telemetry table. Only taken to add channels with TLMCHAN_SEQLOCK_STORE
+
+            bool m_seqLockStore; //!< store telemetry with sequence locks. Set from TLMCHAN_SEQLOCK_STORE
+
+            // send helpers
+            void sendValue(FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& buffer); //!< send or batch a channel value
+
+            // sequence lock storage. Only used with TLMCHAN_SEQLOCK_STORE
+            void seqLockRecv(FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& val); //!< store value without taking lock
+            void seqLockGet(FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& val); //!< read value, retrying on torn reads
+            void seqLockSendUpdated(); //!< send values updated since last run
+            TlmEntry* seqLockFind(NATIVE_UINT_TYPE index, FwChanIdType id); //!< find entry without taking lock
+            TlmEntry* seqLockAdd(NATIVE_UINT_TYPE index, FwChanIdType id); //!< add entry under lock
+            bool seqLockRead(TlmEntry* entry, Fw::Time& timeTag, Fw::TlmBuffer& val); //!< read consistent copy of entry
+
             // work variables
             Fw::ComBuffer m_comBuffer;
-            Fw::TlmPacket m_tlmPacket;
+            Fw::TlmPacket m_tlmPacket; //!< single channel packet
+            Fw::TlmBatchPacket m_tlmBatch; //!< multi-channel packet when TLMCHAN_BATCH_PACKETS is set
 
     };
 
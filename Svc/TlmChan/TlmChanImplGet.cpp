@@ -16,9 +16,17 @@ namespace Svc {
 
     void TlmChanImpl::TlmGet_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val) {
 
+        if (this->m_seqLockStore) {
+            this->seqLockGet(id,timeTag,val);
+            return;
+        }
+
+        this->m_lock.lock();
+
         // Compute index for entry
 
         NATIVE_UINT_TYPE index = this->doHash(id);
+        FW_ASSERT(index < TLMCHAN_NUM_TLM_HASH_SLOTS,index);
 
         // Search to see if channel has been stored
         TlmEntry *entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
@@ -41,5 +49,7 @@ namespace Svc {
             val.resetSer();
         }
 
+        this->m_lock.unLock();
+
     }
 }
@@ -16,9 +16,17 @@ namespace Svc {
 
     void TlmChanImpl::TlmRecv_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val) {
 
+        if (this->m_seqLockStore) {
+            this->seqLockRecv(id,timeTag,val);
+            return;
+        }
+
+        this->m_lock.lock();
+
         // Compute index for entry
 
         NATIVE_UINT_TYPE index = this->doHash(id);
+        FW_ASSERT(index < TLMCHAN_NUM_TLM_HASH_SLOTS,index);
         TlmEntry* entryToUse = nullptr;
         TlmEntry* prevEntry = nullptr;
 
@@ -58,9 +66,22 @@ namespace Svc {
         FW_ASSERT(entryToUse);
         entryToUse->used = true;
         entryToUse->id = id;
+        // add to list of updated entries if not already there
+        if (not entryToUse->updated) {
+            TlmSet& set = this->m_tlmEntries[this->m_activeBuffer];
+            entryToUse->nextUpdated = nullptr;
+            if (set.updatedTail) {
+                set.updatedTail->nextUpdated = entryToUse;
+            } else {
+                set.updatedHead = entryToUse;
+            }
+            set.updatedTail = entryToUse;
+        }
         entryToUse->updated = true;
         entryToUse->lastUpdate = timeTag;
         entryToUse->buffer = val;
 
+        this->m_lock.unLock();
+
     }
 }
@@ -0,0 +1,175 @@
+/**
+ * \file
+ * \brief Sequence lock telemetry storage for the telemetry channel component.
+ *
+ * Used instead of the double-buffered table when TLMCHAN_SEQLOCK_STORE is set.
+ * Producers write each entry between two increments of its sequence count, so
+ * the count is odd while a value is being written. Readers copy the entry and
+ * retry if the count was odd or changed during the copy. Producers writing
+ * the same channel take turns claiming the entry. After TLMCHAN_SEQLOCK_RETRIES
+ * failed attempts, readers and producers sleep between attempts so that a
+ * writer preempted in the middle of an update can finish it. Entries are added to
+ * the hash table under the component lock and published with release stores,
+ * so lookups never take the lock.
+ *
+ * \copyright
+ * Copyright 2009-2015, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ * <br /><br />
+ */
+
+#include <Svc/TlmChan/TlmChanImpl.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Os/Task.hpp>
+
+namespace Svc {
+
+    void TlmChanImpl::seqLockRecv(FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& val) {
+        TlmSet& set = this->m_tlmEntries[0];
+
+        NATIVE_UINT_TYPE index = this->doHash(id);
+        FW_ASSERT(index < TLMCHAN_NUM_TLM_HASH_SLOTS,index);
+
+        TlmEntry* entryToUse = this->seqLockFind(index,id);
+        if (nullptr == entryToUse) {
+            entryToUse = this->seqLockAdd(index,id);
+        }
+
+        // claim the entry by making the sequence count odd. If another producer
+        // is writing this channel right now, wait for it to finish so neither value is lost.
+        U32 seq = __atomic_load_n(&entryToUse->seq,__ATOMIC_RELAXED);
+        for (NATIVE_UINT_TYPE attempt = 0;
+             (seq & 1) or
+             (not __atomic_compare_exchange_n(&entryToUse->seq,&seq,seq + 1,true,__ATOMIC_ACQUIRE,__ATOMIC_RELAXED));
+             attempt++) {
+            // the other producer may have been preempted in the middle of an update,
+            // so let it run rather than spin against it forever
+            if (attempt >= TLMCHAN_SEQLOCK_RETRIES) {
+                (void) Os::Task::delay(1);
+            }
+            seq = __atomic_load_n(&entryToUse->seq,__ATOMIC_RELAXED);
+        }
+
+        entryToUse->lastUpdate = timeTag;
+        entryToUse->buffer = val;
+
+        // even count publishes the new value. Zero is skipped since it marks a never written entry.
+        U32 nextSeq = seq + 2;
+        if (0 == nextSeq) {
+            nextSeq = 2;
+        }
+        __atomic_store_n(&entryToUse->seq,nextSeq,__ATOMIC_RELEASE);
+
+        // add to list of updated entries if not already there
+        if (not __atomic_exchange_n(&entryToUse->updated,true,__ATOMIC_ACQ_REL)) {
+            TlmEntry* head = __atomic_load_n(&set.updatedHead,__ATOMIC_RELAXED);
+            do {
+                entryToUse->nextUpdated = head;
+            } while (not __atomic_compare_exchange_n(&set.updatedHead,&head,entryToUse,true,__ATOMIC_RELEASE,__ATOMIC_RELAXED));
+        }
+    }
+
+    void TlmChanImpl::seqLockGet(FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& val) {
+        NATIVE_UINT_TYPE index = this->doHash(id);
+        FW_ASSERT(index < TLMCHAN_NUM_TLM_HASH_SLOTS,index);
+
+        TlmEntry* entryToUse = this->seqLockFind(index,id);
+        if ((nullptr == entryToUse) or (not this->seqLockRead(entryToUse,timeTag,val))) {
+            // requested entry may not be written yet; empty buffer
+            val.resetSer();
+        }
+    }
+
+    void TlmChanImpl::seqLockSendUpdated() {
+        TlmSet& set = this->m_tlmEntries[0];
+
+        // take the whole list. Producers start a new list for the next run.
+        TlmEntry* p_entry = __atomic_exchange_n(&set.updatedHead,static_cast<TlmEntry*>(nullptr),__ATOMIC_ACQUIRE);
+
+        Fw::Time timeTag;
+        Fw::TlmBuffer buffer;
+        while (p_entry != nullptr) {
+            // get next entry before clearing the flag, since a producer may put the
+            // entry back on the new list as soon as the flag is cleared
+            TlmEntry* nextEntry = p_entry->nextUpdated;
+            __atomic_store_n(&p_entry->updated,false,__ATOMIC_SEQ_CST);
+            if (this->seqLockRead(p_entry,timeTag,buffer)) {
+                this->sendValue(p_entry->id,timeTag,buffer);
+            }
+            p_entry = nextEntry;
+        }
+    }
+
+    TlmChanImpl::TlmEntry* TlmChanImpl::seqLockFind(NATIVE_UINT_TYPE index, FwChanIdType id) {
+        TlmSet& set = this->m_tlmEntries[0];
+
+        TlmEntry* entryToUse = __atomic_load_n(&set.slots[index],__ATOMIC_ACQUIRE);
+        for (NATIVE_UINT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
+            if ((nullptr == entryToUse) or (entryToUse->id == id)) {
+                break;
+            }
+            entryToUse = __atomic_load_n(&entryToUse->next,__ATOMIC_ACQUIRE);
+        }
+        return entryToUse;
+    }
+
+    TlmChanImpl::TlmEntry* TlmChanImpl::seqLockAdd(NATIVE_UINT_TYPE index, FwChanIdType id) {
+        TlmSet& set = this->m_tlmEntries[0];
+
+        this->m_lock.lock();
+
+        // another producer may have added the channel before the lock was taken
+        TlmEntry* entryToUse = this->seqLockFind(index,id);
+        if (nullptr == entryToUse) {
+            // Make sure that we haven't run out of buckets
+            FW_ASSERT(set.free < TLMCHAN_HASH_BUCKETS,set.free);
+            entryToUse = &set.buckets[set.free++];
+            entryToUse->id = id;
+            entryToUse->next = nullptr;
+            entryToUse->used = true;
+
+            // link at end of chain. Release store makes the entry visible to lookups fully initialized.
+            TlmEntry* prevEntry = set.slots[index];
+            if (nullptr == prevEntry) {
+                __atomic_store_n(&set.slots[index],entryToUse,__ATOMIC_RELEASE);
+            } else {
+                while (prevEntry->next != nullptr) {
+                    prevEntry = prevEntry->next;
+                }
+                __atomic_store_n(&prevEntry->next,entryToUse,__ATOMIC_RELEASE);
+            }
+        }
+
+        this->m_lock.unLock();
+
+        return entryToUse;
+    }
+
+    bool TlmChanImpl::seqLockRead(TlmEntry* entry, Fw::Time& timeTag, Fw::TlmBuffer& val) {
+        FW_ASSERT(entry);
+
+        for (NATIVE_UINT_TYPE attempt = 0; ; attempt++) {
+            U32 seqBefore = __atomic_load_n(&entry->seq,__ATOMIC_ACQUIRE);
+            if (0 == seqBefore) {
+                // entry has been added but no value written yet
+                return false;
+            }
+            if (0 == (seqBefore & 1)) {
+                val = entry->buffer;
+                timeTag = entry->lastUpdate;
+                __atomic_thread_fence(__ATOMIC_ACQUIRE);
+                if (__atomic_load_n(&entry->seq,__ATOMIC_RELAXED) == seqBefore) {
+                    return true;
+                }
+            }
+            // a writer may have been preempted in the middle of an update,
+            // so let it run rather than spin against it forever
+            if (attempt >= TLMCHAN_SEQLOCK_RETRIES) {
+                (void) Os::Task::delay(1);
+            }
+        }
+    }
+
+}
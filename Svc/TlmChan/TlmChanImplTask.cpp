@@ -15,6 +15,7 @@
 #include <Fw/Types/BasicTypes.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Tlm/TlmPacket.hpp>
+#include <Fw/Tlm/TlmBatchPacket.hpp>
 #include <Fw/Com/ComBuffer.hpp>
 
 #include <cstdio>
@@ -27,30 +28,65 @@ namespace Svc {
             return;
         }
 
-        // lock mutex long enough to modify active telemetry buffer
-        // so the data can be read without worrying about updates
-        this->lock();
-        this->m_activeBuffer = 1 - this->m_activeBuffer;
-        // set activeBuffer to not updated
-        for (U32 entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-            this->m_tlmEntries[this->m_activeBuffer].buckets[entry].updated = false;
+        if (TLMCHAN_BATCH_PACKETS) {
+            Fw::SerializeStatus stat = this->m_tlmBatch.resetPktSer();
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
         }
-        this->unLock();
-
-        // go through each entry and send a packet if it has been updated
-
-        for (U32 entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-            TlmEntry* p_entry = &this->m_tlmEntries[1-this->m_activeBuffer].buckets[entry];
-            if ((p_entry->updated) && (p_entry->used)) {
-                this->m_tlmPacket.setId(p_entry->id);
-                this->m_tlmPacket.setTimeTag(p_entry->lastUpdate);
-                this->m_tlmPacket.setTlmBuffer(p_entry->buffer);
-                this->m_comBuffer.resetSer();
-                Fw::SerializeStatus stat = this->m_tlmPacket.serialize(this->m_comBuffer);
-                FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+
+        if (this->m_seqLockStore) {
+            this->seqLockSendUpdated();
+        } else {
+            // lock mutex long enough to modify active telemetry buffer
+            // so the data can be read without worrying about updates
+            this->m_lock.lock();
+            this->m_activeBuffer = 1 - this->m_activeBuffer;
+            // set activeBuffer to not updated. Only entries on the updated list need clearing.
+            TlmSet& activeSet = this->m_tlmEntries[this->m_activeBuffer];
+            for (TlmEntry* p_entry = activeSet.updatedHead; p_entry != nullptr; p_entry = p_entry->nextUpdated) {
                 p_entry->updated = false;
-                this->PktSend_out(0,this->m_comBuffer,0);
             }
+            activeSet.updatedHead = nullptr;
+            activeSet.updatedTail = nullptr;
+            this->m_lock.unLock();
+
+            // go through each updated entry and send a packet
+            TlmSet& sendSet = this->m_tlmEntries[1-this->m_activeBuffer];
+            for (TlmEntry* p_entry = sendSet.updatedHead; p_entry != nullptr; p_entry = p_entry->nextUpdated) {
+                if ((p_entry->updated) && (p_entry->used)) {
+                    this->sendValue(p_entry->id,p_entry->lastUpdate,p_entry->buffer);
+                    p_entry->updated = false;
+                }
+            }
+
+            sendSet.updatedHead = nullptr;
+            sendSet.updatedTail = nullptr;
+        }
+
+        // send any remaining values
+        if (TLMCHAN_BATCH_PACKETS and (this->m_tlmBatch.getNumEntries() > 0)) {
+            this->PktSend_out(0,this->m_tlmBatch.getBuffer(),0);
+        }
+    }
+
+    void TlmChanImpl::sendValue(FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& buffer) {
+        if (TLMCHAN_BATCH_PACKETS) {
+            Fw::SerializeStatus stat = this->m_tlmBatch.addValue(id,timeTag,buffer);
+            if (Fw::FW_SERIALIZE_NO_ROOM_LEFT == stat) {
+                // packet is full, so send it and start a new one
+                this->PktSend_out(0,this->m_tlmBatch.getBuffer(),0);
+                stat = this->m_tlmBatch.resetPktSer();
+                FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+                stat = this->m_tlmBatch.addValue(id,timeTag,buffer);
+            }
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+        } else {
+            this->m_tlmPacket.setId(id);
+            this->m_tlmPacket.setTimeTag(timeTag);
+            this->m_tlmPacket.setTlmBuffer(buffer);
+            this->m_comBuffer.resetSer();
+            Fw::SerializeStatus stat = this->m_tlmPacket.serialize(this->m_comBuffer);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            this->PktSend_out(0,this->m_comBuffer,0);
         }
     }
 
@@ -9,9 +9,11 @@
 #include <Fw/Com/ComBuffer.hpp>
 #include <Fw/Com/ComPacket.hpp>
 #include <Os/IntervalTimer.hpp>
+#include <Os/Task.hpp>
 #include <Fw/Test/UnitTest.hpp>
 
 #include <cstdio>
+#include <ctime>
 
 #include <gtest/gtest.h>
 
@@ -22,6 +24,12 @@ namespace Svc {
         TlmChanGTestBase::init();
     }
 
+    void TlmChanImplTester::setSeqLockStore(bool seqLock) {
+        ASSERT_EQ(0,this->m_impl.m_tlmEntries[0].free);
+        ASSERT_EQ(0,this->m_impl.m_tlmEntries[1].free);
+        this->m_impl.m_seqLockStore = seqLock;
+    }
+
     void TlmChanImplTester::from_PktSend_handler(NATIVE_INT_TYPE portNum, Fw::ComBuffer &data, U32 context) {
         this->m_bufferRecv = true;
         this->m_rcvdBuffer[this->m_numBuffs] = data;
@@ -63,37 +71,43 @@ namespace Svc {
             tlc004 = true;
         }
 
-        // Search for channel ID
+        // Search for channel ID. Packets may hold more than one channel
+        // when TLMCHAN_BATCH_PACKETS is set.
         for (NATIVE_UINT_TYPE packet = 0; packet < this->m_numBuffs; packet++) {
             this->m_rcvdBuffer[packet].resetDeser();
             // first piece should be tlm packet descriptor
             FwPacketDescriptorType desc;
             stat = this->m_rcvdBuffer[packet].deserialize(desc);
             ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
-            ASSERT_EQ(desc, static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_TELEM));
-            // next piece should be event ID
-            FwEventIdType sentId;
-            stat = this->m_rcvdBuffer[packet].deserialize(sentId);
-            ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
-
-            // this is the packet you are looking for..
-            if (sentId != id) {
-                this->m_rcvdBuffer[packet].resetDeser();
-                continue;
+            ASSERT_EQ(desc, static_cast<FwPacketDescriptorType>(TLMCHAN_BATCH_PACKETS ?
+                Fw::ComPacket::FW_PACKET_TELEM_BATCH : Fw::ComPacket::FW_PACKET_TELEM));
+            while (this->m_rcvdBuffer[packet].getBuffLeft() > 0) {
+                // next piece should be channel ID
+                FwChanIdType sentId;
+                stat = this->m_rcvdBuffer[packet].deserialize(sentId);
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+                // next piece is time tag
+                Fw::Time recTimeTag(TB_NONE,0,0);
+                stat = this->m_rcvdBuffer[packet].deserialize(recTimeTag);
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+                // next piece is channel value
+                U32 readVal;
+                stat = this->m_rcvdBuffer[packet].deserialize(readVal);
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+
+                // this is the channel you are looking for..
+                if (sentId != id) {
+                    continue;
+                }
+                packetFound = true;
+                ASSERT_TRUE(timeTag == recTimeTag);
+                ASSERT_EQ(readVal, val);
+            }
+            if (not TLMCHAN_BATCH_PACKETS) {
+                // packet should only have had one channel
+                ASSERT_EQ(this->m_rcvdBuffer[packet].getBuffLength(),
+                    sizeof(FwPacketDescriptorType) + sizeof(FwChanIdType) + Fw::Time::SERIALIZED_SIZE + sizeof(U32));
             }
-            packetFound = true;
-            // next piece is time tag
-            Fw::Time recTimeTag(TB_NONE,0,0);
-            stat = this->m_rcvdBuffer[packet].deserialize(recTimeTag);
-            ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
-            ASSERT_TRUE(timeTag == recTimeTag);
-            // next piece is event argument
-            U32 readVal;
-            stat = this->m_rcvdBuffer[packet].deserialize(readVal);
-            ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
-            ASSERT_EQ(readVal, val);
-            // packet should be empty
-            ASSERT_EQ(this->m_rcvdBuffer[packet].getBuffLeft(),0u);
         }
 
         ASSERT_TRUE(packetFound);
@@ -186,7 +200,14 @@ namespace Svc {
         // do a run, and all the packets should be sent
         this->doRun(true);
         ASSERT_TRUE(this->m_bufferRecv);
-        ASSERT_EQ(this->m_numBuffs,FW_NUM_ARRAY_ELEMENTS(IDs));
+        if (TLMCHAN_BATCH_PACKETS) {
+            // channels should be packed into as few packets as fit
+            const NATIVE_UINT_TYPE entrySize = sizeof(FwChanIdType) + Fw::Time::SERIALIZED_SIZE + sizeof(U32);
+            const NATIVE_UINT_TYPE perPacket = (FW_COM_BUFFER_MAX_SIZE - sizeof(FwPacketDescriptorType))/entrySize;
+            ASSERT_EQ(this->m_numBuffs,(FW_NUM_ARRAY_ELEMENTS(IDs) + perPacket - 1)/perPacket);
+        } else {
+            ASSERT_EQ(this->m_numBuffs,FW_NUM_ARRAY_ELEMENTS(IDs));
+        }
 
         // verify packets
 
@@ -197,6 +218,224 @@ namespace Svc {
 
     }
 
+    void TlmChanImplTester::runUpdatedChannelsOnly() {
+
+        this->clearBuffs();
+        // send three channels
+        this->sendBuff(0x100,1,0);
+        this->sendBuff(0x200,2,0);
+        this->sendBuff(0x300,3,0);
+        this->doRun(true);
+        this->checkBuff(0x100,1,0);
+        this->checkBuff(0x200,2,0);
+        this->checkBuff(0x300,3,0);
+
+        // update one channel twice; only its latest value should be sent
+        this->clearBuffs();
+        this->sendBuff(0x200,4,0);
+        this->sendBuff(0x200,5,0);
+        this->doRun(true);
+        ASSERT_EQ(1u,this->m_numBuffs);
+        this->checkBuff(0x200,5,0);
+
+        // nothing updated, so nothing should be sent in either buffer
+        this->clearBuffs();
+        ASSERT_FALSE(this->doRun(false));
+        ASSERT_FALSE(this->doRun(false));
+        ASSERT_EQ(0u,this->m_numBuffs);
+
+    }
+
+    namespace {
+        enum {
+            PRODUCER_CHANNELS = 4, //!< channels written by each producer thread
+            PRODUCER_MAX_THREADS = 8, //!< largest number of producer threads
+            PRODUCER_ITERATIONS = 20000 //!< writes per producer thread
+        };
+    }
+
+    void TlmChanImplTester::producerTask(void* ptr) {
+        ProducerArgs* args = static_cast<ProducerArgs*>(ptr);
+        Fw::TlmBuffer buff;
+        for (NATIVE_UINT_TYPE iter = 1; iter <= args->iterations; iter++) {
+            // write the value twice and in the time tag so a torn read can be detected
+            Fw::Time timeTag(TB_NONE,iter,iter);
+            buff.resetSer();
+            (void) buff.serialize(static_cast<U32>(iter));
+            (void) buff.serialize(static_cast<U32>(iter));
+            args->impl->get_TlmRecv_InputPort(0)->invoke(args->firstId + (iter % PRODUCER_CHANNELS),timeTag,buff);
+        }
+        (void) __atomic_add_fetch(args->doneCount,1,__ATOMIC_RELEASE);
+    }
+
+    bool TlmChanImplTester::checkConsistent(FwChanIdType id, Fw::Time& timeTag) {
+        Fw::TlmBuffer buff;
+        timeTag.set(TB_NONE,0,0);
+        this->invoke_to_TlmGet(0,id,timeTag,buff);
+        if (0 == buff.getBuffLength()) {
+            // not written yet
+            return true;
+        }
+        U32 first = 0;
+        U32 second = 0;
+        buff.resetDeser();
+        return (Fw::FW_SERIALIZE_OK == buff.deserialize(first)) and
+               (Fw::FW_SERIALIZE_OK == buff.deserialize(second)) and
+               (first == second) and (first == timeTag.getSeconds());
+    }
+
+    void TlmChanImplTester::runProducerScaling(bool shared) {
+
+        // Writes telemetry from a growing number of producer threads while reading
+        // it back, checking for torn reads and that the last value written to each
+        // channel is kept. When shared, all producers write the same channels.
+        printf("TlmChan %s store, %s channels\n",this->m_impl.m_seqLockStore?"seqlock":"mutex",
+                shared?"shared":"separate");
+        for (NATIVE_UINT_TYPE numThreads = 1; numThreads <= PRODUCER_MAX_THREADS; numThreads *= 2) {
+            Os::Task tasks[PRODUCER_MAX_THREADS];
+            ProducerArgs args[PRODUCER_MAX_THREADS];
+            volatile U32 doneCount = 0;
+            NATIVE_UINT_TYPE reads = 0;
+            NATIVE_UINT_TYPE tornReads = 0;
+
+            Os::IntervalTimer timer;
+            timer.start();
+            for (NATIVE_UINT_TYPE thread = 0; thread < numThreads; thread++) {
+                args[thread].impl = &this->m_impl;
+                args[thread].firstId = shared ? 0x100 : 0x100 * (thread + 1);
+                args[thread].iterations = PRODUCER_ITERATIONS;
+                args[thread].doneCount = &doneCount;
+                Os::TaskString name("TlmProd");
+                ASSERT_EQ(Os::Task::TASK_OK,tasks[thread].start(name,producerTask,&args[thread]));
+            }
+            // read back channels until all producers are finished
+            while (__atomic_load_n(&doneCount,__ATOMIC_ACQUIRE) < numThreads) {
+                for (NATIVE_UINT_TYPE thread = 0; thread < numThreads; thread++) {
+                    for (NATIVE_UINT_TYPE chan = 0; chan < PRODUCER_CHANNELS; chan++) {
+                        Fw::Time timeTag;
+                        reads++;
+                        if (not this->checkConsistent(args[thread].firstId + chan,timeTag)) {
+                            tornReads++;
+                        }
+                    }
+                }
+            }
+            for (NATIVE_UINT_TYPE thread = 0; thread < numThreads; thread++) {
+                tasks[thread].join(nullptr);
+            }
+            timer.stop();
+
+            const U32 writes = numThreads * PRODUCER_ITERATIONS;
+            printf("%d producers: %d writes %d reads in %d us (%d ns/write)\n",
+                    numThreads,writes,reads,timer.getDiffUsec(),
+                    static_cast<U32>((static_cast<U64>(timer.getDiffUsec()) * 1000) / writes));
+            ASSERT_EQ(0u,tornReads);
+
+            // each channel holds the last iteration written to it
+            for (NATIVE_UINT_TYPE thread = 0; thread < numThreads; thread++) {
+                for (NATIVE_UINT_TYPE chan = 0; chan < PRODUCER_CHANNELS; chan++) {
+                    Fw::Time timeTag;
+                    ASSERT_TRUE(this->checkConsistent(args[thread].firstId + chan,timeTag));
+                    ASSERT_EQ(PRODUCER_ITERATIONS - ((PRODUCER_ITERATIONS - chan) % PRODUCER_CHANNELS),
+                              timeTag.getSeconds());
+                }
+            }
+        }
+
+    }
+
+    namespace {
+        enum {
+            STALL_MSEC = 200 //!< how long the stalled write is held open
+        };
+    }
+
+    U32 TlmChanImplTester::threadCpuUsec() {
+        struct timespec now;
+        (void) clock_gettime(CLOCK_THREAD_CPUTIME_ID,&now);
+        return static_cast<U32>(now.tv_sec) * 1000000 + static_cast<U32>(now.tv_nsec / 1000);
+    }
+
+    void TlmChanImplTester::stalledReaderTask(void* ptr) {
+        StalledArgs* args = static_cast<StalledArgs*>(ptr);
+        const U32 start = threadCpuUsec();
+        Fw::Time timeTag;
+        Fw::TlmBuffer buff;
+        args->impl->get_TlmGet_InputPort(0)->invoke(args->id,timeTag,buff);
+        buff.resetDeser();
+        (void) buff.deserialize(args->value);
+        args->cpuUsec = threadCpuUsec() - start;
+        (void) __atomic_add_fetch(args->doneCount,1,__ATOMIC_RELEASE);
+    }
+
+    void TlmChanImplTester::stalledProducerTask(void* ptr) {
+        StalledArgs* args = static_cast<StalledArgs*>(ptr);
+        const U32 start = threadCpuUsec();
+        Fw::Time timeTag(TB_NONE,args->value,0);
+        Fw::TlmBuffer buff;
+        (void) buff.serialize(args->value);
+        args->impl->get_TlmRecv_InputPort(0)->invoke(args->id,timeTag,buff);
+        args->cpuUsec = threadCpuUsec() - start;
+        (void) __atomic_add_fetch(args->doneCount,1,__ATOMIC_RELEASE);
+    }
+
+    void TlmChanImplTester::runStalledWriter() {
+
+        // A producer preempted in the middle of a write leaves the sequence count odd.
+        // A reader and a second producer of the same channel must wait for it by sleeping,
+        // not by spinning, and must complete once the write is finished.
+        const FwChanIdType id = 10;
+        this->sendBuff(id,1,0);
+
+        TlmChanImpl::TlmEntry* entry = this->m_impl.seqLockFind(this->m_impl.doHash(id),id);
+        ASSERT_TRUE(entry != nullptr);
+        // stall a write: claim the entry as a producer does
+        const U32 seq = __atomic_add_fetch(&entry->seq,1,__ATOMIC_ACQUIRE);
+        ASSERT_EQ(1u,seq & 1);
+
+        volatile U32 doneCount = 0;
+        StalledArgs reader = {&this->m_impl,id,0,0,&doneCount};
+        StalledArgs producer = {&this->m_impl,id,3,0,&doneCount};
+        Os::Task readerTask;
+        Os::Task producerTask;
+        Os::TaskString readerName("TlmStallRd");
+        Os::TaskString producerName("TlmStallWr");
+        ASSERT_EQ(Os::Task::TASK_OK,readerTask.start(readerName,stalledReaderTask,&reader));
+        ASSERT_EQ(Os::Task::TASK_OK,producerTask.start(producerName,stalledProducerTask,&producer));
+
+        // neither can finish while the write is open
+        (void) Os::Task::delay(STALL_MSEC);
+        ASSERT_EQ(0u,__atomic_load_n(&doneCount,__ATOMIC_ACQUIRE));
+
+        // finish the stalled write
+        Fw::TlmBuffer buff;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U32>(2)));
+        entry->lastUpdate.set(TB_NONE,2,0);
+        entry->buffer = buff;
+        __atomic_store_n(&entry->seq,seq + 1,__ATOMIC_RELEASE);
+
+        readerTask.join(nullptr);
+        producerTask.join(nullptr);
+        ASSERT_EQ(2u,__atomic_load_n(&doneCount,__ATOMIC_ACQUIRE));
+
+        // the reader sees the stalled write or the one after it, and the second producer's value is kept
+        ASSERT_TRUE((2 == reader.value) or (3 == reader.value)) << reader.value;
+        Fw::Time timeTag;
+        Fw::TlmBuffer last;
+        this->invoke_to_TlmGet(0,id,timeTag,last);
+        last.resetDeser();
+        U32 value = 0;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,last.deserialize(value));
+        ASSERT_EQ(3u,value);
+
+        // waiting took far less CPU time than the stall lasted
+        printf("stalled writer: reader used %d us, producer used %d us of CPU in %d ms\n",
+                reader.cpuUsec,producer.cpuUsec,STALL_MSEC);
+        ASSERT_LT(reader.cpuUsec,STALL_MSEC * 1000u / 4);
+        ASSERT_LT(producer.cpuUsec,STALL_MSEC * 1000u / 4);
+
+    }
+
     void TlmChanImplTester::runTooManyChannels() {
 
         // This will assert, so disable after testing
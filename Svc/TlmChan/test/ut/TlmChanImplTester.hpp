@@ -20,8 +20,14 @@ namespace Svc {
 
             void init(NATIVE_INT_TYPE instance = 0);
 
+            //! Select the store under test. Must be called before any channel is written.
+            void setSeqLockStore(bool seqLock);
+
             void runNominalChannel();
             void runMultiChannel();
+            void runUpdatedChannelsOnly();
+            void runProducerScaling(bool shared);
+            void runStalledWriter();
             void runOffNominal();
             void runTooManyChannels();
 
@@ -30,6 +36,28 @@ namespace Svc {
 
             void from_PktSend_handler(NATIVE_INT_TYPE portNum, Fw::ComBuffer &data, U32 context);
 
+            // producer thread benchmark
+            struct ProducerArgs {
+                TlmChanImpl* impl; //!< component to write to
+                FwChanIdType firstId; //!< first of the channels written by producer
+                NATIVE_UINT_TYPE iterations; //!< number of writes
+                volatile U32* doneCount; //!< incremented when producer is finished
+            };
+            static void producerTask(void* ptr);
+            bool checkConsistent(FwChanIdType id, Fw::Time& timeTag);
+
+            // stalled writer test
+            struct StalledArgs {
+                TlmChanImpl* impl; //!< component to read or write
+                FwChanIdType id; //!< channel to read or write
+                U32 value; //!< value to write, or value read
+                U32 cpuUsec; //!< CPU time used by the task
+                volatile U32* doneCount; //!< incremented when the task is finished
+            };
+            static void stalledReaderTask(void* ptr);
+            static void stalledProducerTask(void* ptr);
+            static U32 threadCpuUsec();
+
             // helper
             void sendBuff(FwChanIdType id, U32 val, NATIVE_INT_TYPE instance);
             bool doRun(bool check);
@@ -73,6 +73,155 @@ TEST(TlmChanTest,MultiChannelTest) {
 
 }
 
+TEST(TlmChanTest,UpdatedChannelsOnlyTest) {
+
+    COMMENT("Write channels across several runs and verify only updated channels are pushed.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runUpdatedChannelsOnly();
+
+}
+
+TEST(TlmChanTest,ProducerThreadScaling) {
+
+    COMMENT("Write channels from multiple producer threads, verify reads are never torn and the last values are kept.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runProducerScaling(false);
+
+}
+
+TEST(TlmChanTest,ProducerThreadSharedChannels) {
+
+    COMMENT("Write the same channels from multiple producer threads, verify no write is torn or lost.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runProducerScaling(true);
+
+}
+
+// The tests below repeat the nominal tests against the sequence lock store,
+// whichever store TLMCHAN_SEQLOCK_STORE selects for the build
+
+void runSeqLockTest(void (Svc::TlmChanImplTester::*run)()) {
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.setSeqLockStore(true);
+    (tester.*run)();
+
+}
+
+TEST(TlmChanSeqLockTest,NominalChannelTest) {
+    COMMENT("Write a single channel to the sequence lock store and verify it is read back and pushed correctly.");
+    runSeqLockTest(&Svc::TlmChanImplTester::runNominalChannel);
+}
+
+TEST(TlmChanSeqLockTest,MultiChannelTest) {
+    COMMENT("Write multiple channels to the sequence lock store and verify they are read back and pushed correctly.");
+    runSeqLockTest(&Svc::TlmChanImplTester::runMultiChannel);
+}
+
+TEST(TlmChanSeqLockTest,UpdatedChannelsOnlyTest) {
+    COMMENT("Write channels to the sequence lock store across several runs and verify only updated channels are pushed.");
+    runSeqLockTest(&Svc::TlmChanImplTester::runUpdatedChannelsOnly);
+}
+
+TEST(TlmChanSeqLockTest,OffNominal) {
+    COMMENT("Attempt to read a channel that hasn't been written to the sequence lock store.");
+    runSeqLockTest(&Svc::TlmChanImplTester::runOffNominal);
+}
+
+TEST(TlmChanSeqLockTest,StalledWriter) {
+    COMMENT("Hold a write to the sequence lock store open and verify readers and producers wait for it without spinning.");
+    runSeqLockTest(&Svc::TlmChanImplTester::runStalledWriter);
+}
+
+TEST(TlmChanSeqLockTest,ProducerThreadScaling) {
+
+    COMMENT("Write channels to the sequence lock store from multiple producer threads.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.setSeqLockStore(true);
+    tester.runProducerScaling(false);
+
+}
+
+TEST(TlmChanSeqLockTest,ProducerThreadSharedChannels) {
+
+    COMMENT("Write the same channels to the sequence lock store from multiple producer threads.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.setSeqLockStore(true);
+    tester.runProducerScaling(true);
+
+}
+
 
 TEST(TlmChanTest,OffNominal) {
 
@@ -11,6 +11,8 @@
 #include <Svc/TlmPacketizer/TlmPacketizer.hpp>
 #include <Fw/Types/BasicTypes.hpp>
 #include <Fw/Com/ComPacket.hpp>
+#include <cmath>
+#include <cstring>
 
 namespace Svc {
 
@@ -38,6 +40,8 @@ namespace Svc {
           this->m_tlmEntries.buckets[entry].bucketNo = entry;
           this->m_tlmEntries.buckets[entry].next = nullptr;
           this->m_tlmEntries.buckets[entry].id = 0;
+          this->m_tlmEntries.buckets[entry].filtered = false;
+          this->m_tlmEntries.buckets[entry].filterValid = false;
       }
       // clear free index
       this->m_tlmEntries.free = 0;
@@ -51,6 +55,8 @@ namespace Svc {
       for (NATIVE_UINT_TYPE buffer = 0; buffer < MAX_PACKETIZER_PACKETS; buffer++) {
           this->m_fillBuffers[buffer].updated = false;
           this->m_fillBuffers[buffer].requested = false;
+          this->m_fillBuffers[buffer].minInterval = 0;
+          this->m_fillBuffers[buffer].runsSinceSend = 0;
           this->m_sendBuffers[buffer].updated = false;
       }
   }
@@ -147,9 +153,49 @@ namespace Svc {
       this->m_configured = true;
   }
 
+  void TlmPacketizer::setFilterList(const TlmPacketizerFilterList& filterList) {
+
+      // packets need to be configured first
+      FW_ASSERT(this->m_configured);
+      FW_ASSERT((filterList.channels != nullptr) or (0 == filterList.numChannels));
+      FW_ASSERT((filterList.packets != nullptr) or (0 == filterList.numPackets));
+
+      for (NATIVE_UINT_TYPE filterEntry = 0; filterEntry < filterList.numChannels; filterEntry++) {
+          const TlmPacketizerChannelFilter& filter = filterList.channels[filterEntry];
+          TlmEntry *entryToUse = this->findBucket(filter.id);
+          // channel must be in a packet
+          FW_ASSERT(entryToUse);
+          FW_ASSERT(entryToUse->used and not entryToUse->ignored,filter.id);
+          FW_ASSERT(filter.deadband >= 0.0,filter.id);
+          this->m_lock.lock();
+          entryToUse->filtered = true;
+          entryToUse->filterType = filter.type;
+          entryToUse->deadband = filter.deadband;
+          entryToUse->filterValid = false;
+          this->m_lock.unLock();
+      }
+
+      for (NATIVE_UINT_TYPE intervalEntry = 0; intervalEntry < filterList.numPackets; intervalEntry++) {
+          const TlmPacketizerPacketInterval& interval = filterList.packets[intervalEntry];
+          NATIVE_UINT_TYPE pkt = 0;
+          for (pkt = 0; pkt < this->m_numPackets; pkt++) {
+              if (this->m_fillBuffers[pkt].id == interval.id) {
+                  break;
+              }
+          }
+          // packet must be in packet list
+          FW_ASSERT(pkt < this->m_numPackets,interval.id);
+          this->m_lock.lock();
+          this->m_fillBuffers[pkt].minInterval = interval.minInterval;
+          // first send isn't delayed
+          this->m_fillBuffers[pkt].runsSinceSend = interval.minInterval;
+          this->m_lock.unLock();
+      }
+  }
+
   TlmPacketizer::TlmEntry* TlmPacketizer::findBucket(FwChanIdType id) {
       NATIVE_UINT_TYPE index = this->doHash(id);
-      FW_ASSERT(index < TLMPACKETIZER_HASH_BUCKETS);
+      FW_ASSERT(index < TLMPACKETIZER_NUM_TLM_HASH_SLOTS,index);
       TlmEntry* entryToUse = nullptr;
       TlmEntry* prevEntry = nullptr;
 
@@ -215,6 +261,7 @@ namespace Svc {
       FW_ASSERT(this->m_configured);
       // get hash value for id
       NATIVE_UINT_TYPE index = this->doHash(id);
+      FW_ASSERT(index < TLMPACKETIZER_NUM_TLM_HASH_SLOTS,index);
       TlmEntry* entryToUse = nullptr;
 
       // Search to see if the channel is being sent
@@ -244,6 +291,14 @@ namespace Svc {
           }
       }
 
+      // check if value changed enough to update packets
+      bool changed = true;
+      if (entryToUse->filtered) {
+          this->m_lock.lock();
+          changed = this->valueChanged(entryToUse,val);
+          this->m_lock.unLock();
+      }
+
       // copy telemetry value into active buffers
       for (NATIVE_UINT_TYPE pkt = 0; pkt < MAX_PACKETIZER_PACKETS; pkt++) {
           // check if current packet has this channel
@@ -251,7 +306,10 @@ namespace Svc {
               // get destination address
               // printf("PK %d CH: %d\n",this->m_fillBuffers[pkt].id,id);
               this->m_lock.lock();
-              this->m_fillBuffers[pkt].updated = true;
+              // unchanged values are still copied so the latest value goes out with the next send
+              if (changed) {
+                  this->m_fillBuffers[pkt].updated = true;
+              }
               this->m_fillBuffers[pkt].latestTime = timeTag;
               U8* ptr = &this->m_fillBuffers[pkt].buffer.getBuffAddr()[entryToUse->packetOffset[pkt]];
               memcpy(ptr,val.getBuffAddr(),val.getBuffLength());
@@ -279,19 +337,27 @@ namespace Svc {
       this->m_lock.lock();
       // copy buffers from fill side to send side
       for (NATIVE_UINT_TYPE pkt = 0; pkt < this->m_numPackets; pkt++) {
+          // hold packets sent less than their minimum interval ago, unless requested
+          if (this->m_fillBuffers[pkt].runsSinceSend < this->m_fillBuffers[pkt].minInterval) {
+              this->m_fillBuffers[pkt].runsSinceSend++;
+          }
+          bool intervalDone = (this->m_fillBuffers[pkt].runsSinceSend >= this->m_fillBuffers[pkt].minInterval);
+
           if ((this->m_fillBuffers[pkt].updated) and
-                  ((this->m_fillBuffers[pkt].level <= this->m_startLevel) or
+                  (((this->m_fillBuffers[pkt].level <= this->m_startLevel) and intervalDone) or
                    (this->m_fillBuffers[pkt].requested))) {
 
               this->m_sendBuffers[pkt] = this->m_fillBuffers[pkt];
+              this->m_fillBuffers[pkt].runsSinceSend = 0;
               if (PACKET_UPDATE_ON_CHANGE == PACKET_UPDATE_MODE) {
                   this->m_fillBuffers[pkt].updated = false;
               }
               this->m_fillBuffers[pkt].requested = false;
               // PACKET_UPDATE_AFTER_FIRST_CHANGE will be this case - updated flag will not be cleared
-          } else if ((PACKET_UPDATE_ALWAYS == PACKET_UPDATE_MODE) and (this->m_fillBuffers[pkt].level <= this->m_startLevel)) {
+          } else if ((PACKET_UPDATE_ALWAYS == PACKET_UPDATE_MODE) and (this->m_fillBuffers[pkt].level <= this->m_startLevel) and intervalDone) {
               this->m_sendBuffers[pkt] = this->m_fillBuffers[pkt];
               this->m_sendBuffers[pkt].updated = true;
+              this->m_fillBuffers[pkt].runsSinceSend = 0;
           } else {
               this->m_sendBuffers[pkt].updated = false;
           }
@@ -378,6 +444,107 @@ namespace Svc {
       return (id % TLMPACKETIZER_HASH_MOD_VALUE)%TLMPACKETIZER_NUM_TLM_HASH_SLOTS;
   }
 
+  bool TlmPacketizer::valueChanged(TlmEntry* entry, Fw::TlmBuffer& val) {
+      FW_ASSERT(entry);
+
+      // first value after filter is set is always a change
+      bool firstValue = not entry->filterValid;
+      entry->filterValid = true;
+
+      if (TLM_VALUE_RAW == entry->filterType) {
+          // compare against the copy in the first packet holding the channel
+          for (NATIVE_UINT_TYPE pkt = 0; pkt < MAX_PACKETIZER_PACKETS; pkt++) {
+              if (entry->packetOffset[pkt] != -1) {
+                  const U8* current = &this->m_fillBuffers[pkt].buffer.getBuffAddr()[entry->packetOffset[pkt]];
+                  return firstValue or (memcmp(current,val.getBuffAddr(),val.getBuffLength()) != 0);
+              }
+          }
+          return true;
+      }
+
+      // deserialize value to compare against deadband
+      F64 value = 0.0;
+      Fw::SerializeStatus stat = Fw::FW_SERIALIZE_OK;
+      val.resetDeser();
+      switch (entry->filterType) {
+          case TLM_VALUE_U8: {
+              U8 typedVal = 0;
+              stat = val.deserialize(typedVal);
+              value = typedVal;
+              break;
+          }
+          case TLM_VALUE_I8: {
+              I8 typedVal = 0;
+              stat = val.deserialize(typedVal);
+              value = typedVal;
+              break;
+          }
+          case TLM_VALUE_U16: {
+              U16 typedVal = 0;
+              stat = val.deserialize(typedVal);
+              value = typedVal;
+              break;
+          }
+          case TLM_VALUE_I16: {
+              I16 typedVal = 0;
+              stat = val.deserialize(typedVal);
+              value = typedVal;
+              break;
+          }
+          case TLM_VALUE_U32: {
+              U32 typedVal = 0;
+              stat = val.deserialize(typedVal);
+              value = typedVal;
+              break;
+          }
+          case TLM_VALUE_I32: {
+              I32 typedVal = 0;
+              stat = val.deserialize(typedVal);
+              value = typedVal;
+              break;
+          }
+#if FW_HAS_64_BIT
+          case TLM_VALUE_U64: {
+              U64 typedVal = 0;
+              stat = val.deserialize(typedVal);
+              value = static_cast<F64>(typedVal);
+              break;
+          }
+          case TLM_VALUE_I64: {
+              I64 typedVal = 0;
+              stat = val.deserialize(typedVal);
+              value = static_cast<F64>(typedVal);
+              break;
+          }
+#endif
+          case TLM_VALUE_F32: {
+              F32 typedVal = 0.0;
+              stat = val.deserialize(typedVal);
+              value = typedVal;
+              break;
+          }
+          case TLM_VALUE_F64: {
+              stat = val.deserialize(value);
+              break;
+          }
+          default:
+              FW_ASSERT(0,entry->filterType);
+              break;
+      }
+      val.resetDeser();
+
+      // a value that doesn't match the filter type always counts as a change
+      if (stat != Fw::FW_SERIALIZE_OK) {
+          return true;
+      }
+
+      if (firstValue or (fabs(value - entry->filterValue) > entry->deadband)) {
+          entry->filterValue = value;
+          return true;
+      }
+      return false;
+  }
+
   void TlmPacketizer::missingChannel(FwChanIdType id) {
       // search to see if missing channel has already been sent
       for (NATIVE_UINT_TYPE slot = 0; slot < TLMPACKETIZER_MAX_MISSING_TLM_CHECK; slot++) {
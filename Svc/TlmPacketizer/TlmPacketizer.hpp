@@ -46,10 +46,23 @@ namespace Svc {
               const Svc::TlmPacketizerPacket& ignoreList, // channels to ignore (i.e. no warning event if not packetized)
               const NATIVE_UINT_TYPE startLevel); // starting level of packets to send
 
+      //! Set channel change filters and packet send intervals. Call after setPacketList().
+      //! Filtered channels only mark their packets updated when the value changes
+      //! by more than the deadband. Packets with an interval are sent at most once
+      //! every minInterval Run calls, unless requested with SEND_PKT.
+      void setFilterList(
+              const TlmPacketizerFilterList& filterList); // channel filters and packet intervals
+
       //! Destroy object TlmPacketizer
       //!
       ~TlmPacketizer(void);
 
+    PROTECTED:
+
+      // hash function for looking up telemetry channel
+      // can be overridden for alternate algorithms
+      virtual NATIVE_UINT_TYPE doHash(FwChanIdType id);
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -107,6 +120,8 @@ namespace Svc {
           NATIVE_UINT_TYPE level; //!< channel level
           bool updated; //!< if packet had any updates during last cycle
           bool requested; //!< if the packet was requested with SEND_PKT in the last cycle
+          NATIVE_UINT_TYPE minInterval; //!< minimum number of Run calls between sends
+          NATIVE_UINT_TYPE runsSinceSend; //!< Run calls since last send, up to minInterval
       };
 
       // buffers for filling with telemetry
@@ -123,6 +138,11 @@ namespace Svc {
           bool used; //!< if entry has been used
           bool ignored; //!< ignored packet id
           NATIVE_UINT_TYPE bucketNo; //!< for testing
+          bool filtered; //!< only update packets when value changes
+          TlmPacketizerValueType filterType; //!< type used to compare values
+          F64 deadband; //!< change needed to update packets
+          bool filterValid; //!< a value has been received since filter was set
+          F64 filterValue; //!< value at last change
       };
 
       struct TlmSet {
@@ -131,9 +151,6 @@ namespace Svc {
           NATIVE_UINT_TYPE free; //!< next free bucket
       } m_tlmEntries;
 
-      // hash function for looking up telemetry channel
-      NATIVE_UINT_TYPE doHash(FwChanIdType id);
-
       Os::Mutex m_lock; //!< used to lock access to packet buffers
 
       bool m_configured; //!< indicates a table has been passed and packets configured
@@ -147,6 +164,8 @@ namespace Svc {
 
       TlmEntry* findBucket(FwChanIdType id);
 
+      bool valueChanged(TlmEntry* entry, Fw::TlmBuffer& val); //!< Check value against channel filter
+
       NATIVE_UINT_TYPE m_startLevel; //!< initial level for sending packets
       NATIVE_UINT_TYPE m_maxLevel; //!< maximum level in all packets
 
@@ -16,6 +16,9 @@
 
 #include <Fw/Types/BasicTypes.hpp>
 
+// The hash settings below can be chosen so that every channel lands in its own
+// slot by running Utils/tlmHashTool.py on the deployment's dictionary.
+
 namespace Svc {
     static const NATIVE_UINT_TYPE MAX_PACKETIZER_PACKETS = 200;
     static const NATIVE_UINT_TYPE TLMPACKETIZER_NUM_TLM_HASH_SLOTS = 15; // !< Number of slots in the hash table.
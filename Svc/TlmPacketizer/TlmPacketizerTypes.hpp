@@ -35,6 +35,41 @@ namespace Svc {
         const TlmPacketizerPacket* list[MAX_PACKETIZER_PACKETS]; //!< 
         NATIVE_UINT_TYPE numEntries;
     };
+
+    //! Type used to compare channel values when filtering updates
+    enum TlmPacketizerValueType {
+        TLM_VALUE_RAW, //!< compare serialized bytes. Any change counts; deadband is not used
+        TLM_VALUE_U8,
+        TLM_VALUE_I8,
+        TLM_VALUE_U16,
+        TLM_VALUE_I16,
+        TLM_VALUE_U32,
+        TLM_VALUE_I32,
+#if FW_HAS_64_BIT
+        TLM_VALUE_U64,
+        TLM_VALUE_I64,
+#endif
+        TLM_VALUE_F32,
+        TLM_VALUE_F64,
+    };
+
+    struct TlmPacketizerChannelFilter {
+        FwChanIdType id; //!< Id of channel
+        TlmPacketizerValueType type; //!< type of channel value
+        F64 deadband; //!< value must move more than this from the last change to update its packets
+    };
+
+    struct TlmPacketizerPacketInterval {
+        FwTlmPacketizeIdType id; //!< packet ID
+        NATIVE_UINT_TYPE minInterval; //!< minimum number of Run calls between sends of packet
+    };
+
+    struct TlmPacketizerFilterList {
+        const TlmPacketizerChannelFilter* channels; //!< channels only updating packets on change
+        NATIVE_UINT_TYPE numChannels; //!< number of channel filters
+        const TlmPacketizerPacketInterval* packets; //!< packets with a minimum send interval
+        NATIVE_UINT_TYPE numPackets; //!< number of packet intervals
+    };
 }
 
 #endif /* SVC_TLMPACKETIZER_TLMPACKETIZERTYPES_HPP_ */
@@ -630,6 +630,134 @@ namespace Svc {
 
   }
 
+  TlmPacketizerChannelFilter channelFilters[] = {
+          {10, TLM_VALUE_U32, 5.0},
+          {100, TLM_VALUE_RAW, 0.0}
+  };
+
+  TlmPacketizerPacketInterval packetIntervals[] = {
+          {8, 2}
+  };
+
+  TlmPacketizerFilterList filterList = {
+          channelFilters, FW_NUM_ARRAY_ELEMENTS(channelFilters),
+          packetIntervals, FW_NUM_ARRAY_ELEMENTS(packetIntervals)
+  };
+
+  void Tester ::
+     filterTest()
+  {
+      this->component.setPacketList(packetList,ignore,2);
+      this->component.setFilterList(filterList);
+      Fw::Time ts;
+      Fw::TlmBuffer buff;
+
+      Fw::ComBuffer comBuff;
+
+      // first value of filtered channel updates both packets
+      ts.set(100,1000);
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U32>(20)));
+      this->invoke_to_TlmRecv(0,10,ts,buff);
+
+      this->clearFromPortHistory();
+      this->invoke_to_Run(0,0);
+      this->component.doDispatch();
+      ASSERT_from_PktSend_SIZE(2);
+
+      // change within deadband updates no packets
+      buff.resetSer();
+      ts.add(1,0);
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U32>(24)));
+      this->invoke_to_TlmRecv(0,10,ts,buff);
+
+      this->clearFromPortHistory();
+      this->invoke_to_Run(0,0);
+      this->component.doDispatch();
+      ASSERT_from_PktSend_SIZE(0);
+
+      // first value of on-change channel updates its packet, and carries the value within deadband
+      buff.resetSer();
+      ts.add(1,0);
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U16>(15)));
+      this->invoke_to_TlmRecv(0,100,ts,buff);
+
+      this->clearFromPortHistory();
+      this->invoke_to_Run(0,0);
+      this->component.doDispatch();
+      ASSERT_from_PktSend_SIZE(1);
+
+      comBuff.resetSer();
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_PACKETIZED_TLM)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<FwTlmPacketizeIdType>(4)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(ts));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<U32>(24)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<U16>(15)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<U8>(0)));
+
+      ASSERT_from_PktSend(0,comBuff,static_cast<U32>(0));
+
+      // same value of on-change channel updates no packets
+      buff.resetSer();
+      ts.add(1,0);
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U16>(15)));
+      this->invoke_to_TlmRecv(0,100,ts,buff);
+
+      this->clearFromPortHistory();
+      this->invoke_to_Run(0,0);
+      this->component.doDispatch();
+      ASSERT_from_PktSend_SIZE(0);
+
+      // change outside deadband updates both packets. Packet 8 interval has passed.
+      buff.resetSer();
+      ts.add(1,0);
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U32>(30)));
+      this->invoke_to_TlmRecv(0,10,ts,buff);
+
+      this->clearFromPortHistory();
+      this->invoke_to_Run(0,0);
+      this->component.doDispatch();
+      ASSERT_from_PktSend_SIZE(2);
+
+      // next change only sends packet 4, since packet 8 was sent one run ago
+      buff.resetSer();
+      ts.add(1,0);
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U32>(40)));
+      this->invoke_to_TlmRecv(0,10,ts,buff);
+
+      this->clearFromPortHistory();
+      this->invoke_to_Run(0,0);
+      this->component.doDispatch();
+      ASSERT_from_PktSend_SIZE(1);
+
+      comBuff.resetSer();
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_PACKETIZED_TLM)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<FwTlmPacketizeIdType>(4)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(ts));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<U32>(40)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<U16>(15)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<U8>(0)));
+
+      ASSERT_from_PktSend(0,comBuff,static_cast<U32>(0));
+
+      // held packet 8 goes out on the following run
+      this->clearFromPortHistory();
+      this->invoke_to_Run(0,0);
+      this->component.doDispatch();
+      ASSERT_from_PktSend_SIZE(1);
+
+      comBuff.resetSer();
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_PACKETIZED_TLM)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<FwTlmPacketizeIdType>(8)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(ts));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<U32>(40)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<U64>(0)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<U16>(0)));
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(static_cast<U8>(0)));
+
+      ASSERT_from_PktSend(0,comBuff,static_cast<U32>(0));
+
+  }
+
   void Tester ::
      sendManualPacketTest()
   {
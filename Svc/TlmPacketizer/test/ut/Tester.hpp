@@ -76,6 +76,10 @@ namespace Svc {
       //!
       void sendManualPacketTest(void);
 
+      //! channel filter and packet interval test
+      //!
+      void filterTest(void);
+
       //! set packet level test
       //!
       void setPacketLevelTest(void);
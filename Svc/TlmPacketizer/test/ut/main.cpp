@@ -64,6 +64,13 @@ TEST(TestNominal,SendPacketTest) {
     Svc::Tester tester;
     tester.sendManualPacketTest();
 }
+TEST(TestNominal,FilterTest) {
+
+    TEST_CASE(100.1.8,"Channel filters and packet intervals");
+    Svc::Tester tester;
+    tester.filterTest();
+}
+
 #if 0
 TEST(TestNominal,SetPacketLevelTest) {
 
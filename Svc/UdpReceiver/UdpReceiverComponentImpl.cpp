@@ -135,11 +135,39 @@ namespace Svc {
 
   void UdpReceiverComponentImpl::doRecv() {
 
+#if defined TGT_OS_TYPE_LINUX
+      // wait for data from the socket, then take every packet already waiting
+      mmsghdr messages[UDP_RECEIVER_BATCH_SIZE];
+      iovec vectors[UDP_RECEIVER_BATCH_SIZE];
+      memset(messages, 0, sizeof(messages));
+      for (NATIVE_UINT_TYPE msg = 0; msg < UDP_RECEIVER_BATCH_SIZE; msg++) {
+          vectors[msg].iov_base = this->m_recvBuffs[msg].getBuffAddr();
+          vectors[msg].iov_len = this->m_recvBuffs[msg].getBuffCapacity();
+          messages[msg].msg_hdr.msg_iov = &vectors[msg];
+          messages[msg].msg_hdr.msg_iovlen = 1;
+      }
+      NATIVE_INT_TYPE numMsgs = recvmmsg(
+              this->m_fd,
+              messages,
+              UDP_RECEIVER_BATCH_SIZE,
+              MSG_WAITFORONE,
+              0);
+      if (-1 == numMsgs) {
+          if (errno != EINTR) {
+              Fw::LogStringArg arg(strerror(errno));
+              this->log_WARNING_HI_UR_RecvError(arg);
+          }
+          return;
+      }
+      for (NATIVE_INT_TYPE msg = 0; msg < numMsgs; msg++) {
+          this->decodePacket(this->m_recvBuffs[msg], messages[msg].msg_len);
+      }
+#else
       // wait for data from the socket
       NATIVE_INT_TYPE psize = recvfrom(
               this->m_fd,
-              this->m_recvBuff.getBuffAddr(),
-              this->m_recvBuff.getBuffCapacity(),
+              this->m_recvBuffs[0].getBuffAddr(),
+              this->m_recvBuffs[0].getBuffCapacity(),
               MSG_WAITALL,
               0,
               0);
@@ -150,13 +178,19 @@ namespace Svc {
           }
           return;
       }
+      this->decodePacket(this->m_recvBuffs[0], psize);
+#endif
+  }
+
+  void UdpReceiverComponentImpl::decodePacket(UdpSerialBuffer& packet, NATIVE_INT_TYPE psize) {
+
       // reset buffer for deserialization
-      Fw::SerializeStatus stat = this->m_recvBuff.setBuffLen(psize);
+      Fw::SerializeStatus stat = packet.setBuffLen(psize);
       FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, stat);
 
       // get sequence number
       U8 seqNum;
-      stat = this->m_recvBuff.deserialize(seqNum);
+      stat = packet.deserialize(seqNum);
       // check for deserialization error or port number too high
       if (stat != Fw::FW_SERIALIZE_OK) {
           this->log_WARNING_HI_UR_DecodeError(DECODE_SEQ,stat);
@@ -184,7 +218,7 @@ namespace Svc {
 
       // get port number
       U8 portNum;
-      stat = this->m_recvBuff.deserialize(portNum);
+      stat = packet.deserialize(portNum);
       // check for deserialization error or port number too high
       if (stat != Fw::FW_SERIALIZE_OK or portNum > this->getNum_PortsOut_OutputPorts()) {
           this->log_WARNING_HI_UR_DecodeError(DECODE_PORT,stat);
@@ -193,7 +227,7 @@ namespace Svc {
       }
       // get buffer for port
 
-      stat = this->m_recvBuff.deserialize(this->m_portBuff);
+      stat = packet.deserialize(this->m_portBuff);
       if (stat != Fw::FW_SERIALIZE_OK) {
           this->log_WARNING_HI_UR_DecodeError(DECODE_BUFFER,stat);
           this->m_decodeErrors++;
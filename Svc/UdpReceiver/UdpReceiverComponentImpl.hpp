@@ -71,7 +71,7 @@ namespace Svc {
       );
 
       static void workerTask(void* ptr); //!< worker task entry point
-      void doRecv(); //!< receives a single packet (helps unit testing)
+      void doRecv(); //!< receives the waiting packets (helps unit testing)
       Os::Task m_socketTask;
 
       NATIVE_INT_TYPE m_fd; //!< socket file descriptor
@@ -119,7 +119,9 @@ namespace Svc {
           // Should be the max of all the input ports serialized sizes...
           U8 m_buff[UDP_RECEIVER_MSG_SIZE];
 
-      } m_recvBuff;
+      } m_recvBuffs[UDP_RECEIVER_BATCH_SIZE]; //!< packets received by one doRecv
+
+      void decodePacket(UdpSerialBuffer& packet, NATIVE_INT_TYPE psize); //!< decodes a packet and calls the port
 
       UdpSerialBuffer m_portBuff; //!< working buffer for decoding packets
 
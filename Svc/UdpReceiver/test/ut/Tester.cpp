@@ -37,6 +37,9 @@ namespace Svc {
       UdpReceiverGTestBase(MAX_HISTORY_SIZE),
       component()
 #endif
+  ,m_sentVal(0)
+  ,m_sentPort(0)
+  ,m_numSent(0)
   {
     this->initComponents();
     this->connectPorts();
@@ -79,6 +82,39 @@ namespace Svc {
 
   }
 
+  void Tester::recvBatchTest(const char* port) {
+
+      this->component.open(port);
+
+      // send more packets than one receive takes
+
+      const NATIVE_UINT_TYPE packets = UDP_RECEIVER_BATCH_SIZE + 1;
+      for (NATIVE_UINT_TYPE packet = 0; packet < packets; packet++) {
+          this->sendPacket(100 + packet,"127.0.0.1",port,packet,packet % 10);
+      }
+
+      // the first receive takes a full batch
+
+      this->m_numSent = 0;
+      this->component.doRecv();
+      ASSERT_EQ(UDP_RECEIVER_BATCH_SIZE,this->m_numSent);
+
+      // the next takes what was left
+
+      this->component.doRecv();
+      ASSERT_EQ(packets,this->m_numSent);
+
+      // verify the port calls came out in order with none dropped
+
+      for (NATIVE_UINT_TYPE packet = 0; packet < packets; packet++) {
+          EXPECT_EQ(100 + packet,this->m_sentVals[packet]);
+          EXPECT_EQ(static_cast<NATIVE_INT_TYPE>(packet % 10),this->m_sentPorts[packet]);
+      }
+      EXPECT_EQ(packets,this->component.m_packetsReceived);
+      EXPECT_EQ(0u,this->component.m_packetsDropped);
+
+  }
+
 
   // ----------------------------------------------------------------------
   // Handlers for serial from ports
@@ -92,6 +128,11 @@ namespace Svc {
   {
       this->m_sentPort = portNum;
       EXPECT_EQ(Fw::FW_SERIALIZE_OK,Buffer.deserialize(this->m_sentVal));
+      if (this->m_numSent < FW_NUM_ARRAY_ELEMENTS(this->m_sentVals)) {
+          this->m_sentVals[this->m_numSent] = this->m_sentVal;
+          this->m_sentPorts[this->m_numSent] = this->m_sentPort;
+      }
+      this->m_numSent++;
 
   }
 
@@ -50,6 +50,10 @@ namespace Svc {
       //!
       void recvTest(const char* port);
 
+      //! Receive several packets per receive call
+      //!
+      void recvBatchTest(const char* port);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -93,6 +97,9 @@ namespace Svc {
       // stored port call arguments
       U32 m_sentVal;
       NATIVE_INT_TYPE m_sentPort;
+      NATIVE_UINT_TYPE m_numSent; //!< number of port calls
+      U32 m_sentVals[UDP_RECEIVER_BATCH_SIZE+1]; //!< values of each port call
+      NATIVE_INT_TYPE m_sentPorts[UDP_RECEIVER_BATCH_SIZE+1]; //!< port numbers of each port call
 
       void textLogIn(
                 const FwEventIdType id, //!< The event ID
@@ -19,6 +19,15 @@ TEST(Nominal,RecvPacket) {
 
 }
 
+TEST(Nominal,RecvPacketBatch) {
+
+    COMMENT("Receive several packets at once");
+
+    Svc::Tester tester;
+    tester.recvBatchTest("50000");
+
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
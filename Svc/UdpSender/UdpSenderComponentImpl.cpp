@@ -35,7 +35,8 @@ namespace Svc {
         m_fd(-1),
         m_packetsSent(0),
         m_bytesSent(0),
-        m_seq(0)
+        m_seq(0),
+        m_numSendBuffs(0)
   {
 
   }
@@ -116,38 +117,93 @@ namespace Svc {
       }
 
       DEBUG_PRINT("PortsIn_handler: %d\n",portNum);
+      FW_ASSERT(this->m_numSendBuffs < UDP_SENDER_BATCH_SIZE,this->m_numSendBuffs);
+      UdpSerialBuffer& sendBuff = this->m_sendBuffs[this->m_numSendBuffs];
       Fw::SerializeStatus stat;
-      m_sendBuff.resetSer();
+      sendBuff.resetSer();
 
       // serialize sequence number
-      stat = m_sendBuff.serialize(this->m_seq++);
+      stat = sendBuff.serialize(this->m_seq++);
       FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,stat);
       // serialize port call
-      stat = m_sendBuff.serialize(static_cast<U8>(portNum));
+      stat = sendBuff.serialize(static_cast<U8>(portNum));
       FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,stat);
       // serialize port arguments buffer
-      stat = m_sendBuff.serialize(Buffer);
+      stat = sendBuff.serialize(Buffer);
       FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,stat);
+      this->m_numSendBuffs++;
+
+      // hold the packet while more are queued behind it so they go out in one send. The only other message
+      // queued is the exit message, after which the finalizer sends what is held
+      if ((this->m_numSendBuffs == UDP_SENDER_BATCH_SIZE) or (this->m_queue.getNumMsgs() == 0)) {
+          this->flushSends();
+      }
+  }
+
+  void UdpSenderComponentImpl::finalizer() {
+      this->flushSends();
+  }
+
+  void UdpSenderComponentImpl::flushSends() {
+      if ((-1 == this->m_fd) or (0 == this->m_numSendBuffs)) {
+          return;
+      }
+#if defined TGT_OS_TYPE_LINUX
+      mmsghdr messages[UDP_SENDER_BATCH_SIZE];
+      iovec vectors[UDP_SENDER_BATCH_SIZE];
+      memset(messages, 0, sizeof(messages));
+      for (NATIVE_UINT_TYPE msg = 0; msg < this->m_numSendBuffs; msg++) {
+          vectors[msg].iov_base = this->m_sendBuffs[msg].getBuffAddr();
+          vectors[msg].iov_len = this->m_sendBuffs[msg].getBuffLength();
+          messages[msg].msg_hdr.msg_iov = &vectors[msg];
+          messages[msg].msg_hdr.msg_iovlen = 1;
+          messages[msg].msg_hdr.msg_name = &this->m_servAddr;
+          messages[msg].msg_hdr.msg_namelen = sizeof(this->m_servAddr);
+      }
       // send on UDP socket
-      DEBUG_PRINT("Sending %d bytes\n",m_sendBuff.getBuffLength());
-      ssize_t sendStat = sendto(this->m_fd,
-              m_sendBuff.getBuffAddr(),
-              m_sendBuff.getBuffLength(),
-              0,
-              reinterpret_cast<struct sockaddr *>(&m_servAddr),
-              sizeof(m_servAddr));
-      if (-1 == sendStat) {
-          Fw::LogStringArg arg(strerror(errno));
-          this->log_WARNING_HI_US_SendError(arg);
-      } else {
-          FW_ASSERT((int)m_sendBuff.getBuffLength() == sendStat,(int)m_sendBuff.getBuffLength(),sendStat,portNum);
-          this->m_packetsSent++;
-          this->m_bytesSent += sendStat;
+      DEBUG_PRINT("Sending %d packets\n",this->m_numSendBuffs);
+      NATIVE_UINT_TYPE sent = 0;
+      while (sent < this->m_numSendBuffs) {
+          NATIVE_INT_TYPE sendStat = sendmmsg(this->m_fd, &messages[sent], this->m_numSendBuffs - sent, 0);
+          if (-1 == sendStat) {
+              // drop the packet that failed and carry on with the rest
+              Fw::LogStringArg arg(strerror(errno));
+              this->log_WARNING_HI_US_SendError(arg);
+              sent++;
+              continue;
+          }
+          for (NATIVE_INT_TYPE msg = 0; msg < sendStat; msg++, sent++) {
+              FW_ASSERT(messages[sent].msg_len == vectors[sent].iov_len,messages[sent].msg_len,vectors[sent].iov_len);
+              this->m_packetsSent++;
+              this->m_bytesSent += messages[sent].msg_len;
+          }
+      }
+#else
+      for (NATIVE_UINT_TYPE msg = 0; msg < this->m_numSendBuffs; msg++) {
+          UdpSerialBuffer& sendBuff = this->m_sendBuffs[msg];
+          // send on UDP socket
+          DEBUG_PRINT("Sending %d bytes\n",sendBuff.getBuffLength());
+          ssize_t sendStat = sendto(this->m_fd,
+                  sendBuff.getBuffAddr(),
+                  sendBuff.getBuffLength(),
+                  0,
+                  reinterpret_cast<struct sockaddr *>(&m_servAddr),
+                  sizeof(m_servAddr));
+          if (-1 == sendStat) {
+              Fw::LogStringArg arg(strerror(errno));
+              this->log_WARNING_HI_US_SendError(arg);
+          } else {
+              FW_ASSERT(static_cast<ssize_t>(sendBuff.getBuffLength()) == sendStat,sendBuff.getBuffLength(),sendStat);
+              this->m_packetsSent++;
+              this->m_bytesSent += sendStat;
+          }
       }
+#endif
+      this->m_numSendBuffs = 0;
   }
 
 #ifdef BUILD_UT
-  UdpSerialBuffer& UdpSenderComponentImpl::UdpSerialBuffer::operator=(const Svc::UdpSenderComponentImpl::UdpSerialBuffer& other) {
+  UdpSenderComponentImpl::UdpSerialBuffer& UdpSenderComponentImpl::UdpSerialBuffer::operator=(const Svc::UdpSenderComponentImpl::UdpSerialBuffer& other) {
       this->resetSer();
       this->serialize(other.getBuffAddr(),other.getBuffLength(),true);
       return *this;
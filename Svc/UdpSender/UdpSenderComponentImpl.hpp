@@ -133,7 +133,13 @@ namespace Svc {
           // Should be the max of all the input ports serialized sizes...
           U8 m_buff[UDP_SENDER_MSG_SIZE];
 
-      } m_sendBuff;
+      } m_sendBuffs[UDP_SENDER_BATCH_SIZE]; //!< packets waiting to be sent
+
+      NATIVE_UINT_TYPE m_numSendBuffs; //!< number of packets in m_sendBuffs. Only used on the component thread
+
+      void flushSends(); //!< send the packets in m_sendBuffs
+
+      void finalizer(); //!< send the packets still held when the component exits
 
     };
 
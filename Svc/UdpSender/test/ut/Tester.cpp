@@ -107,6 +107,113 @@ namespace Svc {
 
   }
 
+  void Tester ::
+     sendBatchTest(const char* server, const char* port)
+  {
+
+    this->component.open(server,port);
+    // expect successfully opened
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_US_PortOpened_SIZE(1);
+
+    // open receive port
+    this->udpRecvStart(port);
+
+    this->clearEvents();
+
+    // queue more buffers than one send takes
+    const NATIVE_UINT_TYPE packets = UDP_SENDER_BATCH_SIZE + 2;
+    ASSERT_LE(packets,static_cast<NATIVE_UINT_TYPE>(QUEUE_DEPTH));
+    for (NATIVE_UINT_TYPE packet = 0; packet < packets; packet++) {
+        Svc::UdpSenderComponentImpl::UdpSerialBuffer buff;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U32>(100 + packet)));
+        this->invoke_to_PortsIn(packet % 10,buff);
+    }
+
+    // packets are held while more are queued, until a full batch goes out
+    for (NATIVE_UINT_TYPE packet = 1; packet <= packets; packet++) {
+        this->component.doDispatch();
+        const NATIVE_UINT_TYPE sent = (packet == packets) ? packets : (packet / UDP_SENDER_BATCH_SIZE) * UDP_SENDER_BATCH_SIZE;
+        ASSERT_EQ(sent,this->component.m_packetsSent) << "after dispatch " << packet;
+        ASSERT_EQ(packet - sent,this->component.m_numSendBuffs) << "after dispatch " << packet;
+    }
+    ASSERT_EVENTS_SIZE(0);
+    ASSERT_EQ(packets * 8,this->component.m_bytesSent);
+
+    // get data back in order
+    for (NATIVE_UINT_TYPE packet = 0; packet < packets; packet++) {
+        U8 recvBytes[256];
+        NATIVE_INT_TYPE bytes = this->udpGet(recvBytes,sizeof(recvBytes));
+        ASSERT_EQ(bytes,8);
+        Fw::ExternalSerializeBuffer checkBuff(recvBytes,8);
+        checkBuff.setBuffLen(8);
+        U8 seq;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,checkBuff.deserialize(seq));
+        ASSERT_EQ(packet,seq);
+        U8 portNum;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,checkBuff.deserialize(portNum));
+        ASSERT_EQ(packet % 10,portNum);
+        Svc::UdpSenderComponentImpl::UdpSerialBuffer inBuff;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,checkBuff.deserialize(inBuff));
+        U32 val;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,inBuff.deserialize(val));
+        ASSERT_EQ(100 + packet,val);
+    }
+
+  }
+
+  void Tester ::
+     sendOnExitTest(const char* server, const char* port)
+  {
+
+    this->component.open(server,port);
+    // expect successfully opened
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_US_PortOpened_SIZE(1);
+
+    // open receive port
+    this->udpRecvStart(port);
+
+    this->clearEvents();
+
+    // queue packets with the exit message behind them
+    const NATIVE_UINT_TYPE packets = 2;
+    ASSERT_LT(packets,UDP_SENDER_BATCH_SIZE);
+    for (NATIVE_UINT_TYPE packet = 0; packet < packets; packet++) {
+        Svc::UdpSenderComponentImpl::UdpSerialBuffer buff;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U32>(100 + packet)));
+        this->invoke_to_PortsIn(packet,buff);
+    }
+    this->component.exit();
+
+    // the packets are held while a message is queued behind them
+    for (NATIVE_UINT_TYPE packet = 0; packet < packets; packet++) {
+        ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->component.doDispatch());
+    }
+    ASSERT_EQ(0U,this->component.m_packetsSent);
+    ASSERT_EQ(packets,this->component.m_numSendBuffs);
+
+    // and sent once the component exits, as the task does
+    ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_EXIT,this->component.doDispatch());
+    this->component.finalizer();
+    ASSERT_EQ(packets,this->component.m_packetsSent);
+    ASSERT_EQ(0U,this->component.m_numSendBuffs);
+    ASSERT_EVENTS_SIZE(0);
+
+    // get data back in order
+    for (NATIVE_UINT_TYPE packet = 0; packet < packets; packet++) {
+        U8 recvBytes[256];
+        NATIVE_INT_TYPE bytes = this->udpGet(recvBytes,sizeof(recvBytes));
+        ASSERT_EQ(bytes,8);
+        Fw::ExternalSerializeBuffer checkBuff(recvBytes,8);
+        checkBuff.setBuffLen(8);
+        U8 seq;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,checkBuff.deserialize(seq));
+        ASSERT_EQ(packet,seq);
+    }
+
+  }
+
   // ----------------------------------------------------------------------
   // Helper methods
   // ----------------------------------------------------------------------
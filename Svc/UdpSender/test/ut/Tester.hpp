@@ -50,6 +50,14 @@ namespace Svc {
       //!
       void sendTest(const char* server, const char* port);
 
+      //! send packets queued behind each other test
+      //!
+      void sendBatchTest(const char* server, const char* port);
+
+      //! send packets held when the component exits test
+      //!
+      void sendOnExitTest(const char* server, const char* port);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -19,6 +19,24 @@ TEST(Nominal,SendPacket) {
 
 }
 
+TEST(Nominal,SendPacketBatch) {
+
+    COMMENT("Send queued packets together");
+
+    Svc::Tester tester;
+    tester.sendBatchTest("127.0.0.1","50000");
+
+}
+
+TEST(Nominal,SendPacketsOnExit) {
+
+    COMMENT("Send held packets when the component exits");
+
+    Svc::Tester tester;
+    tester.sendOnExitTest("127.0.0.1","50000");
+
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -77,6 +77,18 @@ namespace Utils {
           const NATIVE_INT_TYPE len
       );
 
+      //! Update an incremental computation with new data while copying it.
+      //! Equivalent to copying the data and then calling update, but
+      //! implementations may do both in a single pass over the data.
+      //! \param dest: pointer to destination of the copy, must not overlap data
+      //! \param data: pointer to start of data to copy and add to hash calculation
+      //! \param len: length of data to copy and add to hash calculation
+      void updateCopy(
+          void *const dest,
+          const void *const data,
+          const NATIVE_INT_TYPE len
+      );
+
       //! Finalize an incremental computation and return the result
       //!
       void final(
@@ -31,11 +31,9 @@ namespace Utils {
         HASH_HANDLE_TYPE local_hash_handle;
         local_hash_handle = 0xffffffffL;
         FW_ASSERT(data);
-        char c;
-        for(int index = 0; index < len; index++) {
-            c = static_cast<const char*>(data)[index];
-            local_hash_handle = update_crc_32(local_hash_handle, c);
-        }
+        FW_ASSERT(len >= 0, len);
+        local_hash_handle = static_cast<HASH_HANDLE_TYPE>(update_crc_32_block(local_hash_handle,
+            static_cast<const unsigned char*>(data), static_cast<unsigned long>(len)));
         HashBuffer bufferOut;
         // For CRC32 we need to return the one's complement of the result:
         Fw::SerializeStatus status = bufferOut.serialize(~(local_hash_handle));
@@ -53,11 +51,20 @@ namespace Utils {
         update(const void *const data, NATIVE_INT_TYPE len)
     {
         FW_ASSERT(data);
-        char c;
-        for(int index = 0; index < len; index++) {
-            c = static_cast<const char*>(data)[index];
-            this->hash_handle = update_crc_32(this->hash_handle, c);
-        }
+        FW_ASSERT(len >= 0, len);
+        this->hash_handle = static_cast<HASH_HANDLE_TYPE>(update_crc_32_block(this->hash_handle,
+            static_cast<const unsigned char*>(data), static_cast<unsigned long>(len)));
+    }
+
+    void Hash ::
+        updateCopy(void *const dest, const void *const data, NATIVE_INT_TYPE len)
+    {
+        FW_ASSERT(dest);
+        FW_ASSERT(data);
+        FW_ASSERT(len >= 0, len);
+        this->hash_handle = static_cast<HASH_HANDLE_TYPE>(update_crc_32_copy(this->hash_handle,
+            static_cast<unsigned char*>(dest), static_cast<const unsigned char*>(data),
+            static_cast<unsigned long>(len)));
     }
 
     void Hash ::
@@ -62,6 +62,8 @@
 
 unsigned short          update_crc_16(     unsigned short crc, char c                 );
 unsigned long           update_crc_32(     unsigned long  crc, char c                 );
+unsigned long           update_crc_32_block( unsigned long crc, const unsigned char *data, unsigned long len );
+unsigned long           update_crc_32_copy( unsigned long crc, unsigned char *dest, const unsigned char *src, unsigned long len );
 unsigned short          update_crc_ccitt(  unsigned short crc, char c                 );
 unsigned short          update_crc_dnp(    unsigned short crc, char c                 );
 unsigned short          update_crc_kermit( unsigned short crc, char c                 );
@@ -11,6 +11,7 @@
 // ======================================================================
 
 #include <Utils/Hash/Hash.hpp>
+#include <cstring>
 
 namespace Utils {
 
@@ -49,6 +50,14 @@ namespace Utils {
         FW_ASSERT(ret == 1);
     }
 
+    void Hash ::
+        updateCopy(void *const dest, const void *const data, NATIVE_INT_TYPE len)
+    {
+        // SHA256 has no fused copy, hash the copy while it is still in cache
+        memcpy(dest, data, len);
+        this->update(dest, len);
+    }
+
     void Hash ::
         final(HashBuffer& buffer)
     {
@@ -0,0 +1,137 @@
+// ======================================================================
+// \title  HashTest.cpp
+// \brief  Tests of the CRC32 backend of Utils::Hash
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <gtest/gtest.h>
+#include <Utils/Hash/Hash.hpp>
+#include <cstring>
+
+namespace {
+
+    enum {
+        MAX_LENGTH = 300, //!< longest data checked against the reference
+        MAX_OFFSET = 8, //!< data and copies are checked at each alignment below this
+        GUARD = 0xA5 //!< fill of the bytes around a copy
+    };
+
+    // Bit at a time CRC32 (reflected, polynomial 0xEDB88320) to check the table driven kernels against
+    U32 referenceCrc32(const U8* data, NATIVE_UINT_TYPE len) {
+        U32 crc = 0xFFFFFFFF;
+        for (NATIVE_UINT_TYPE byte = 0; byte < len; byte++) {
+            crc ^= data[byte];
+            for (NATIVE_UINT_TYPE bit = 0; bit < 8; bit++) {
+                crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320) : (crc >> 1);
+            }
+        }
+        return ~crc;
+    }
+
+    U32 hashValue(const void* data, NATIVE_INT_TYPE len) {
+        Utils::HashBuffer buffer;
+        Utils::Hash::hash(data, len, buffer);
+        U32 value = 0;
+        EXPECT_EQ(Fw::FW_SERIALIZE_OK, buffer.deserialize(value));
+        return value;
+    }
+
+    void fillData(U8* data, NATIVE_UINT_TYPE len) {
+        U32 state = 12345;
+        for (NATIVE_UINT_TYPE byte = 0; byte < len; byte++) {
+            state = state * 1103515245 + 12345;
+            data[byte] = static_cast<U8>(state >> 16);
+        }
+    }
+
+}
+
+TEST(HashTest, KnownAnswers) {
+    // Check values of the CRC-32 used by zlib and Ethernet
+    const char* check = "123456789";
+    ASSERT_EQ(0xCBF43926u, hashValue(check, static_cast<NATIVE_INT_TYPE>(strlen(check))));
+    ASSERT_EQ(0x00000000u, hashValue(check, 0));
+    ASSERT_EQ(0xE8B7BE43u, hashValue("a", 1));
+    const char* fox = "The quick brown fox jumps over the lazy dog";
+    ASSERT_EQ(0x414FA339u, hashValue(fox, static_cast<NATIVE_INT_TYPE>(strlen(fox))));
+
+    // The same values are reached incrementally
+    Utils::Hash hash;
+    hash.update(check, 4);
+    hash.update(check + 4, 5);
+    U32 value = 0;
+    hash.final(value);
+    ASSERT_EQ(0xCBF43926u, value);
+}
+
+TEST(HashTest, LengthsAndAlignments) {
+    U8 data[MAX_LENGTH + MAX_OFFSET];
+    fillData(data, sizeof(data));
+
+    // Lengths below, at and across the eight byte steps of the kernel, from each alignment
+    for (NATIVE_UINT_TYPE offset = 0; offset < MAX_OFFSET; offset++) {
+        for (NATIVE_UINT_TYPE len = 0; len <= MAX_LENGTH; len++) {
+            const U32 expected = referenceCrc32(&data[offset], len);
+            ASSERT_EQ(expected, hashValue(&data[offset], static_cast<NATIVE_INT_TYPE>(len))) << "offset " << offset << " length " << len;
+
+            // splitting the data across updates gives the same result
+            const NATIVE_UINT_TYPE split = len / 3;
+            Utils::Hash hash;
+            hash.update(&data[offset], static_cast<NATIVE_INT_TYPE>(split));
+            hash.update(&data[offset + split], static_cast<NATIVE_INT_TYPE>(len - split));
+            U32 value = 0;
+            hash.final(value);
+            ASSERT_EQ(expected, value) << "offset " << offset << " length " << len;
+        }
+    }
+}
+
+TEST(HashTest, UpdateCopy) {
+    U8 data[MAX_LENGTH + MAX_OFFSET];
+    U8 copied[MAX_LENGTH + 2 * MAX_OFFSET];
+    U8 expectedCopy[MAX_LENGTH + 2 * MAX_OFFSET];
+    fillData(data, sizeof(data));
+
+    // updateCopy must match memcpy followed by update, for each source and destination alignment
+    for (NATIVE_UINT_TYPE srcOffset = 0; srcOffset < MAX_OFFSET; srcOffset++) {
+        for (NATIVE_UINT_TYPE destOffset = 0; destOffset < MAX_OFFSET; destOffset++) {
+            for (NATIVE_UINT_TYPE len = 0; len <= MAX_LENGTH; len += (len < 40) ? 1 : 13) {
+                memset(expectedCopy, GUARD, sizeof(expectedCopy));
+                memcpy(&expectedCopy[destOffset], &data[srcOffset], len);
+                Utils::Hash reference;
+                reference.update(&data[srcOffset], static_cast<NATIVE_INT_TYPE>(len));
+                U32 expected = 0;
+                reference.final(expected);
+
+                memset(copied, GUARD, sizeof(copied));
+                Utils::Hash hash;
+                hash.updateCopy(&copied[destOffset], &data[srcOffset], static_cast<NATIVE_INT_TYPE>(len));
+                U32 value = 0;
+                hash.final(value);
+
+                ASSERT_EQ(expected, value) << "source " << srcOffset << " dest " << destOffset << " length " << len;
+                // the copy matches and nothing around it is written
+                ASSERT_EQ(0, memcmp(copied, expectedCopy, sizeof(copied))) << "source " << srcOffset << " dest " << destOffset << " length " << len;
+            }
+        }
+    }
+
+    // updateCopy continues a hash started with update
+    Utils::Hash hash;
+    hash.update(data, 5);
+    hash.updateCopy(copied, &data[5], 100);
+    U32 value = 0;
+    hash.final(value);
+    ASSERT_EQ(referenceCrc32(data, 105), value);
+    ASSERT_EQ(0, memcmp(copied, &data[5], 100));
+}
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -19,6 +19,7 @@
 #endif
 
 #include <cstdio>
+#include <cstring>
 
 
 namespace Types {
@@ -40,15 +41,8 @@ NATIVE_UINT_TYPE CircularBuffer :: get_remaining_size(bool serialization) {
 }
 
 U8* CircularBuffer :: increment(U8* const pointer, NATIVE_UINT_TYPE amount) {
-    U8* ret = pointer;
-    //TODO: need O(1) implementation here
-    for (NATIVE_UINT_TYPE i = 0; i < amount; i++) {
-        ret = ret + 1;
-        if (ret >= (m_store + m_size)) {
-            ret = m_store;
-        }
-    }
-    return ret;
+    const NATIVE_UINT_TYPE index = static_cast<NATIVE_UINT_TYPE>(pointer - m_store);
+    return m_store + ((index + amount) % m_size);
 }
 
 Fw::SerializeStatus CircularBuffer :: serialize(const U8* const buffer, const NATIVE_UINT_TYPE size) {
@@ -59,15 +53,12 @@ Fw::SerializeStatus CircularBuffer :: serialize(const U8* const buffer, const NA
     if (size > get_remaining_size(true)) {
         return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
     }
-    // Copy in all the supplied data
-    for (U32 i = 0; i < size; i++) {
-        *m_tail = buffer[i];
-        // Wrap-around increment of tail
-        m_tail = increment(m_tail);
-        FW_ASSERT(m_tail != m_head,
-                reinterpret_cast<POINTER_CAST>(m_tail),
-                reinterpret_cast<POINTER_CAST>(m_head));
-    }
+    // Copy in the supplied data up to the end of the store, then wrap around for the rest
+    NATIVE_UINT_TYPE first = static_cast<NATIVE_UINT_TYPE>((m_store + m_size) - m_tail);
+    first = (first > size) ? size : first;
+    ::memcpy(m_tail, buffer, first);
+    ::memcpy(m_store, buffer + first, size - first);
+    m_tail = increment(m_tail, size);
     ASSERT_CONSISTENT(m_store, m_size, m_head);
     ASSERT_CONSISTENT(m_store, m_size, m_tail);
     return Fw::FW_SERIALIZE_OK;
@@ -113,6 +104,20 @@ Fw::SerializeStatus CircularBuffer :: peek(U32& value, NATIVE_UINT_TYPE offset)
 }
 
 Fw::SerializeStatus CircularBuffer :: peek(U8* buffer, NATIVE_UINT_TYPE size, NATIVE_UINT_TYPE offset) {
+    Span first;
+    Span second;
+    const Fw::SerializeStatus status = get_spans(first, second, size, offset);
+    if (status != Fw::FW_SERIALIZE_OK) {
+        return status;
+    }
+    ::memcpy(buffer, first.data, first.size);
+    if (second.size > 0) {
+        ::memcpy(buffer + first.size, second.data, second.size);
+    }
+    return Fw::FW_SERIALIZE_OK;
+}
+
+Fw::SerializeStatus CircularBuffer :: get_spans(Span& first, Span& second, NATIVE_UINT_TYPE size, NATIVE_UINT_TYPE offset) {
     // Check that the head and tail pointers are consistent
     ASSERT_CONSISTENT(m_store, m_size, m_head);
     ASSERT_CONSISTENT(m_store, m_size, m_tail);
@@ -120,19 +125,40 @@ Fw::SerializeStatus CircularBuffer :: peek(U8* buffer, NATIVE_UINT_TYPE size, NA
     if ((size + offset) > get_remaining_size(false)) {
         return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
     }
-    U8* peeker = m_head;
-    peeker = increment(peeker, offset);
-    // Deserialize all the bytes from network format
-    for (NATIVE_UINT_TYPE i = 0; i < size; i++) {
-        *buffer = *peeker;
-        peeker = increment(peeker);
-        buffer = buffer + 1;
-    }
-    ASSERT_CONSISTENT(m_store, m_size, m_head);
-    ASSERT_CONSISTENT(m_store, m_size, m_tail);
+    const U8* start = increment(m_head, offset);
+    // Data runs to the end of the store and then wraps around to the start of the store
+    NATIVE_UINT_TYPE to_end = static_cast<NATIVE_UINT_TYPE>((m_store + m_size) - start);
+    first.data = start;
+    first.size = (to_end > size) ? size : to_end;
+    second.data = (size > first.size) ? m_store : nullptr;
+    second.size = size - first.size;
     return Fw::FW_SERIALIZE_OK;
 }
 
+Fw::SerializeStatus CircularBuffer :: find(U8 value, NATIVE_UINT_TYPE& offset) {
+    const NATIVE_UINT_TYPE available = get_remaining_size(false);
+    if (offset >= available) {
+        return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+    }
+    Span first;
+    Span second;
+    const Fw::SerializeStatus status = get_spans(first, second, available - offset, offset);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    const U8* match = static_cast<const U8*>(::memchr(first.data, value, first.size));
+    if (match != nullptr) {
+        offset = offset + static_cast<NATIVE_UINT_TYPE>(match - first.data);
+        return Fw::FW_SERIALIZE_OK;
+    }
+    if (second.size > 0) {
+        match = static_cast<const U8*>(::memchr(second.data, value, second.size));
+        if (match != nullptr) {
+            offset = offset + first.size + static_cast<NATIVE_UINT_TYPE>(match - second.data);
+            return Fw::FW_SERIALIZE_OK;
+        }
+    }
+    return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+}
+
 Fw::SerializeStatus CircularBuffer :: rotate(NATIVE_UINT_TYPE amount) {
     // Check that the head and tail pointers are consistent
     ASSERT_CONSISTENT(m_store, m_size, m_head);
@@ -30,6 +30,15 @@ namespace Types {
 
 class CircularBuffer {
     public:
+        /**
+         * A contiguous region of the data store. Points into the store, so it is only valid until the
+         * data is rotated away.
+         */
+        struct Span {
+            const U8* data; //!< Start of the region, or nullptr when empty
+            NATIVE_UINT_TYPE size; //!< Size of the region in bytes
+        };
+
         /**
          * Circular buffer constructor. Wraps the supplied buffer as the new data store. Buffer
          * size is supplied in the 'size' argument.
@@ -81,6 +90,27 @@ class CircularBuffer {
          */
         Fw::SerializeStatus peek(U8* buffer, NATIVE_UINT_TYPE size, NATIVE_UINT_TYPE offset = 0);
 
+        /**
+         * Get the data in a range as contiguous regions of the data store without copying it or moving the
+         * head pointer. A range that wraps around the end of the store is split in two, otherwise the second
+         * region is empty.
+         * \param first: set to the region holding the start of the range
+         * \param second: set to the region holding the rest of the range
+         * \param size: size in bytes of the range
+         * \param offset: offset from head to start of the range. Default: 0
+         * \return Fw::FW_SERIALIZE_OK on success or something else on error
+         */
+        Fw::SerializeStatus get_spans(Span& first, Span& second, NATIVE_UINT_TYPE size, NATIVE_UINT_TYPE offset = 0);
+
+        /**
+         * Search for a byte value without moving the head pointer. Each contiguous region of the data
+         * store is searched with memchr rather than peeking one byte at a time.
+         * \param value: byte value to search for
+         * \param offset: offset from head to start the search. Set to the offset of the match when found.
+         * \return Fw::FW_SERIALIZE_OK when found, Fw::FW_DESERIALIZE_BUFFER_EMPTY when no data matches
+         */
+        Fw::SerializeStatus find(U8 value, NATIVE_UINT_TYPE& offset);
+
         /**
          * Rotate the head pointer effectively erasing data from the circular buffer and making
          * space. Cannot rotate more than the available space.
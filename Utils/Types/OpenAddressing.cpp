@@ -0,0 +1,20 @@
+/*
+ * OpenAddressing.cpp:
+ *
+ * Key hash shared by the open-addressed tables. See OpenAddressing.hpp.
+ */
+#include <Utils/Types/OpenAddressing.hpp>
+
+namespace Types {
+
+U32 hashKey(U32 key) {
+    U32 hash = key;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35U;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+}
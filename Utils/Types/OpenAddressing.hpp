@@ -0,0 +1,96 @@
+/*
+ * OpenAddressing.hpp:
+ *
+ * Lookup and removal for open-addressed hash tables with linear probing. The table is an array
+ * of entries owned by the caller, who also decides when an entry is added: find() returns the
+ * empty slot a missing key would be placed in. Probes stop after visiting every slot, but the
+ * caller is expected to keep the table at most half full so that they stay short.
+ *
+ * The entries are described by a Traits object with the const methods:
+ *
+ *     bool isEmpty(const Entry& entry)  the entry holds no key
+ *     U32 getKey(const Entry& entry)    key of an entry that is not empty
+ *     U32 getHash(U32 key)              hash of a key; its slot is the hash modulo the table size
+ *     void clear(Entry& entry)          empty an entry
+ *
+ * Removal moves back the entries probed past the freed slot instead of leaving a tombstone, so
+ * lookups never slow down as keys come and go.
+ */
+#include <FpConfig.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#ifndef TYPES_OPEN_ADDRESSING_HPP
+#define TYPES_OPEN_ADDRESSING_HPP
+
+namespace Types {
+
+/**
+ * Mixes the bits of a key (the murmur3 finalizer), so that keys numbered close together, like the
+ * opcodes or event IDs of neighboring components, spread over a table.
+ * \param key: the key to hash
+ * \return hash of the key
+ */
+U32 hashKey(U32 key);
+
+template <typename Entry, typename Traits>
+class OpenAddressing {
+    public:
+        /**
+         * Probe the table from the home slot of a key until the entry holding the key or an empty
+         * entry is found.
+         * \param table: the table
+         * \param size: number of entries in the table
+         * \param key: the key to look up
+         * \param traits: description of the entries
+         * \return the slot holding the key, or the empty slot it would be placed in. When the table is
+         *         full and lacks the key, a slot holding another key
+         */
+        static U32 find(const Entry* table, const U32 size, const U32 key, const Traits& traits);
+
+        /**
+         * Empty a slot, moving back each following entry whose probe from its home slot passed it
+         * so that every key stays reachable.
+         * \param table: the table
+         * \param size: number of entries in the table
+         * \param slot: the slot to empty
+         * \param traits: description of the entries
+         */
+        static void remove(Entry* table, const U32 size, const U32 slot, const Traits& traits);
+};
+
+template <typename Entry, typename Traits>
+U32 OpenAddressing<Entry, Traits>::find(const Entry* table, const U32 size, const U32 key, const Traits& traits) {
+    FW_ASSERT(table != nullptr);
+    FW_ASSERT(size > 0);
+    U32 slot = traits.getHash(key) % size;
+    for (U32 probe = 0; probe < size; probe++) {
+        if (traits.isEmpty(table[slot]) or (traits.getKey(table[slot]) == key)) {
+            return slot;
+        }
+        slot = (slot + 1) % size;
+    }
+    // a full table without the key: back at the home slot, which holds another key
+    return slot;
+}
+
+template <typename Entry, typename Traits>
+void OpenAddressing<Entry, Traits>::remove(Entry* table, const U32 size, const U32 slot, const Traits& traits) {
+    FW_ASSERT(table != nullptr);
+    FW_ASSERT(slot < size, slot, size);
+    traits.clear(table[slot]);
+    U32 hole = slot;
+    for (U32 next = (slot + 1) % size; not traits.isEmpty(table[next]); next = (next + 1) % size) {
+        const U32 home = traits.getHash(traits.getKey(table[next])) % size;
+        // move the entry if the hole lies on its probe, i.e. no further from home than the entry itself
+        if (((next + size - home) % size) >= ((next + size - hole) % size)) {
+            table[hole] = table[next];
+            traits.clear(table[next]);
+            hole = next;
+        }
+    }
+}
+
+}
+
+#endif
@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 
 #include <cstdio>
+#include <cstring>
 #include <cmath>
 
 #define STEP_COUNT 1000
@@ -172,6 +173,75 @@ TEST(CircularBufferTests, BasicRotateBadTest) {
     rotateBad.apply(state);
 }
 
+/**
+ * Test that finds work on both sides of the wrap-around.
+ */
+TEST(CircularBufferTests, BasicFindTest) {
+    U8 store[8];
+    U8 data[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    Types::CircularBuffer circular(store, sizeof(store));
+    // Move head and tail so the data wraps around the end of the store
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.serialize(data, 5));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.rotate(5));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.serialize(data, sizeof(data)));
+
+    NATIVE_UINT_TYPE offset = 0;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.find(0x02, offset));
+    ASSERT_EQ(1U, offset);
+    offset = 1;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.find(0x05, offset));
+    ASSERT_EQ(4U, offset);
+    offset = 4;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.find(0x06, offset));
+    ASSERT_EQ(5U, offset);
+    // Values before the offset or not in the buffer are not found
+    offset = 2;
+    ASSERT_EQ(Fw::FW_DESERIALIZE_BUFFER_EMPTY, circular.find(0x01, offset));
+    offset = 0;
+    ASSERT_EQ(Fw::FW_DESERIALIZE_BUFFER_EMPTY, circular.find(0x07, offset));
+    offset = sizeof(data);
+    ASSERT_EQ(Fw::FW_DESERIALIZE_BUFFER_EMPTY, circular.find(0x06, offset));
+}
+
+/**
+ * Test that spans split ranges at the wrap-around.
+ */
+TEST(CircularBufferTests, BasicSpansTest) {
+    U8 store[8];
+    U8 data[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    U8 peeked[sizeof(data)];
+    Types::CircularBuffer circular(store, sizeof(store));
+    Types::CircularBuffer::Span first;
+    Types::CircularBuffer::Span second;
+    // Move head and tail so the data wraps around the end of the store
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.serialize(data, 5));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.rotate(5));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.serialize(data, sizeof(data)));
+
+    // Range before the wrap-around is one span
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.get_spans(first, second, 3));
+    ASSERT_EQ(store + 5, first.data);
+    ASSERT_EQ(3U, first.size);
+    ASSERT_EQ(0U, second.size);
+    // Range across the wrap-around is split
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.get_spans(first, second, 4, 1));
+    ASSERT_EQ(store + 6, first.data);
+    ASSERT_EQ(2U, first.size);
+    ASSERT_EQ(store, second.data);
+    ASSERT_EQ(2U, second.size);
+    // Range after the wrap-around is one span
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.get_spans(first, second, 2, 4));
+    ASSERT_EQ(store + 1, first.data);
+    ASSERT_EQ(2U, first.size);
+    ASSERT_EQ(0U, second.size);
+    // Range past the data is rejected
+    ASSERT_EQ(Fw::FW_DESERIALIZE_BUFFER_EMPTY, circular.get_spans(first, second, 4, 3));
+
+    // Peeks copy out of both spans
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, circular.peek(peeked, sizeof(peeked)));
+    ASSERT_EQ(0, ::memcmp(data, peeked, sizeof(data)));
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,197 @@
+/**
+ * OpenAddressingTest.cpp:
+ *
+ * Unit tests of the open-addressed table helpers, on a small table with keys chosen to collide
+ * and on random adds and removes checked against a reference set.
+ */
+#include <Utils/Types/OpenAddressing.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <set>
+
+namespace {
+
+#define TABLE_SIZE 8
+#define RANDOM_STEPS 10000
+
+// Key 0 marks an empty entry, as in the ActiveLogger ID filter
+struct Entry {
+    U32 key;
+    U32 value;
+};
+
+// Keys are their own hash, so the test places them in chosen slots
+struct IdentityTraits {
+    bool isEmpty(const Entry& entry) const { return entry.key == 0; }
+    U32 getKey(const Entry& entry) const { return entry.key; }
+    U32 getHash(U32 key) const { return key; }
+    void clear(Entry& entry) const { entry.key = 0; }
+};
+
+struct HashTraits {
+    bool isEmpty(const Entry& entry) const { return entry.key == 0; }
+    U32 getKey(const Entry& entry) const { return entry.key; }
+    U32 getHash(U32 key) const { return Types::hashKey(key); }
+    void clear(Entry& entry) const { entry.key = 0; }
+};
+
+template <typename Traits>
+class Table {
+    public:
+        Table() {
+            for (U32 slot = 0; slot < TABLE_SIZE; slot++) {
+                this->m_entries[slot].key = 0;
+                this->m_entries[slot].value = 0;
+            }
+        }
+
+        U32 find(U32 key) const {
+            return Types::OpenAddressing<Entry, Traits>::find(this->m_entries, TABLE_SIZE, key, Traits());
+        }
+
+        // Add a missing key, returning its slot
+        U32 add(U32 key) {
+            const U32 slot = this->find(key);
+            EXPECT_EQ(0U, this->m_entries[slot].key);
+            this->m_entries[slot].key = key;
+            this->m_entries[slot].value = key + 1;
+            return slot;
+        }
+
+        void remove(U32 key) {
+            const U32 slot = this->find(key);
+            ASSERT_EQ(key, this->m_entries[slot].key);
+            Types::OpenAddressing<Entry, Traits>::remove(this->m_entries, TABLE_SIZE, slot, Traits());
+        }
+
+        bool contains(U32 key) const {
+            const Entry& entry = this->m_entries[this->find(key)];
+            if (entry.key != key) {
+                return false;
+            }
+            EXPECT_EQ(key + 1, entry.value);
+            return true;
+        }
+
+        Entry m_entries[TABLE_SIZE];
+};
+
+}
+
+TEST(OpenAddressingTests, HashSpreadsNeighboringKeys) {
+    // the finalizer maps 0 to 0 and is a bijection, so distinct keys keep distinct hashes
+    ASSERT_EQ(0U, Types::hashKey(0));
+    std::set<U32> slots;
+    for (U32 key = 0x100; key < 0x100 + TABLE_SIZE; key++) {
+        ASSERT_NE(key, Types::hashKey(key));
+        slots.insert(Types::hashKey(key) % (4 * TABLE_SIZE));
+    }
+    // consecutive keys do not land in consecutive slots
+    ASSERT_GT(slots.size(), TABLE_SIZE / 2U);
+}
+
+TEST(OpenAddressingTests, FindProbesPastCollisions) {
+    Table<IdentityTraits> table;
+    // an empty table returns the home slot
+    ASSERT_EQ(3U, table.find(3));
+    ASSERT_EQ(3U, table.add(3));
+    // keys with the same home slot take the following slots
+    ASSERT_EQ(4U, table.add(3 + TABLE_SIZE));
+    ASSERT_EQ(5U, table.add(3 + 2 * TABLE_SIZE));
+    ASSERT_EQ(4U, table.find(3 + TABLE_SIZE));
+    ASSERT_EQ(5U, table.find(3 + 2 * TABLE_SIZE));
+    // a key whose home slot is taken probes past it
+    ASSERT_EQ(6U, table.add(4));
+    // a missing key returns the empty slot ending its probe
+    ASSERT_EQ(7U, table.find(3 + 3 * TABLE_SIZE));
+    ASSERT_FALSE(table.contains(3 + 3 * TABLE_SIZE));
+}
+
+TEST(OpenAddressingTests, FindWrapsAround) {
+    Table<IdentityTraits> table;
+    ASSERT_EQ(TABLE_SIZE - 1U, table.add(TABLE_SIZE - 1));
+    ASSERT_EQ(0U, table.add(2 * TABLE_SIZE - 1));
+    ASSERT_EQ(1U, table.add(3 * TABLE_SIZE - 1));
+    ASSERT_TRUE(table.contains(3 * TABLE_SIZE - 1));
+}
+
+TEST(OpenAddressingTests, FindInFullTable) {
+    Table<IdentityTraits> table;
+    for (U32 key = 1; key <= TABLE_SIZE; key++) {
+        table.add(key);
+    }
+    for (U32 key = 1; key <= TABLE_SIZE; key++) {
+        ASSERT_TRUE(table.contains(key));
+    }
+    // a missing key ends back at its home slot
+    ASSERT_EQ(5U, table.find(5 + TABLE_SIZE));
+    ASSERT_FALSE(table.contains(5 + TABLE_SIZE));
+}
+
+TEST(OpenAddressingTests, RemoveMovesBackProbedEntries) {
+    Table<IdentityTraits> table;
+    table.add(3);
+    table.add(3 + TABLE_SIZE);
+    table.add(4);
+    table.add(6);
+    // slots 3, 4 and 5 hold 3, 3 + TABLE_SIZE and 4. 6 is at home
+    table.remove(3);
+    ASSERT_EQ(3U, table.find(3 + TABLE_SIZE));
+    ASSERT_EQ(4U, table.find(4));
+    ASSERT_EQ(6U, table.find(6));
+    ASSERT_EQ(0U, table.m_entries[5].key);
+    ASSERT_FALSE(table.contains(3));
+    ASSERT_TRUE(table.contains(3 + TABLE_SIZE));
+    ASSERT_TRUE(table.contains(4));
+    ASSERT_TRUE(table.contains(6));
+}
+
+TEST(OpenAddressingTests, RemoveKeepsEntriesAtHome) {
+    Table<IdentityTraits> table;
+    table.add(2);
+    table.add(3);
+    table.add(2 + TABLE_SIZE);
+    // slots 2, 3 and 4 hold 2, 3 and 2 + TABLE_SIZE. Removing 3 moves only the entry probed past it
+    table.remove(3);
+    ASSERT_EQ(2U, table.find(2));
+    ASSERT_EQ(3U, table.find(2 + TABLE_SIZE));
+    ASSERT_EQ(0U, table.m_entries[4].key);
+}
+
+TEST(OpenAddressingTests, RemoveWrapsAround) {
+    Table<IdentityTraits> table;
+    table.add(TABLE_SIZE - 1);
+    table.add(2 * TABLE_SIZE - 1);
+    table.add(0 + TABLE_SIZE);
+    // slots 7, 0 and 1 hold TABLE_SIZE - 1, 2 * TABLE_SIZE - 1 and TABLE_SIZE
+    table.remove(TABLE_SIZE - 1);
+    ASSERT_EQ(TABLE_SIZE - 1U, table.find(2 * TABLE_SIZE - 1));
+    ASSERT_EQ(0U, table.find(TABLE_SIZE));
+    ASSERT_EQ(0U, table.m_entries[1].key);
+}
+
+TEST(OpenAddressingTests, RandomAddsAndRemoves) {
+    Table<HashTraits> table;
+    std::set<U32> reference;
+    srand(0);
+    for (U32 step = 0; step < RANDOM_STEPS; step++) {
+        // few distinct keys, so that adds and removes hit the same keys
+        const U32 key = 1 + static_cast<U32>(rand()) % (2 * TABLE_SIZE);
+        if (reference.count(key) != 0) {
+            table.remove(key);
+            reference.erase(key);
+        } else if (reference.size() < TABLE_SIZE / 2) {
+            table.add(key);
+            reference.insert(key);
+        }
+        for (U32 check = 1; check <= 2 * TABLE_SIZE; check++) {
+            ASSERT_EQ(reference.count(check) != 0, table.contains(check)) << "key " << check << " step " << step;
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,146 @@
+"""
+tlmHashTool.py:
+
+Searches for telemetry hash table settings for Svc::TlmChan and Svc::TlmPacketizer
+that map every channel ID in a deployment to its own hash slot. Both components
+hash with (id % MOD_VALUE) % NUM_TLM_HASH_SLOTS and walk a chain of buckets when
+IDs collide. With collision-free settings every lookup stops at the head of its
+slot, so storing and reading a channel is a single hash and compare.
+
+Channel IDs are read from telemetry or topology dictionary XML files (any
+<channel id="..."> element) or given as a comma-separated list, such as the
+"Telemetry IDs:" line of a component report.
+
+Example:
+    python3 tlmHashTool.py Top/RefTopologyAppDictionary.xml
+"""
+import sys
+import xml.etree.ElementTree as ET
+from optparse import OptionParser
+
+CONFIGS = {
+    "TlmChan": (
+        "config/TlmChanImplCfg.hpp",
+        "TLMCHAN_NUM_TLM_HASH_SLOTS",
+        "TLMCHAN_HASH_MOD_VALUE",
+        "TLMCHAN_HASH_BUCKETS",
+    ),
+    "TlmPacketizer": (
+        "Svc/TlmPacketizer/TlmPacketizerComponentImplCfg.hpp",
+        "TLMPACKETIZER_NUM_TLM_HASH_SLOTS",
+        "TLMPACKETIZER_HASH_MOD_VALUE",
+        "TLMPACKETIZER_HASH_BUCKETS",
+    ),
+}
+
+
+def setup_opt_parse():
+    usage = "usage: %prog [options] [dictionary_xml ...]"
+    parser = OptionParser(usage)
+
+    parser.add_option(
+        "-i",
+        "--ids",
+        dest="ids",
+        help="Comma-separated list of channel IDs (decimal or 0x hex).",
+        default=None,
+    )
+
+    parser.add_option(
+        "-m",
+        "--max_slots",
+        dest="max_slots",
+        type="int",
+        help="Largest number of hash slots to try. Default is 16 times the number of channels.",
+        default=None,
+    )
+
+    parser.add_option(
+        "-r",
+        "--mod_range",
+        dest="mod_range",
+        type="int",
+        help="Modulo values from slots to slots * MOD_RANGE are tried for each slot count. Default is 8.",
+        default=8,
+    )
+
+    return parser
+
+
+def parse_id(text):
+    """
+    Converts a dictionary or report ID string into an integer
+    """
+    text = text.strip()
+    if text.lower().startswith("0x"):
+        return int(text, 16)
+    return int(text, 10)
+
+
+def read_dictionary_ids(xml_path):
+    """
+    Returns the IDs of all channel elements in a dictionary XML file
+    """
+    tree = ET.parse(xml_path)
+    return [parse_id(chan.get("id")) for chan in tree.iter("channel")]
+
+
+def is_perfect(ids, mod_value, slots):
+    """
+    Checks that no two IDs hash to the same slot
+    """
+    hashes = {(chan_id % mod_value) % slots for chan_id in ids}
+    return len(hashes) == len(ids)
+
+
+def search(ids, max_slots, mod_range):
+    """
+    Returns the (slots, mod_value) pair with the fewest slots that hashes the IDs
+    without collisions, or None if none were found.
+    """
+    for slots in range(len(ids), max_slots + 1):
+        # A modulo value equal to the slot count reduces to id % slots
+        for mod_value in range(slots, slots * mod_range + 1):
+            if is_perfect(ids, mod_value, slots):
+                return slots, mod_value
+    return None
+
+
+def main():
+    parser = setup_opt_parse()
+    (opts, args) = parser.parse_args()
+
+    ids = []
+    for xml_path in args:
+        ids.extend(read_dictionary_ids(xml_path))
+    if opts.ids:
+        ids.extend(parse_id(chan_id) for chan_id in opts.ids.split(",") if chan_id.strip())
+
+    # Duplicate IDs would never be collision free
+    ids = sorted(set(ids))
+    if not ids:
+        parser.error("No channel IDs given")
+
+    max_slots = opts.max_slots if opts.max_slots else 16 * len(ids)
+    result = search(ids, max_slots, opts.mod_range)
+    if result is None:
+        print(
+            "No collision-free settings found for {} channels with up to {} slots.".format(
+                len(ids), max_slots
+            )
+        )
+        return 1
+
+    slots, mod_value = result
+    print("{} channels hash without collisions using:".format(len(ids)))
+    for component, (cfg_file, slots_name, mod_name, buckets_name) in CONFIGS.items():
+        print()
+        print("{} ({}):".format(component, cfg_file))
+        print("    {} = {}".format(slots_name, slots))
+        print("    {} = {}".format(mod_name, mod_value))
+        print("    {} >= {}".format(buckets_name, len(ids)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
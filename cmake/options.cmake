@@ -82,6 +82,48 @@ if (DEFINED FPRIME_USE_BAREMETAL_SCHEDULER AND NOT "${FPRIME_USE_BAREMETAL_SCHED
     message(FATAL_ERROR "FPRIME_USE_BAREMETAL_SCHEDULER must be set to ON, OFF, or not supplied at all")
 endif()
 
+####
+# `FPRIME_USE_RING_QUEUE`:
+#
+# Tells fprime to use the lock-free ring queue (Os/Linux/RingQueue.cpp) for Os::Queue in place of the pthread mutex and
+# condition variable queue. Senders and receivers only make a system call when sleeping on an empty or full queue. The
+# ring queue delivers messages in FIFO order and ignores message priority. It is only available on Linux, where its own
+# unit test (Os_ring_queue) is built and run whichever queue is selected.
+#
+# If unspecified, it will be set in the platform file for the given architecture. If specified, may be set to ON to use
+# the ring queue or OFF to use the pthread queue.
+#
+# **Values:**
+# - ON: use the lock-free ring queue
+# - OFF: use the pthread queue
+#   Note: the chosen platform file will set the default value for this switch
+#
+# e.g. `-DFPRIME_USE_RING_QUEUE=ON`
+###
+if (DEFINED FPRIME_USE_RING_QUEUE AND NOT "${FPRIME_USE_RING_QUEUE}" STREQUAL "ON" AND NOT "${FPRIME_USE_RING_QUEUE}" STREQUAL "OFF")
+    message(FATAL_ERROR "FPRIME_USE_RING_QUEUE must be set to ON, OFF, or not supplied at all")
+endif()
+
+####
+# `FPRIME_QUEUE_INSTRUMENTATION`:
+#
+# Tells fprime to build every Os::Queue with wait time, dispatch time and depth histograms (see Os/QueueStats.hpp) by
+# setting FW_QUEUE_INSTRUMENTATION. Each queued message then carries the time it was sent, which costs a clock read per
+# send and receive. The setting changes the size of Os::Queue, so it applies to the whole build.
+#
+# If unspecified, it is off, including for unit test builds. The Fw_queue_stats unit test builds its own instrumented
+# queues, so the histograms are tested either way.
+#
+# **Values:**
+# - ON: record queue histograms
+# - OFF: do not record queue histograms
+#
+# e.g. `-DFPRIME_QUEUE_INSTRUMENTATION=ON`
+###
+if (DEFINED FPRIME_QUEUE_INSTRUMENTATION AND NOT "${FPRIME_QUEUE_INSTRUMENTATION}" STREQUAL "ON" AND NOT "${FPRIME_QUEUE_INSTRUMENTATION}" STREQUAL "OFF")
+    message(FATAL_ERROR "FPRIME_QUEUE_INSTRUMENTATION must be set to ON, OFF, or not supplied at all")
+endif()
+
 ####
 # `FPRIME_ENABLE_UTIL_TARGETS`:
 #
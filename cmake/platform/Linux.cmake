@@ -10,6 +10,11 @@ if (NOT DEFINED FPRIME_USE_BAREMETAL_SCHEDULER)
    FIND_PACKAGE ( Threads REQUIRED )
 endif()
 
+# Set platform default for the Os::Queue implementation
+if (NOT DEFINED FPRIME_USE_RING_QUEUE)
+   set(FPRIME_USE_RING_QUEUE OFF)
+endif()
+
 # Use common linux setup
 add_definitions(-DTGT_OS_TYPE_LINUX)
 set(FPRIME_USE_POSIX ON)
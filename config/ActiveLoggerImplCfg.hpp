@@ -23,7 +23,22 @@ enum {
 
 
 enum {
-    TELEM_ID_FILTER_SIZE = 25, //!< Size of telemetry ID filter
+    TELEM_ID_FILTER_SIZE = 256, //!< Number of event IDs that can be filtered or throttled
+};
+
+// When ACTIVE_LOGGER_BATCH_PACKETS is true, events are packed into multi-event
+// packets (see Fw::LogBatchPacket::addEvent()) that are sent when full, on each call
+// of the Run port and after a FATAL event, instead of sending one packet per
+// event. The ground system must decode multi-event (FW_PACKET_LOG_BATCH)
+// packets to use this mode.
+enum {
+    ACTIVE_LOGGER_BATCH_PACKETS = false, //!< Pack multiple events per event packet
+};
+
+// The most recent events are kept in an in-memory log that the DUMP_EVENT_LOG
+// command writes to a file. Each event takes its packet size plus two bytes.
+enum {
+    ACTIVE_LOGGER_EVENT_LOG_SIZE = 8192, //!< Size in bytes of the event log. Must hold at least one Fw::ComBuffer
 };
 
 #endif /* ACTIVELOGGER_ACTIVELOGGERIMPLCFG_HPP_ */
@@ -206,11 +206,35 @@
 #endif
 
 
+// Queues record histograms of message wait time, dispatch time and queue depth (see Os/QueueStats.hpp).
+// Each queued message then carries the time it was sent, which costs a clock read per send and receive.
+// CMake builds set this from FPRIME_QUEUE_INSTRUMENTATION, which defaults to off.
+#ifndef FW_QUEUE_INSTRUMENTATION
+#define FW_QUEUE_INSTRUMENTATION             0   //!< Indicates whether or not queues record statistics
+#endif
+
+#if FW_QUEUE_INSTRUMENTATION
+// Power of two bins per histogram. The last bin holds all larger values.
+ #ifndef FW_QUEUE_STATS_NUM_BINS
+ #define FW_QUEUE_STATS_NUM_BINS                 20  //!< Number of bins in each queue histogram
+ #endif
+#endif
+
 // Specifies the size of the string holding the queue name for queues
 #ifndef FW_QUEUE_NAME_MAX_SIZE
 #define FW_QUEUE_NAME_MAX_SIZE               80   //!< Max size of message queue name
 #endif
 
+// Queued and active components take up to this many messages from their queue in one receive and
+// dispatch them before going back to the queue. Each component allocates storage for this many
+// messages when its queue is created. Batches save queue locking on bursts of messages, but messages
+// in a batch are dispatched before any received after them: a high priority message may wait behind
+// up to FW_COMPONENT_QUEUE_BATCH_SIZE - 1 lower priority ones. The default of 1 receives one message
+// at a time in priority order, with no extra storage.
+#ifndef FW_COMPONENT_QUEUE_BATCH_SIZE
+#define FW_COMPONENT_QUEUE_BATCH_SIZE        1   //!< Max messages received from a component queue at once
+#endif
+
 // Specifies the size of the string holding the task name for active components and tasks
 #ifndef FW_TASK_NAME_MAX_SIZE
 #define FW_TASK_NAME_MAX_SIZE               80    //!< Max size of task name
@@ -277,6 +301,11 @@
 #define FW_FILE_BUFFER_MAX_SIZE             255   //!< Max size of file buffer (i.e. chunk of file)
 #endif
 
+// Specifies the size of the stack buffer used to read a file when calculating its CRC
+#ifndef FW_FILE_CRC_CHUNK_SIZE
+#define FW_FILE_CRC_CHUNK_SIZE              4096  //!< Size of file chunk read per CRC update
+#endif
+
 // Specifies the maximum size of a string in an interface call
 #ifndef FW_INTERNAL_INTERFACE_STRING_MAX_SIZE
 #define FW_INTERNAL_INTERFACE_STRING_MAX_SIZE           256   //!< Max size of interface string parameter type
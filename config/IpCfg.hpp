@@ -20,7 +20,12 @@ enum IpCfg {
     SOCKET_IP_RECV_FLAGS = 0,              // recv FLAGS argument
     SOCKET_MAX_ITERATIONS = 0xFFFF,        // Maximum send/recv attempts before an error is returned
     SOCKET_RETRY_INTERVAL_MS = 1000,       // Interval between connection retries before main recv thread starts
-    SOCKET_MAX_HOSTNAME_SIZE = 256         // Maximum stored hostname
+    SOCKET_MAX_HOSTNAME_SIZE = 256,        // Maximum stored hostname
+    SOCKET_RECV_BATCH_SIZE = 8,            // Maximum datagrams taken by one socket read task receive
+    SOCKET_REACTOR_MAX_SOCKETS = 32,       // Maximum sockets read by one socket reactor
+    SOCKET_REACTOR_JOIN_INTERVAL_MS = 10,  // Interval between retries of sockets that failed to join a reactor's wait set
+    SOCKET_SERVER_REACTOR_CLIENTS = 4,     // Clients served at once by a tcp server component read by a reactor
+    SOCKET_SEND_MAX_SEGMENTS = 3           // Maximum separate buffers sent by one socket sendSegments call
 };
 
 
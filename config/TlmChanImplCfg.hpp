@@ -38,6 +38,11 @@
 //        Entry - a bucket assigned to the slot
 //        ... (Other buckets in the slot)
 //     The number of buckets assigned to each slot can be checked for balance.
+//
+// Alternatively, run Utils/tlmHashTool.py on the deployment's dictionary
+// (e.g. "python3 Utils/tlmHashTool.py Top/RefTopologyAppDictionary.xml").
+// It searches for slot and modulo values that put every channel in its
+// own slot, so each lookup is a single hash and compare with no chain walk.
 
 namespace {
 
@@ -51,6 +56,27 @@ namespace {
                                         // Buckets must be >= number of telemetry channels in system
     };
 
+    // When TLMCHAN_BATCH_PACKETS is true, the Run port packs as many updated
+    // channels as fit into each Fw::ComBuffer (see Fw::TlmBatchPacket::addValue())
+    // instead of sending one packet per channel. The ground system must
+    // decode multi-channel (FW_PACKET_TELEM_BATCH) telemetry packets to use this mode.
+    enum {
+        TLMCHAN_BATCH_PACKETS = false // !< Pack multiple channels per telemetry packet
+    };
+
+    // When TLMCHAN_SEQLOCK_STORE is true, channels are stored in a single table
+    // where each entry is guarded by a sequence count (seqlock) instead of the
+    // component mutex. TlmGet and the Run port retry if a value changes while
+    // it is being read. The mutex is only taken the first time a channel is
+    // written. If two threads write the same channel at the same moment, the
+    // second waits until the first has stored its value. Readers and writers
+    // that keep failing sleep for a millisecond between further attempts, so a
+    // writer preempted in the middle of an update can finish on one core.
+    enum {
+        TLMCHAN_SEQLOCK_STORE = false, // !< Store telemetry with per-entry sequence locks
+        TLMCHAN_SEQLOCK_RETRIES = 100 // !< Attempts spent spinning before sleeping between attempts
+    };
+
 
 }
 
@@ -10,6 +10,7 @@
 
 namespace Svc {
     const static NATIVE_UINT_TYPE UDP_RECEIVER_MSG_SIZE = 256;
+    const static NATIVE_UINT_TYPE UDP_RECEIVER_BATCH_SIZE = 8; //!< packets taken from the socket per receive (Linux only)
 }
 
 #endif /* SVC_UDPRECEIVER_UDPRECEIVERCOMPONENTIMPLCFG_HPP_ */
@@ -10,6 +10,7 @@
 
 namespace Svc {
     static const NATIVE_UINT_TYPE UDP_SENDER_MSG_SIZE = 256;
+    static const NATIVE_UINT_TYPE UDP_SENDER_BATCH_SIZE = 8; //!< packets held for one send while more are queued (Linux only)
 }
 
 #endif /* SVC_UDPSENDER_UDPSENDERCOMPONENTIMPLCFG_HPP_ */